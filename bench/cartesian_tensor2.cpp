@@ -0,0 +1,483 @@
+
+#include "support.h"
+
+// =================================================================================================
+// reference: plain loops on the (row-major) storage
+// =================================================================================================
+
+void dot_ref(const double *A, const double *B, double *C, size_t nd)
+{
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t k = 0 ; k < nd ; ++k ) {
+      double c = 0.0;
+      for ( size_t j = 0 ; j < nd ; ++j )
+        c += A[i*nd+j] * B[j*nd+k];
+      C[i*nd+k] = c;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+double ddot_ref(const double *A, const double *B, size_t nd)
+{
+  double C = 0.0;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      C += A[i*nd+j] * B[j*nd+i];
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void dyadic_ref(const double *A, const double *B, double *C, size_t nd)
+{
+  for ( size_t i = 0 ; i < nd*nd ; ++i )
+    for ( size_t j = 0 ; j < nd*nd ; ++j )
+      C[i*nd*nd+j] = A[i] * B[j];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+double trace_ref(const double *A, size_t nd)
+{
+  double C = 0.0;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    C += A[i*nd+i];
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+double det_ref(const double *A, size_t nd)
+{
+  if ( nd == 2 ) return A[0] * A[3] - A[1] * A[2];
+
+  return ( A[0] * A[4] * A[8] + A[1] * A[5] * A[6] + A[2] * A[3] * A[7] ) -
+         ( A[2] * A[4] * A[6] + A[1] * A[3] * A[8] + A[5] * A[7] * A[0] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void inv_ref(const double *A, double *C, size_t nd)
+{
+  double D = det_ref(A, nd);
+
+  if ( nd == 2 )
+  {
+    C[0] =   A[3] / D;
+    C[1] = - A[1] / D;
+    C[2] = - A[2] / D;
+    C[3] =   A[0] / D;
+    return;
+  }
+
+  C[0] = (A[4]*A[8]-A[5]*A[7]) / D;
+  C[1] = (A[2]*A[7]-A[1]*A[8]) / D;
+  C[2] = (A[1]*A[5]-A[2]*A[4]) / D;
+  C[3] = (A[5]*A[6]-A[3]*A[8]) / D;
+  C[4] = (A[0]*A[8]-A[2]*A[6]) / D;
+  C[5] = (A[2]*A[3]-A[0]*A[5]) / D;
+  C[6] = (A[3]*A[7]-A[4]*A[6]) / D;
+  C[7] = (A[1]*A[6]-A[0]*A[7]) / D;
+  C[8] = (A[0]*A[4]-A[1]*A[3]) / D;
+}
+
+// =================================================================================================
+// benchmark: "var" tensors
+// =================================================================================================
+
+void bench_var(size_t nd)
+{
+  typedef cppmat::cartesian::tensor2<double> T2;
+
+  T2 A = T2::Random(nd, 1., 2.);
+  T2 B = T2::Random(nd, 1., 2.);
+
+  // add the identity: invertible
+  A += T2::I(nd);
+
+  std::vector<double> C(nd*nd*nd*nd);
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> M;
+
+  M EA = Eigen::Map<const M>(A.data(), nd, nd);
+  M EB = Eigen::Map<const M>(B.data(), nd, nd);
+  M EC(nd, nd);
+#endif
+
+  run("dot(tensor2,tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.dot(B).data()[0]); },
+    {
+      {"loop" , [&]() { dot_ref(A.data(), B.data(), C.data(), nd); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC.noalias() = EA * EB; doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  run("ddot(tensor2,tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.ddot(B)); },
+    {
+      {"loop" , [&]() { doNotOptimize(ddot_ref(A.data(), B.data(), nd)); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.cwiseProduct(EB.transpose()).sum()); }},
+#endif
+    }
+  );
+
+  run("dyadic(tensor2,tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.dyadic(B).data()[0]); },
+    {{"loop", [&]() { dyadic_ref(A.data(), B.data(), C.data(), nd); doNotOptimize(C[0]); }}}
+  );
+
+  run("trace(tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.trace()); },
+    {
+      {"loop" , [&]() { doNotOptimize(trace_ref(A.data(), nd)); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.trace()); }},
+#endif
+    }
+  );
+
+  // short-lived temporaries: from the heap (default), or from a pool or an arena
+
+  cppmat::memory::pool  pool;
+  cppmat::memory::arena arena;
+
+  auto temporaries = [&]() { T2 D = A.dot(B); T2 E = D + A; doNotOptimize(E.data()[0]); };
+
+  run("temporaries(dot,+)", "var", label(nd),
+    [&]() { temporaries(); },
+    {
+      {"pool" , [&]() { cppmat::memory::scope scope(pool); temporaries(); }},
+      {"arena", [&]() { arena.reset(); cppmat::memory::scope scope(arena); temporaries(); }},
+    }
+  );
+
+  if ( nd > 3 ) return;
+
+  run("det(tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.det()); },
+    {
+      {"loop" , [&]() { doNotOptimize(det_ref(A.data(), nd)); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.determinant()); }},
+#endif
+    }
+  );
+
+  run("inv(tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.inv().data()[0]); },
+    {
+      {"loop" , [&]() { inv_ref(A.data(), C.data(), nd); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC = EA.inverse(); doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+// benchmark: "tiny" tensors, and "view" tensors (that map the storage of a "tiny" tensor, and are
+// copied to a "tiny" tensor to compute)
+// =================================================================================================
+
+template<size_t nd>
+void bench_tiny()
+{
+  typedef cppmat::tiny::cartesian::tensor2<double,nd> T2;
+  typedef cppmat::view::cartesian::tensor2<double,nd> V2;
+
+  T2 A = T2::Random(1., 2.);
+  T2 B = T2::Random(1., 2.);
+
+  // add the identity: invertible
+  A += T2::I();
+
+  V2 VA = V2::Map(A.data());
+  V2 VB = V2::Map(B.data());
+
+  double C[nd*nd*nd*nd];
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,nd,nd,Eigen::RowMajor> M;
+
+  M EA = Eigen::Map<const M>(A.data());
+  M EB = Eigen::Map<const M>(B.data());
+  M EC;
+#endif
+
+  // tiny
+
+  run("dot(tensor2,tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.dot(B).data()[0]); },
+    {
+      {"loop" , [&]() { dot_ref(A.data(), B.data(), C, nd); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC.noalias() = EA * EB; doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  run("ddot(tensor2,tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.ddot(B)); },
+    {
+      {"loop" , [&]() { doNotOptimize(ddot_ref(A.data(), B.data(), nd)); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.cwiseProduct(EB.transpose()).sum()); }},
+#endif
+    }
+  );
+
+  run("dyadic(tensor2,tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.dyadic(B).data()[0]); },
+    {{"loop", [&]() { dyadic_ref(A.data(), B.data(), C, nd); doNotOptimize(C[0]); }}}
+  );
+
+  run("trace(tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.trace()); },
+    {
+      {"loop" , [&]() { doNotOptimize(trace_ref(A.data(), nd)); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.trace()); }},
+#endif
+    }
+  );
+
+  run("det(tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.det()); },
+    {
+      {"loop" , [&]() { doNotOptimize(det_ref(A.data(), nd)); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.determinant()); }},
+#endif
+    }
+  );
+
+  run("inv(tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.inv().data()[0]); },
+    {
+      {"loop" , [&]() { inv_ref(A.data(), C, nd); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC = EA.inverse(); doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  // view
+
+  run("dot(tensor2,tensor2)", "view", label(nd),
+    [&]() { doNotOptimize(T2(VA).dot(T2(VB)).data()[0]); },
+    {{"loop", [&]() { dot_ref(VA.data(), VB.data(), C, nd); doNotOptimize(C[0]); }}}
+  );
+
+  run("ddot(tensor2,tensor2)", "view", label(nd),
+    [&]() { doNotOptimize(T2(VA).ddot(T2(VB))); },
+    {{"loop", [&]() { doNotOptimize(ddot_ref(VA.data(), VB.data(), nd)); }}}
+  );
+
+  run("inv(tensor2)", "view", label(nd),
+    [&]() { doNotOptimize(T2(VA).inv().data()[0]); },
+    {{"loop", [&]() { inv_ref(VA.data(), C, nd); doNotOptimize(C[0]); }}}
+  );
+}
+
+// =================================================================================================
+// benchmark: eigen-decomposition of "tiny" symmetric tensors, one at a time and batched
+// =================================================================================================
+
+template<size_t nd>
+void bench_eig()
+{
+  typedef cppmat::tiny::cartesian::tensor2s<double,nd> T2s;
+  typedef cppmat::tiny::cartesian::tensor2 <double,nd> T2;
+  typedef cppmat::tiny::cartesian::vector  <double,nd> V;
+  typedef cppmat::cartesian::field<T2s>                F;
+
+  T2s A = T2s::Random(-1., 1.);
+  V   val;
+  T2  vec;
+
+  size_t n = 10000;
+
+  F FA(n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    FA.set(i, T2s::Random(-1., 1.));
+
+  cppmat::cartesian::field<V>  Fval;
+  cppmat::cartesian::field<T2> Fvec;
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,nd,nd> M;
+
+  M EA;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      EA(i,j) = A(i,j);
+
+  Eigen::SelfAdjointEigenSolver<M> solver;
+
+  // the copy to Eigen is part of the (batched) baseline
+  auto eigen_batch = [&]() {
+    for ( size_t p = 0 ; p < n ; ++p ) {
+      T2s a = FA[p];
+      for ( size_t i = 0 ; i < nd ; ++i )
+        for ( size_t j = 0 ; j < nd ; ++j )
+          EA(i,j) = a(i,j);
+      solver.computeDirect(EA);
+      doNotOptimize(solver.eigenvectors()(0,0));
+    }
+  };
+#endif
+
+  run("eig(tensor2s)", "tiny", label(nd),
+    [&]() { A.eig(val, vec); doNotOptimize(vec[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen"       , [&]() { solver.compute(EA); doNotOptimize(solver.eigenvectors()(0,0)); }},
+      {"eigen-direct", [&]() { solver.computeDirect(EA); doNotOptimize(solver.eigenvectors()(0,0)); }},
+#endif
+    }
+  );
+
+  run("eigenvalues(tensor2s)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.eigenvalues()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen-direct", [&]() { solver.computeDirect(EA, Eigen::EigenvaluesOnly); doNotOptimize(solver.eigenvalues()(0)); }},
+#endif
+    }
+  );
+
+  run("eig(field<tensor2s>)", "field", label({n, nd, nd}),
+    [&]() { cppmat::cartesian::eig(FA, Fval, Fvec); doNotOptimize(Fvec.data()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen-direct", eigen_batch},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+
+template<size_t nd>
+void bench_isotropic()
+{
+  typedef cppmat::tiny::cartesian::tensor2s<double,nd> T2s;
+  typedef cppmat::tiny::cartesian::tensor4 <double,nd> T4;
+  typedef cppmat::cartesian::field<T2s>                F;
+
+  // positive definite (diagonally dominant)
+  auto random = []() {
+    T2s out = T2s::Random(-1., 1.);
+    for ( size_t i = 0 ; i < nd ; ++i )
+      out(i,i) += 2. * nd;
+    return out;
+  };
+
+  T2s A = random();
+  T4  dA;
+
+  size_t n = 10000;
+
+  F FA(n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    FA.set(i, random());
+
+  cppmat::cartesian::field<T4> FdA;
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,nd,nd> M;
+
+  M EA, EF;
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      EA(i,j) = A(i,j);
+
+  Eigen::SelfAdjointEigenSolver<M> solver;
+
+  // round-trip through Eigen: "V * diag(log(l)) * V^T"
+  auto eigen_log = [&]() {
+    solver.computeDirect(EA);
+    EF = solver.eigenvectors() * solver.eigenvalues().array().log().matrix().asDiagonal() *
+         solver.eigenvectors().transpose();
+  };
+
+  // the copy to and from Eigen is part of the (batched) baseline
+  F FF(n);
+
+  auto eigen_batch = [&]() {
+    for ( size_t p = 0 ; p < n ; ++p ) {
+      T2s a = FA[p];
+      for ( size_t i = 0 ; i < nd ; ++i )
+        for ( size_t j = 0 ; j < nd ; ++j )
+          EA(i,j) = a(i,j);
+      eigen_log();
+      for ( size_t i = 0 ; i < nd ; ++i )
+        for ( size_t j = i ; j < nd ; ++j )
+          a(i,j) = EF(i,j);
+      FF.set(p, a);
+    }
+    doNotOptimize(FF.data()[0]);
+  };
+#endif
+
+  run("log(tensor2s)", "tiny", label(nd),
+    [&]() { doNotOptimize(cppmat::cartesian::log(A)[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen-direct", [&]() { eigen_log(); doNotOptimize(EF(0,0)); }},
+#endif
+    }
+  );
+
+  run("log(tensor2s, dFdA)", "tiny", label(nd),
+    [&]() { doNotOptimize(cppmat::cartesian::log(A, dA)[0]); doNotOptimize(dA[0]); }
+  );
+
+  run("log(field<tensor2s>)", "field", label({n, nd, nd}),
+    [&]() { doNotOptimize(cppmat::cartesian::log(FA).data()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen-direct", eigen_batch},
+#endif
+    }
+  );
+
+  run("log(field<tensor2s>, dFdA)", "field", label({n, nd, nd}),
+    [&]() { doNotOptimize(cppmat::cartesian::log(FA, FdA).data()[0]); doNotOptimize(FdA.data()[0]); }
+  );
+}
+
+// =================================================================================================
+
+int main(int argc, char **argv)
+{
+  init(argc, argv);
+
+  bench_tiny<2>();
+  bench_tiny<3>();
+
+  bench_eig<2>();
+  bench_eig<3>();
+
+  bench_isotropic<2>();
+  bench_isotropic<3>();
+
+  for ( size_t nd : {2, 3, 6, 9} )
+    bench_var(nd);
+
+  return finish();
+}
@@ -0,0 +1,160 @@
+
+#include "support.h"
+
+// =================================================================================================
+// reference: index notation (for "var" and "tiny" tensors)
+// =================================================================================================
+
+template<class T4>
+void ddot_ref(const T4 &A, const T4 &B, T4 &C)
+{
+  size_t ND = A.ndim();
+
+  C.setZero();
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      for ( size_t k = 0 ; k < ND ; ++k )
+        for ( size_t l = 0 ; l < ND ; ++l )
+          for ( size_t m = 0 ; m < ND ; ++m )
+            for ( size_t n = 0 ; n < ND ; ++n )
+              C(i,j,m,n) += A(i,j,k,l) * B(l,k,m,n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T4, class T2>
+void ddot_ref(const T4 &A, const T2 &B, T2 &C)
+{
+  size_t ND = A.ndim();
+
+  C.setZero();
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      for ( size_t k = 0 ; k < ND ; ++k )
+        for ( size_t l = 0 ; l < ND ; ++l )
+          C(i,j) += A(i,j,k,l) * B(l,k);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T2, class T4>
+void ddot_ref(const T2 &A, const T4 &B, T2 &C, int)
+{
+  size_t ND = A.ndim();
+
+  C.setZero();
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      for ( size_t k = 0 ; k < ND ; ++k )
+        for ( size_t l = 0 ; l < ND ; ++l )
+          C(k,l) += A(i,j) * B(j,i,k,l);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T2s, class T4>
+void dyadic_ref(const T2s &A, const T2s &B, T4 &C)
+{
+  size_t ND = A.ndim();
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      for ( size_t k = 0 ; k < ND ; ++k )
+        for ( size_t l = 0 ; l < ND ; ++l )
+          C(i,j,k,l) = A(i,j) * B(k,l);
+}
+
+// =================================================================================================
+// benchmark: "var" tensors
+// =================================================================================================
+
+void bench_var(size_t nd)
+{
+  typedef cppmat::cartesian::tensor4 <double> T4;
+  typedef cppmat::cartesian::tensor2 <double> T2;
+  typedef cppmat::cartesian::tensor2s<double> T2s;
+
+  T4  A = T4 ::Random(nd);
+  T4  B = T4 ::Random(nd);
+  T2  E = T2 ::Random(nd);
+  T2s F = T2s::Random(nd);
+  T4  C(nd);
+  T2  D(nd);
+
+  run("ddot(tensor4,tensor4)", "var", label(nd),
+    [&]() { doNotOptimize(A.ddot(B).data()[0]); },
+    {{"loop", [&]() { ddot_ref(A, B, C); doNotOptimize(C.data()[0]); }}}
+  );
+
+  run("ddot(tensor4,tensor2)", "var", label(nd),
+    [&]() { doNotOptimize(A.ddot(E).data()[0]); },
+    {{"loop", [&]() { ddot_ref(A, E, D); doNotOptimize(D.data()[0]); }}}
+  );
+
+  run("ddot(tensor2,tensor4)", "var", label(nd),
+    [&]() { doNotOptimize(E.ddot(A).data()[0]); },
+    {{"loop", [&]() { ddot_ref(E, A, D, 0); doNotOptimize(D.data()[0]); }}}
+  );
+
+  run("dyadic(tensor2s,tensor2s)", "var", label(nd),
+    [&]() { doNotOptimize(F.dyadic(F).data()[0]); },
+    {{"loop", [&]() { dyadic_ref(F, F, C); doNotOptimize(C.data()[0]); }}}
+  );
+}
+
+// =================================================================================================
+// benchmark: "tiny" tensors
+// =================================================================================================
+
+template<size_t nd>
+void bench_tiny()
+{
+  typedef cppmat::tiny::cartesian::tensor4 <double,nd> T4;
+  typedef cppmat::tiny::cartesian::tensor2 <double,nd> T2;
+  typedef cppmat::tiny::cartesian::tensor2s<double,nd> T2s;
+
+  T4  A = T4 ::Random();
+  T4  B = T4 ::Random();
+  T2  E = T2 ::Random();
+  T2s F = T2s::Random();
+  T4  C;
+  T2  D;
+
+  run("ddot(tensor4,tensor4)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.ddot(B).data()[0]); },
+    {{"loop", [&]() { ddot_ref(A, B, C); doNotOptimize(C.data()[0]); }}}
+  );
+
+  run("ddot(tensor4,tensor2)", "tiny", label(nd),
+    [&]() { doNotOptimize(A.ddot(E).data()[0]); },
+    {{"loop", [&]() { ddot_ref(A, E, D); doNotOptimize(D.data()[0]); }}}
+  );
+
+  run("ddot(tensor2,tensor4)", "tiny", label(nd),
+    [&]() { doNotOptimize(E.ddot(A).data()[0]); },
+    {{"loop", [&]() { ddot_ref(E, A, D, 0); doNotOptimize(D.data()[0]); }}}
+  );
+
+  run("dyadic(tensor2s,tensor2s)", "tiny", label(nd),
+    [&]() { doNotOptimize(F.dyadic(F).data()[0]); },
+    {{"loop", [&]() { dyadic_ref(F, F, C); doNotOptimize(C.data()[0]); }}}
+  );
+}
+
+// =================================================================================================
+
+int main(int argc, char **argv)
+{
+  init(argc, argv);
+
+  bench_tiny<2>();
+  bench_tiny<3>();
+
+  for ( size_t nd : {2, 3, 6, 9, 12} )
+    bench_var(nd);
+
+  return finish();
+}
@@ -0,0 +1,86 @@
+r'''
+Compare two sets of benchmark results (written using "--json"), e.g. of two commits. Each set is
+one JSON-file or a directory with JSON-files. For each operation of "cppmat" (and optionally of the
+baselines) the ratio of the new and the old time is listed. The operations that are slower than
+"--threshold" are flagged, in which case the exit code is 1.
+
+Usage:
+  compare.py [options] <old> <new>
+
+Options:
+  --threshold=N  Flag operations whose time increased by more than this factor [default: 1.1].
+  --all          Also compare the baselines (e.g. to detect differences in the machine load).
+  --quiet        Only list the flagged operations.
+  -h, --help     Show help.
+'''
+
+import argparse, glob, json, os, sys
+
+# ==================================================================================================
+
+def read(path):
+  r'''
+Read the results from a JSON-file, or from all JSON-files in a directory. Returns a dictionary
+"name -> time [ns]".
+  '''
+
+  if os.path.isdir(path): files = sorted(glob.glob(os.path.join(path, '*.json')))
+  else                  : files = [path]
+
+  scale = {'ns': 1., 'us': 1.e3, 'ms': 1.e6, 's': 1.e9}
+
+  out = {}
+
+  for name in files:
+    with open(name, 'r') as file:
+      data = json.load(file)
+    for bench in data['benchmarks']:
+      out[bench['name']] = bench['real_time'] * scale[bench.get('time_unit', 'ns')]
+
+  return out
+
+# ==================================================================================================
+
+parser = argparse.ArgumentParser(usage=__doc__)
+parser.add_argument('old')
+parser.add_argument('new')
+parser.add_argument('--threshold', type=float, default=1.1)
+parser.add_argument('--all'      , action='store_true')
+parser.add_argument('--quiet'    , action='store_true')
+args = parser.parse_args()
+
+old = read(args.old)
+new = read(args.new)
+
+# ==================================================================================================
+
+flagged = 0
+
+names = [name for name in sorted(new) if name in old]
+
+if not args.all:
+  names = [name for name in names if name.endswith('/cppmat')]
+
+print('{0:60s} {1:>12s} {2:>12s} {3:>8s}'.format('benchmark', 'old [ns]', 'new [ns]', 'new/old'))
+
+for name in names:
+
+  ratio = new[name] / old[name]
+  flag  = ratio > args.threshold
+
+  if flag: flagged += 1
+
+  if flag or not args.quiet:
+    print('{0:60s} {1:12.3e} {2:12.3e} {3:8.2f} {4:s}'.format(
+      name, old[name], new[name], ratio, '<-- slower' if flag else ''))
+
+for name in sorted(set(new) - set(old)):
+  if not args.quiet: print('{0:60s} (new)'.format(name))
+
+for name in sorted(set(old) - set(new)):
+  if not args.quiet: print('{0:60s} (removed)'.format(name))
+
+print('')
+print('{0:d} of {1:d} benchmarks slower than {2:.2f}x'.format(flagged, len(names), args.threshold))
+
+sys.exit(1 if flagged > 0 else 0)
@@ -0,0 +1,40 @@
+
+// Python module with functions that only convert their arguments and return value, to time the
+// pybind11 type casters of cppmat (see "python.py")
+
+#include <pybind11/pybind11.h>
+
+// #include <cppmat/pybind11.h>
+#include "../src/cppmat/pybind11.h"
+
+namespace py = pybind11;
+
+// =================================================================================================
+
+template<class T> T      identity(const T &A) { return A; }
+template<class T> double first   (const T &A) { return A.data()[0]; }
+
+// -------------------------------------------------------------------------------------------------
+
+PYBIND11_MODULE(cppmat_bench, m)
+{
+  // NumPy -> C++ -> NumPy
+
+  m.def("var_array"   , &identity<cppmat::array<double>>);
+  m.def("var_tensor2" , &identity<cppmat::cartesian::tensor2<double>>);
+  m.def("var_tensor4" , &identity<cppmat::cartesian::tensor4<double>>);
+  m.def("tiny_tensor2", &identity<cppmat::tiny::cartesian::tensor2<double,3>>);
+  m.def("tiny_tensor4", &identity<cppmat::tiny::cartesian::tensor4<double,3>>);
+
+  // NumPy -> C++
+
+  m.def("var_array_in"    , &first<cppmat::array<double>>);
+  m.def("view_tensor2_in" , &first<cppmat::view::cartesian::tensor2<double,3>>);
+  m.def("view_strided_in" , &first<cppmat::view::strided<const double>>);
+
+  // batched operations
+
+  cppmat::python::cartesian::bind<double>(m);
+}
+
+// =================================================================================================
@@ -0,0 +1,140 @@
+r'''
+Time the pybind11 type casters and the batched operations of cppmat, compared to NumPy.
+
+Usage:
+  python.py [options]
+
+Options:
+  --json=N      Write the results to a file (JSON).
+  --path=N      Directory that contains the "cppmat_bench" module [default: .].
+  --repeat=N    Number of repetitions (the fastest is reported) [default: 5].
+  --min-time=N  Minimal duration of one repetition [default: 0.05].
+  -h, --help    Show help.
+'''
+
+import argparse, datetime, json, sys, timeit
+
+import numpy as np
+
+# ==================================================================================================
+
+parser = argparse.ArgumentParser(usage=__doc__)
+parser.add_argument('--json'    , type=str  , default=None)
+parser.add_argument('--path'    , type=str  , default='.')
+parser.add_argument('--repeat'  , type=int  , default=5)
+parser.add_argument('--min-time', type=float, default=0.05)
+args = parser.parse_args()
+
+sys.path.insert(0, args.path)
+
+import cppmat_bench as cb
+
+# ==================================================================================================
+
+results = []
+
+def measure(func):
+  r'''
+Time of one call to "func": the best of a number of repetitions of a number of calls that takes at
+least "--min-time" seconds.
+  '''
+
+  n = 1
+
+  while True:
+    t = timeit.timeit(func, number=n)
+    if t >= args.min_time: break
+    n *= 2
+
+  t = min([t] + timeit.repeat(func, number=n, repeat=args.repeat-1))
+
+  return t / n, n
+
+# --------------------------------------------------------------------------------------------------
+
+def run(name, kind, size, cppmat, baselines={}):
+  r'''
+Time "cppmat" and a number of baselines (e.g. {"numpy": ...}) of one operation, print one line of
+the table, and store the results.
+  '''
+
+  t0 = None
+  line = ''
+
+  for impl, func in [('cppmat', cppmat)] + sorted(baselines.items()):
+
+    t, n = measure(func)
+
+    results.append({
+      'name'          : '{0:s}/{1:s}/{2:s}/{3:s}'.format(kind, name, size, impl),
+      'operation'     : name,
+      'class'         : kind,
+      'size'          : size,
+      'implementation': impl,
+      'iterations'    : n,
+      'real_time'     : t * 1.e9,
+      'time_unit'     : 'ns',
+    })
+
+    if t0 is None:
+      t0 = t
+      line = '{0:28s} {1:5s} {2:10s} {3:12.3e}  '.format(name, kind, size, t)
+    else:
+      line += ' {0:s} {1:.2f}x'.format(impl, t / t0)
+
+  print(line)
+
+# ==================================================================================================
+
+print('{0:28s} {1:5s} {2:10s} {3:>12s}   {4:s}'.format('operation', 'class', 'size', 'cppmat', 'baselines'))
+
+# type casters
+
+for shape in [(10, 10), (1000, 1000)]:
+
+  A    = np.random.random(shape)
+  size = 'x'.join([str(i) for i in shape])
+
+  run('cast(array)'    , 'var' , size, lambda: cb.var_array(A)      , {'numpy': lambda: A.copy()})
+  run('cast_in(array)' , 'var' , size, lambda: cb.var_array_in(A)   , {'numpy': lambda: A[0,0]  })
+  run('cast_in(array)' , 'view', size, lambda: cb.view_strided_in(A), {'numpy': lambda: A[0,0]  })
+
+A = np.random.random((3, 3))
+B = np.random.random((3, 3, 3, 3))
+
+run('cast(tensor2)'   , 'var' , 'ND=3', lambda: cb.var_tensor2(A)    , {'numpy': lambda: A.copy()})
+run('cast(tensor2)'   , 'tiny', 'ND=3', lambda: cb.tiny_tensor2(A)   , {'numpy': lambda: A.copy()})
+run('cast_in(tensor2)', 'view', 'ND=3', lambda: cb.view_tensor2_in(A), {'numpy': lambda: A[0,0]  })
+run('cast(tensor4)'   , 'var' , 'ND=3', lambda: cb.var_tensor4(B)    , {'numpy': lambda: B.copy()})
+run('cast(tensor4)'   , 'tiny', 'ND=3', lambda: cb.tiny_tensor4(B)   , {'numpy': lambda: B.copy()})
+
+# batched operations
+
+for n in [10, 10000]:
+
+  A = np.random.random((n, 3, 3))
+  B = np.random.random((n, 3, 3))
+  C = np.random.random((3, 3, 3, 3))
+  size = '{0:d}xND=3'.format(n)
+
+  run('ddot42', 'batch', size, lambda: cb.ddot42(C, A), {'numpy': lambda: np.einsum('ijkl,nlk->nij', C, A)})
+  run('ddot22', 'batch', size, lambda: cb.ddot22(A, B), {'numpy': lambda: np.einsum('nij,nji->n', A, B)})
+  run('dot22' , 'batch', size, lambda: cb.dot22 (A, B), {'numpy': lambda: np.einsum('nij,njk->nik', A, B)})
+  run('det'   , 'batch', size, lambda: cb.det   (A)   , {'numpy': lambda: np.linalg.det(A)})
+  run('inv'   , 'batch', size, lambda: cb.inv   (A)   , {'numpy': lambda: np.linalg.inv(A)})
+
+# ==================================================================================================
+
+if args.json:
+
+  with open(args.json, 'w') as file:
+    json.dump({
+      'context': {
+        'date'       : datetime.datetime.now().strftime('%Y-%m-%dT%H:%M:%S'),
+        'executable' : sys.argv[0],
+        'python'     : sys.version.split()[0],
+        'numpy'      : np.__version__,
+        'repetitions': args.repeat,
+      },
+      'benchmarks': results,
+    }, file, indent=2)
@@ -0,0 +1,300 @@
+#ifndef SUPPORT_H
+#define SUPPORT_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+// -------------------------------------------------------------------------------------------------
+
+// #include <cppmat/cppmat.h>
+#include "../src/cppmat/cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+// baseline: Eigen (if it is available, see "CMakeLists.txt")
+#ifdef CPPMAT_BENCH_EIGEN
+#include <Eigen/Eigen>
+#endif
+
+// =================================================================================================
+
+// prevent the compiler from optimizing away a result that is not used otherwise
+template<class T>
+inline void doNotOptimize(const T &value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// =================================================================================================
+// options, set from the command-line by "init"
+// - "--json FILE"   : write the results to "FILE" (JSON)
+// - "--filter NAME" : only run operations whose name contains "NAME"
+// - "--min-time T"  : minimal duration of one repetition [s]
+// - "--repeat N"    : number of repetitions (the fastest is reported)
+// =================================================================================================
+
+struct options
+{
+  std::string program;
+  std::string json;
+  std::string filter;
+  double      tmin = 0.05;
+  size_t      nrep = 5;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+inline options& settings()
+{
+  static options out;
+  return out;
+}
+
+// =================================================================================================
+// results: one timing of one implementation of an operation
+// =================================================================================================
+
+struct result
+{
+  std::string name;           // operation, e.g. "ddot(tensor4,tensor4)"
+  std::string type;           // class of the operands: "var", "tiny", or "view"
+  std::string size;           // size of the operands, e.g. "ND=3" or "1000x1000"
+  std::string implementation; // "cppmat", or a baseline: "loop" (plain loops) or "eigen"
+  double      time;           // time of one call [s]
+  size_t      iterations;     // number of calls per repetition
+};
+
+// -------------------------------------------------------------------------------------------------
+
+inline std::vector<result>& results()
+{
+  static std::vector<result> out;
+  return out;
+}
+
+// =================================================================================================
+
+// time (in seconds) of one call to "func": the best of "nrep" repetitions of a number of calls that
+// takes at least "tmin" seconds (the number of calls is stored in "iterations")
+template<class F>
+inline double measure(F func, size_t nrep, double tmin, size_t &iterations)
+{
+  typedef std::chrono::high_resolution_clock clock;
+
+  double best = std::numeric_limits<double>::max();
+  size_t n    = 1;
+
+  // number of calls per repetition
+  while ( true )
+  {
+    auto t0 = clock::now();
+
+    for ( size_t i = 0 ; i < n ; ++i )
+      func();
+
+    double t = std::chrono::duration<double>(clock::now() - t0).count();
+
+    if ( t >= tmin ) { best = t / static_cast<double>(n); break; }
+
+    n *= 2;
+  }
+
+  // repetitions
+  for ( size_t r = 1 ; r < nrep ; ++r )
+  {
+    auto t0 = clock::now();
+
+    for ( size_t i = 0 ; i < n ; ++i )
+      func();
+
+    best = std::min(best, std::chrono::duration<double>(clock::now() - t0).count() / static_cast<double>(n));
+  }
+
+  iterations = n;
+
+  return best;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class F>
+inline double measure(F func, size_t nrep=5, double tmin=0.05)
+{
+  size_t iterations;
+
+  return measure(func, nrep, tmin, iterations);
+}
+
+// =================================================================================================
+
+// read the command-line options, and print the header of the table
+inline void init(int argc, char **argv)
+{
+  options &opt = settings();
+
+  opt.program = argv[0];
+
+  for ( int i = 1 ; i < argc ; ++i )
+  {
+    std::string key = argv[i];
+
+    if ( i+1 >= argc ) { std::fprintf(stderr, "Missing value of option '%s'\n", argv[i]); std::exit(1); }
+
+    if      ( key == "--json"     ) opt.json   = argv[++i];
+    else if ( key == "--filter"   ) opt.filter = argv[++i];
+    else if ( key == "--min-time" ) opt.tmin   = std::stod(argv[++i]);
+    else if ( key == "--repeat"   ) opt.nrep   = std::stoul(argv[++i]);
+    else { std::fprintf(stderr, "Unknown option '%s'\n", argv[i]); std::exit(1); }
+  }
+
+  std::printf("%-28s %-5s %-10s %12s   %s\n", "operation", "class", "size", "cppmat", "baselines");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// time "cppmat" and a number of baselines (e.g. {"loop", ...}, {"eigen", ...}) of one operation,
+// print one line of the table (the time of "cppmat", and the time of each baseline relative to it),
+// and store the results
+inline void run(
+  const std::string &name, const std::string &type, const std::string &size,
+  const std::function<void()> &cppmat,
+  const std::vector<std::pair<std::string, std::function<void()>>> &baselines={})
+{
+  options &opt = settings();
+
+  if ( name.find(opt.filter) == std::string::npos ) return;
+
+  std::vector<std::pair<std::string, std::function<void()>>> impl = {{"cppmat", cppmat}};
+
+  impl.insert(impl.end(), baselines.begin(), baselines.end());
+
+  double t0 = 0.0;
+
+  for ( auto &i : impl )
+  {
+    result res;
+
+    res.name           = name;
+    res.type           = type;
+    res.size           = size;
+    res.implementation = i.first;
+    res.time           = measure(i.second, opt.nrep, opt.tmin, res.iterations);
+
+    results().push_back(res);
+
+    if ( i.first == "cppmat" )
+    {
+      t0 = res.time;
+      std::printf("%-28s %-5s %-10s %12.3e  ", name.c_str(), type.c_str(), size.c_str(), t0);
+    }
+    else
+    {
+      std::printf(" %s %.2fx", i.first.c_str(), res.time / t0);
+    }
+
+    std::fflush(stdout);
+  }
+
+  std::printf("\n");
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// size as string: "ND=3", or "1000x1000"
+inline std::string label(size_t nd)
+{
+  return "ND=" + std::to_string(nd);
+}
+
+inline std::string label(const std::vector<size_t> &shape)
+{
+  std::string out;
+
+  for ( size_t i = 0 ; i < shape.size() ; ++i )
+    out += ( i > 0 ? "x" : "" ) + std::to_string(shape[i]);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// write the results to the file specified by "--json" (if any), in the format of Google Benchmark:
+// "context" describes the build, "benchmarks" lists all results (times in nanoseconds)
+inline int finish()
+{
+  options &opt = settings();
+
+  if ( opt.json.size() == 0 ) return 0;
+
+  std::ofstream out(opt.json);
+
+  if ( !out ) { std::fprintf(stderr, "Cannot write '%s'\n", opt.json.c_str()); return 1; }
+
+  char date[64];
+  std::time_t now = std::time(nullptr);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+#ifdef CPPMAT_PARALLEL
+  bool parallel = true;
+#else
+  bool parallel = false;
+#endif
+
+#ifdef CPPMAT_BENCH_EIGEN
+  bool eigen = true;
+#else
+  bool eigen = false;
+#endif
+
+  out << "{\n";
+  out << "  \"context\": {\n";
+  out << "    \"date\": \"" << date << "\",\n";
+  out << "    \"executable\": \"" << opt.program << "\",\n";
+  out << "    \"compiler\": \"" << __VERSION__ << "\",\n";
+  out << "    \"cppmat_version\": \"" << CPPMAT_WORLD_VERSION << "." << CPPMAT_MAJOR_VERSION << "."
+      << CPPMAT_MINOR_VERSION << "\",\n";
+  out << "    \"parallel\": " << ( parallel ? "true" : "false" ) << ",\n";
+  out << "    \"eigen\": " << ( eigen ? "true" : "false" ) << ",\n";
+  out << "    \"repetitions\": " << opt.nrep << "\n";
+  out << "  },\n";
+  out << "  \"benchmarks\": [\n";
+
+  for ( size_t i = 0 ; i < results().size() ; ++i )
+  {
+    const result &r = results()[i];
+
+    char time[64];
+    std::snprintf(time, sizeof(time), "%.6e", r.time * 1.e9);
+
+    out << "    {";
+    out << "\"name\": \"" << r.type << "/" << r.name << "/" << r.size << "/" << r.implementation << "\", ";
+    out << "\"operation\": \"" << r.name << "\", ";
+    out << "\"class\": \"" << r.type << "\", ";
+    out << "\"size\": \"" << r.size << "\", ";
+    out << "\"implementation\": \"" << r.implementation << "\", ";
+    out << "\"iterations\": " << r.iterations << ", ";
+    out << "\"real_time\": " << time << ", ";
+    out << "\"time_unit\": \"ns\"";
+    out << "}" << ( i+1 < results().size() ? "," : "" ) << "\n";
+  }
+
+  out << "  ]\n";
+  out << "}\n";
+
+  return 0;
+}
+
+// =================================================================================================
+
+#endif
@@ -0,0 +1,273 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+
+// =================================================================================================
+// benchmark: rank 2
+// =================================================================================================
+
+void bench_rank2(size_t n)
+{
+  Arr A = Arr::Random({n, n});
+  Arr B = Arr::Random({n, n});
+  Arr C = Arr::Zero  ({n, n});
+
+  std::vector<double> c(n);
+
+  const double *a = A.data();
+  const double *b = B.data();
+  double       *d = C.data();
+
+  std::string size = label(A.shape());
+
+  int N = static_cast<int>(n);
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> M;
+
+  M EA = Eigen::Map<const M>(A.data(), n, n);
+  M EB = Eigen::Map<const M>(B.data(), n, n);
+  M EC(n, n);
+  Eigen::RowVectorXd ER(n);
+  Eigen::VectorXd    EV(n);
+#endif
+
+  // element access
+
+  run("operator()(i,j)", "var", size,
+    [&]() { double s = 0.0; for ( int i = 0 ; i < N ; ++i ) for ( int j = 0 ; j < N ; ++j ) s += A(i,j); doNotOptimize(s); },
+    {
+      {"loop" , [&]() { double s = 0.0; for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) s += a[i*n+j]; doNotOptimize(s); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { double s = 0.0; for ( Eigen::Index i = 0 ; i < EA.rows() ; ++i ) for ( Eigen::Index j = 0 ; j < EA.cols() ; ++j ) s += EA(i,j); doNotOptimize(s); }},
+#endif
+    }
+  );
+
+  run("compress(i,j)", "var", size,
+    [&]() { size_t s = 0; for ( int i = 0 ; i < N ; ++i ) for ( int j = 0 ; j < N ; ++j ) s += A.compress(i,j); doNotOptimize(s); },
+    {{"loop", [&]() { size_t s = 0; for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) s += i*n+j; doNotOptimize(s); }}}
+  );
+
+  // element-wise operations
+
+  run("C=A+B", "var", size,
+    [&]() { C = A + B; doNotOptimize(C.data()[0]); },
+    {
+      {"loop" , [&]() { for ( size_t i = 0 ; i < n*n ; ++i ) d[i] = a[i] + b[i]; doNotOptimize(d[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC = EA + EB; doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  run("C=2*A+B*B", "var", size,
+    [&]() { C = 2. * A + B * B; doNotOptimize(C.data()[0]); },
+    {
+      {"loop" , [&]() { for ( size_t i = 0 ; i < n*n ; ++i ) d[i] = 2. * a[i] + b[i] * b[i]; doNotOptimize(d[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC = 2. * EA.array() + EB.array() * EB.array(); doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  // reductions
+
+  run("sum()", "var", size,
+    [&]() { doNotOptimize(A.sum()); },
+    {
+      {"loop" , [&]() { double s = 0.0; for ( size_t i = 0 ; i < n*n ; ++i ) s += a[i]; doNotOptimize(s); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.sum()); }},
+#endif
+    }
+  );
+
+  run("max()", "var", size,
+    [&]() { doNotOptimize(A.max()); },
+    {
+      {"loop" , [&]() { double s = a[0]; for ( size_t i = 1 ; i < n*n ; ++i ) s = std::max(s, a[i]); doNotOptimize(s); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(EA.maxCoeff()); }},
+#endif
+    }
+  );
+
+  run("sum(0)", "var", size,
+    [&]() { doNotOptimize(A.sum(0).data()[0]); },
+    {
+      {"loop" , [&]() { std::fill(c.begin(), c.end(), 0.0); for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) c[j] += a[i*n+j]; doNotOptimize(c[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { ER = EA.colwise().sum(); doNotOptimize(ER(0)); }},
+#endif
+    }
+  );
+
+  run("sum(1)", "var", size,
+    [&]() { doNotOptimize(A.sum(1).data()[0]); },
+    {
+      {"loop" , [&]() { for ( size_t i = 0 ; i < n ; ++i ) { double s = 0.0; for ( size_t j = 0 ; j < n ; ++j ) s += a[i*n+j]; c[i] = s; } doNotOptimize(c[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EV = EA.rowwise().sum(); doNotOptimize(EV(0)); }},
+#endif
+    }
+  );
+
+  run("mean(1)", "var", size,
+    [&]() { doNotOptimize(A.mean(1).data()[0]); },
+    {
+      {"loop" , [&]() { for ( size_t i = 0 ; i < n ; ++i ) { double s = 0.0; for ( size_t j = 0 ; j < n ; ++j ) s += a[i*n+j]; c[i] = s / static_cast<double>(n); } doNotOptimize(c[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EV = EA.rowwise().mean(); doNotOptimize(EV(0)); }},
+#endif
+    }
+  );
+
+  // slices (strided views, copied to contiguous storage)
+
+  run("slice(0,n/4,3n/4).copy()", "view", size,
+    [&]() { doNotOptimize(A.strided().slice(0, n/4, 3*n/4).copy().data()[0]); },
+    {
+      {"loop" , [&]() { std::copy(a + (n/4)*n, a + (3*n/4)*n, d); doNotOptimize(d[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC.topRows(3*n/4-n/4) = EA.middleRows(n/4, 3*n/4-n/4); doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  run("select(1,0).copy()", "view", size,
+    [&]() { doNotOptimize(A.strided().select(1, 0).copy().data()[0]); },
+    {
+      {"loop" , [&]() { for ( size_t i = 0 ; i < n ; ++i ) c[i] = a[i*n]; doNotOptimize(c[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EV = EA.col(0); doNotOptimize(EV(0)); }},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+// benchmark: rank 3
+// =================================================================================================
+
+void bench_rank3(size_t n)
+{
+  Arr A = Arr::Random({n, n, n});
+  Arr B = Arr::Random({n, n, n});
+  Arr C = Arr::Zero  ({n, n, n});
+
+  std::vector<double> c(n*n);
+
+  const double *a = A.data();
+  const double *b = B.data();
+  double       *d = C.data();
+
+  std::string size = label(A.shape());
+
+  int N = static_cast<int>(n);
+
+  run("operator()(i,j,k)", "var", size,
+    [&]() { double s = 0.0; for ( int i = 0 ; i < N ; ++i ) for ( int j = 0 ; j < N ; ++j ) for ( int k = 0 ; k < N ; ++k ) s += A(i,j,k); doNotOptimize(s); },
+    {{"loop", [&]() { double s = 0.0; for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) for ( size_t k = 0 ; k < n ; ++k ) s += a[(i*n+j)*n+k]; doNotOptimize(s); }}}
+  );
+
+  run("compress(i,j,k)", "var", size,
+    [&]() { size_t s = 0; for ( int i = 0 ; i < N ; ++i ) for ( int j = 0 ; j < N ; ++j ) for ( int k = 0 ; k < N ; ++k ) s += A.compress(i,j,k); doNotOptimize(s); },
+    {{"loop", [&]() { size_t s = 0; for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) for ( size_t k = 0 ; k < n ; ++k ) s += (i*n+j)*n+k; doNotOptimize(s); }}}
+  );
+
+  run("C=A+B", "var", size,
+    [&]() { C = A + B; doNotOptimize(C.data()[0]); },
+    {{"loop", [&]() { for ( size_t i = 0 ; i < n*n*n ; ++i ) d[i] = a[i] + b[i]; doNotOptimize(d[0]); }}}
+  );
+
+  run("sum(0)", "var", size,
+    [&]() { doNotOptimize(A.sum(0).data()[0]); },
+    {{"loop", [&]() { std::fill(c.begin(), c.end(), 0.0); for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n*n ; ++j ) c[j] += a[i*n*n+j]; doNotOptimize(c[0]); }}}
+  );
+
+  run("sum(1)", "var", size,
+    [&]() { doNotOptimize(A.sum(1).data()[0]); },
+    {{"loop", [&]() { std::fill(c.begin(), c.end(), 0.0); for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) for ( size_t k = 0 ; k < n ; ++k ) c[i*n+k] += a[(i*n+j)*n+k]; doNotOptimize(c[0]); }}}
+  );
+
+  run("sum(2)", "var", size,
+    [&]() { doNotOptimize(A.sum(2).data()[0]); },
+    {{"loop", [&]() { for ( size_t i = 0 ; i < n*n ; ++i ) { double s = 0.0; for ( size_t k = 0 ; k < n ; ++k ) s += a[i*n+k]; c[i] = s; } doNotOptimize(c[0]); }}}
+  );
+
+  run("select(2,0).copy()", "view", size,
+    [&]() { doNotOptimize(A.strided().select(2, 0).copy().data()[0]); },
+    {{"loop", [&]() { for ( size_t i = 0 ; i < n*n ; ++i ) c[i] = a[i*n]; doNotOptimize(c[0]); }}}
+  );
+}
+
+// =================================================================================================
+// benchmark: "tiny" arrays, and "view" arrays (that map the storage of a "tiny" array)
+// =================================================================================================
+
+template<size_t n>
+void bench_tiny()
+{
+  typedef cppmat::tiny::array<double,2,n,n> T;
+  typedef cppmat::view::array<double,2,n,n> V;
+
+  T A = T::Random();
+  T B = T::Random();
+  T C;
+
+  V VA = V::Map(A.data());
+
+  double d[n*n];
+
+  const double *a = A.data();
+  const double *b = B.data();
+
+  std::string size = label({n, n});
+
+  int N = static_cast<int>(n);
+
+  run("operator()(i,j)", "tiny", size,
+    [&]() { double s = 0.0; for ( int i = 0 ; i < N ; ++i ) for ( int j = 0 ; j < N ; ++j ) s += A(i,j); doNotOptimize(s); },
+    {{"loop", [&]() { double s = 0.0; for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) s += a[i*n+j]; doNotOptimize(s); }}}
+  );
+
+  run("operator()(i,j)", "view", size,
+    [&]() { double s = 0.0; for ( int i = 0 ; i < N ; ++i ) for ( int j = 0 ; j < N ; ++j ) s += VA(i,j); doNotOptimize(s); },
+    {{"loop", [&]() { double s = 0.0; for ( size_t i = 0 ; i < n ; ++i ) for ( size_t j = 0 ; j < n ; ++j ) s += a[i*n+j]; doNotOptimize(s); }}}
+  );
+
+  run("C=A+B", "tiny", size,
+    [&]() { C = A + B; doNotOptimize(C.data()[0]); },
+    {{"loop", [&]() { for ( size_t i = 0 ; i < n*n ; ++i ) d[i] = a[i] + b[i]; doNotOptimize(d[0]); }}}
+  );
+
+  run("sum()", "tiny", size,
+    [&]() { doNotOptimize(A.sum()); },
+    {{"loop", [&]() { double s = 0.0; for ( size_t i = 0 ; i < n*n ; ++i ) s += a[i]; doNotOptimize(s); }}}
+  );
+
+  run("sum()", "view", size,
+    [&]() { doNotOptimize(VA.sum()); },
+    {{"loop", [&]() { double s = 0.0; for ( size_t i = 0 ; i < n*n ; ++i ) s += a[i]; doNotOptimize(s); }}}
+  );
+}
+
+// =================================================================================================
+
+int main(int argc, char **argv)
+{
+  init(argc, argv);
+
+  bench_tiny<3>();
+  bench_tiny<8>();
+
+  for ( size_t n : {32, 316, 1000} )
+    bench_rank2(n);
+
+  for ( size_t n : {10, 46, 100} )
+    bench_rank3(n);
+
+  return finish();
+}
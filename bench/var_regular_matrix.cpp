@@ -0,0 +1,146 @@
+
+#include "support.h"
+
+typedef cppmat::matrix<double> Mat;
+typedef cppmat::vector<double> Vec;
+
+// =================================================================================================
+// reference: plain loops on the (row-major) storage
+// =================================================================================================
+
+void matmul_ref(const double *A, const double *B, double *C, size_t m, size_t n, size_t k)
+{
+  std::fill(C, C+m*n, 0.0);
+
+  for ( size_t i = 0 ; i < m ; ++i )
+    for ( size_t p = 0 ; p < k ; ++p )
+      for ( size_t j = 0 ; j < n ; ++j )
+        C[i*n+j] += A[i*k+p] * B[p*n+j];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void matvec_ref(const double *A, const double *b, double *c, size_t m, size_t n)
+{
+  for ( size_t i = 0 ; i < m ; ++i ) {
+    double s = 0.0;
+    for ( size_t j = 0 ; j < n ; ++j )
+      s += A[i*n+j] * b[j];
+    c[i] = s;
+  }
+}
+
+// =================================================================================================
+// benchmark: "var" matrices
+// =================================================================================================
+
+void bench_var(size_t n)
+{
+  Mat A = Mat::Random(n, n);
+  Mat B = Mat::Random(n, n);
+  Vec b = Vec::Random(n);
+
+  std::vector<double> C(n*n);
+
+  std::string size = label(A.shape());
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> M;
+
+  M EA = Eigen::Map<const M>(A.data(), n, n);
+  M EB = Eigen::Map<const M>(B.data(), n, n);
+  M EC(n, n);
+  Eigen::VectorXd Eb = Eigen::Map<const Eigen::VectorXd>(b.data(), n);
+  Eigen::VectorXd Ec(n);
+#endif
+
+  // the plain loop is too slow to be timed for large matrices
+  std::vector<std::pair<std::string,std::function<void()>>> baseline;
+
+  if ( n <= 256 )
+    baseline.push_back({"loop", [&]() { matmul_ref(A.data(), B.data(), C.data(), n, n, n); doNotOptimize(C[0]); }});
+
+#ifdef CPPMAT_BENCH_EIGEN
+  baseline.push_back({"eigen", [&]() { EC.noalias() = EA * EB; doNotOptimize(EC(0,0)); }});
+#endif
+
+  run("matmul(matrix,matrix)", "var", size,
+    [&]() { doNotOptimize(A.dot(B).data()[0]); },
+    baseline
+  );
+
+  run("matvec(matrix,vector)", "var", size,
+    [&]() { doNotOptimize(A.dot(b).data()[0]); },
+    {
+      {"loop" , [&]() { matvec_ref(A.data(), b.data(), C.data(), n, n); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ec.noalias() = EA * Eb; doNotOptimize(Ec(0)); }},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+// benchmark: "tiny" matrices
+// =================================================================================================
+
+template<size_t n>
+void bench_tiny()
+{
+  typedef cppmat::tiny::matrix<double,n,n> T;
+  typedef cppmat::tiny::vector<double,n>   V;
+
+  T A = T::Random();
+  T B = T::Random();
+  V b = V::Random();
+
+  double C[n*n];
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,n,n,Eigen::RowMajor> M;
+
+  M EA = Eigen::Map<const M>(A.data());
+  M EB = Eigen::Map<const M>(B.data());
+  M EC;
+  Eigen::Matrix<double,n,1> Eb = Eigen::Map<const Eigen::Matrix<double,n,1>>(b.data());
+  Eigen::Matrix<double,n,1> Ec;
+#endif
+
+  std::string size = label(A.shape());
+
+  run("matmul(matrix,matrix)", "tiny", size,
+    [&]() { doNotOptimize(A.dot(B).data()[0]); },
+    {
+      {"loop" , [&]() { matmul_ref(A.data(), B.data(), C, n, n, n); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC.noalias() = EA * EB; doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  run("matvec(matrix,vector)", "tiny", size,
+    [&]() { doNotOptimize(A.dot(b).data()[0]); },
+    {
+      {"loop" , [&]() { matvec_ref(A.data(), b.data(), C, n, n); doNotOptimize(C[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ec.noalias() = EA * Eb; doNotOptimize(Ec(0)); }},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+
+int main(int argc, char **argv)
+{
+  init(argc, argv);
+
+  bench_tiny<3>();
+  bench_tiny<6>();
+  bench_tiny<9>();
+
+  for ( size_t n : {9, 64, 256, 1024, 2048} )
+    bench_var(n);
+
+  return finish();
+}
@@ -0,0 +1,210 @@
+
+#include "support.h"
+
+typedef cppmat::symmetric::matrix<double> sMat;
+typedef cppmat::matrix<double>            Mat;
+typedef cppmat::vector<double>            Vec;
+
+// =================================================================================================
+// benchmark: packed storage, compared to the same (dense) products on the unpacked matrix
+// =================================================================================================
+
+void bench_var(size_t n)
+{
+  sMat A = sMat::Random(n, n);
+  Mat  B = Mat ::Random(n, n);
+  Vec  b = Vec ::Random(n);
+
+  // unpacked copy
+  Mat D(n, n);
+
+  A.copyToDense(D.begin());
+
+  std::string size = label(A.shape());
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> M;
+
+  M ED = Eigen::Map<const M>(D.data(), n, n);
+  M EB = Eigen::Map<const M>(B.data(), n, n);
+  M EC(n, n);
+  Eigen::VectorXd Eb = Eigen::Map<const Eigen::VectorXd>(b.data(), n);
+  Eigen::VectorXd Ec(n);
+#endif
+
+  run("matvec(symmetric,vector)", "var", size,
+    [&]() { doNotOptimize(A.dot(b).data()[0]); },
+    {
+      {"dense", [&]() { doNotOptimize(D.dot(b).data()[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ec.noalias() = ED.selfadjointView<Eigen::Upper>() * Eb; doNotOptimize(Ec(0)); }},
+#endif
+    }
+  );
+
+  run("quadratic(symmetric,vector)", "var", size,
+    [&]() { doNotOptimize(A.quadratic(b)); },
+    {
+      {"dense", [&]() { doNotOptimize(D.dot(b).data()[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { doNotOptimize(Eb.dot(ED.selfadjointView<Eigen::Upper>() * Eb)); }},
+#endif
+    }
+  );
+
+  run("matmul(symmetric,matrix)", "var", size,
+    [&]() { doNotOptimize(A.dot(B).data()[0]); },
+    {
+      {"dense", [&]() { doNotOptimize(D.dot(B).data()[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC.noalias() = ED.selfadjointView<Eigen::Upper>() * EB; doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+
+  // rank-k update with "k = n / 4"
+  size_t k = std::max(size_t(1), n / 4);
+
+  Mat  K = Mat::Random(n, k);
+  Mat  T(k, n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    for ( size_t j = 0 ; j < k ; ++j )
+      T(j,i) = K(i,j);
+
+  run("rankUpdate(symmetric,matrix)", "var", size,
+    [&]() { A.rankUpdate(K, 1., 0.); doNotOptimize(A[0]); },
+    {
+      {"dense", [&]() { doNotOptimize(K.dot(T).data()[0]); }},
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() {
+        EC.setZero();
+        EC.selfadjointView<Eigen::Upper>().rankUpdate(Eigen::Map<const M>(K.data(), n, k));
+        doNotOptimize(EC(0,0));
+      }},
+#endif
+    }
+  );
+
+  // factorization and solve of a symmetric positive definite matrix
+  sMat S = sMat::Zero(n, n);
+
+  S.rankUpdate(K, 1., 0.);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    S(i,i) += static_cast<double>(n);
+
+  S.copyToDense(D.begin());
+
+  cppmat::symmetric::cholesky<double> llt(S);
+  cppmat::symmetric::ldlt<double>     ldlt(S);
+
+#ifdef CPPMAT_BENCH_EIGEN
+  ED = Eigen::Map<const M>(D.data(), n, n);
+
+  Eigen::LLT <M> Ellt (ED);
+  Eigen::LDLT<M> Eldlt(ED);
+#endif
+
+  run("cholesky(symmetric)", "var", size,
+    [&]() { llt.compute(S); doNotOptimize(llt.factor()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ellt.compute(ED); doNotOptimize(Ellt.matrixLLT()(0,0)); }},
+#endif
+    }
+  );
+
+  run("ldlt(symmetric)", "var", size,
+    [&]() { ldlt.compute(S); doNotOptimize(ldlt.factor()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Eldlt.compute(ED); doNotOptimize(Eldlt.vectorD()(0)); }},
+#endif
+    }
+  );
+
+  run("cholesky.solve(vector)", "var", size,
+    [&]() { doNotOptimize(llt.solve(b).data()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ec = Ellt.solve(Eb); doNotOptimize(Ec(0)); }},
+#endif
+    }
+  );
+
+  run("cholesky.solve(matrix)", "var", size,
+    [&]() { doNotOptimize(llt.solve(B).data()[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { EC = Ellt.solve(EB); doNotOptimize(EC(0,0)); }},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+// benchmark: "tiny" factorization and solve (e.g. the tangent of a return-mapping)
+// =================================================================================================
+
+template<size_t n>
+void bench_tiny()
+{
+  typedef cppmat::tiny::symmetric::matrix<double,n,n> sT;
+  typedef cppmat::tiny::vector<double,n>              V;
+
+  sT S = sT::Random();
+  V  b = V ::Random();
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    S(i,i) += static_cast<double>(n);
+
+  std::string size = label(S.shape());
+
+#ifdef CPPMAT_BENCH_EIGEN
+  typedef Eigen::Matrix<double,n,n,Eigen::RowMajor> M;
+
+  M ED;
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    for ( size_t j = 0 ; j < n ; ++j )
+      ED(i,j) = S(i,j);
+
+  Eigen::Matrix<double,n,1> Eb = Eigen::Map<const Eigen::Matrix<double,n,1>>(b.data());
+  Eigen::Matrix<double,n,1> Ec;
+#endif
+
+  run("cholesky(symmetric).solve(vector)", "tiny", size,
+    [&]() { doNotOptimize(cppmat::tiny::symmetric::cholesky<double,n>(S).solve(b)[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ec = ED.llt().solve(Eb); doNotOptimize(Ec(0)); }},
+#endif
+    }
+  );
+
+  run("ldlt(symmetric).solve(vector)", "tiny", size,
+    [&]() { doNotOptimize(cppmat::tiny::symmetric::ldlt<double,n>(S).solve(b)[0]); },
+    {
+#ifdef CPPMAT_BENCH_EIGEN
+      {"eigen", [&]() { Ec = ED.ldlt().solve(Eb); doNotOptimize(Ec(0)); }},
+#endif
+    }
+  );
+}
+
+// =================================================================================================
+
+int main(int argc, char **argv)
+{
+  init(argc, argv);
+
+  bench_tiny<2>();
+  bench_tiny<3>();
+  bench_tiny<6>();
+
+  for ( size_t n : {64, 256, 1024, 2048} )
+    bench_var(n);
+
+  return finish();
+}
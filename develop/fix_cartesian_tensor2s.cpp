@@ -181,6 +181,123 @@ SECTION( "T" )
       EQ( B(i,j), A(j,i) );
 }
 
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+SECTION("T2s.eig(), T2s.eigenvalues()")
+{
+  std::vector<MatD> cases;
+
+  for ( size_t i = 0 ; i < 20 ; ++i )
+    cases.push_back(makeSymmetric(MatD::Random(ND,ND)));
+
+  cases.push_back(MatD::Zero(ND,ND));
+  cases.push_back(MatD::Identity(ND,ND));
+  cases.push_back(1.e-200 * makeSymmetric(MatD::Random(ND,ND)));
+  cases.push_back(makeSymmetricWithEigenvalues(ColD::LinSpaced(ND, 1., 3.), false));
+
+  for ( auto &a : cases )
+  {
+    T2s A = T2s::CopyDense(a.data(), a.data()+a.size());
+    V   val;
+    T2  vec;
+
+    A.eig(val, vec);
+
+    // N.B. the scaled case is compared after scaling back
+    double s = std::max(a.cwiseAbs().maxCoeff(), 1.e-300);
+
+    MatD v = Eigen::Map<const MatD>(vec.data(), ND, ND);
+    ColD l = Eigen::Map<const ColD>(val.data(), ND) / s;
+
+    EqualEig(MatD(a / s), l.data(), v.data());
+
+    V L = A.eigenvalues();
+
+    for ( size_t i = 0 ; i < ND ; ++i )
+      EQ( L[i] / s, val[i] / s );
+  }
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+SECTION("log(T2s), exp(T2s), sqrt(T2s), pow(T2s) -- with derivative")
+{
+  typedef cppmat::view::cartesian::tensor2s<double,ND> T2sView;
+
+  auto fLog  = [](double x) { return std::log(x); };
+  auto fExp  = [](double x) { return std::exp(x); };
+  auto fSqrt = [](double x) { return std::sqrt(x); };
+  auto fPow  = [](double x) { return std::pow(x, -1.5); };
+
+  // positive definite, also with (almost) repeated eigenvalues
+  std::vector<MatD> cases;
+
+  for ( size_t i = 0 ; i < 5 ; ++i ) {
+    MatD m = MatD::Random(ND,ND) / std::sqrt(static_cast<double>(ND));
+    cases.push_back(m * m.transpose() + MatD::Identity(ND,ND));
+  }
+
+  ColD l = ColD::LinSpaced(ND, 1., 3.);
+
+  cases.push_back(MatD::Identity(ND,ND));
+  cases.push_back(makeSymmetricWithEigenvalues(ColD::Constant(ND, 2.)));
+  l(1) = l(0);
+  cases.push_back(makeSymmetricWithEigenvalues(l));
+  l(1) = l(0) + 1.e-9;
+  cases.push_back(makeSymmetricWithEigenvalues(l));
+
+  for ( auto &a : cases )
+  {
+    a = makeSymmetric(a);
+
+    T2s A = T2s::CopyDense(a.data(), a.data()+a.size());
+    T4  dF;
+
+    EqualSymmetric(cppmat::cartesian::log(A, dF), isotropicFunction(a, fLog));
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::log(x); });
+
+    EqualSymmetric(cppmat::cartesian::sqrt(A, dF), isotropicFunction(a, fSqrt));
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::sqrt(x); });
+
+    EqualSymmetric(cppmat::cartesian::pow(A, -1.5, dF), isotropicFunction(a, fPow));
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::pow(x, -1.5); });
+
+    // (also not positive definite)
+    MatD b = a - 2. * MatD::Identity(ND,ND);
+    T2s  B = T2s::CopyDense(b.data(), b.data()+b.size());
+
+    EqualSymmetric(cppmat::cartesian::exp(B, dF), isotropicFunction(b, fExp));
+    EqualDerivative(B, dF.data(), [](const T2s &x) { return cppmat::cartesian::exp(x); });
+
+    // members, and a view
+    EqualSymmetric(A.log (), isotropicFunction(a, fLog ));
+    EqualSymmetric(A.exp (), isotropicFunction(a, fExp ));
+    EqualSymmetric(A.sqrt(), isotropicFunction(a, fSqrt));
+    EqualSymmetric(A.pow (2.), MatD(a * a));
+
+    T2sView C = T2sView::Map(A.data());
+
+    EqualSymmetric(cppmat::cartesian::log(C), isotropicFunction(a, fLog));
+    EqualSymmetric(cppmat::cartesian::pow(C, -1., dF), MatD(a.inverse()));
+  }
+
+  // outside the domain
+  T2s Z = T2s::Zero();
+  T2s N = T2s::I();
+
+  N *= -1.;
+
+  REQUIRE_THROWS_AS(cppmat::cartesian::log(Z), std::domain_error);
+  REQUIRE_THROWS_AS(cppmat::cartesian::pow(Z, .5), std::domain_error);
+  REQUIRE_THROWS_AS(cppmat::cartesian::sqrt(N), std::domain_error);
+
+  EqualSymmetric(cppmat::cartesian::sqrt(Z), MatD::Zero(ND,ND));
+}
+
 // =================================================================================================
 
 }
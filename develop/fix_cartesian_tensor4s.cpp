@@ -0,0 +1,113 @@
+
+#include "support.h"
+
+static const size_t ND = 3;
+
+typedef cppmat::tiny::cartesian::tensor4 <double,ND> T4;
+typedef cppmat::tiny::cartesian::tensor4s<double,ND> T4s;
+typedef cppmat::tiny::cartesian::tensor2 <double,ND> T2;
+typedef cppmat::tiny::cartesian::tensor2s<double,ND> T2s;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::tiny::cartesian::tensor4s", "fix_cartesian_tensor4s.h")
+{
+
+// =================================================================================================
+// storage
+// =================================================================================================
+
+SECTION( "size, T4s(T4), T4(T4s), var, view" )
+{
+  T4s A = T4s::Random();
+
+  REQUIRE( A.ndim() == ND );
+  REQUIRE( A.size() == 21 );
+
+  T4  B(A);
+  T4s C(B);
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    EQ( C[i], A[i] );
+
+  cppmat::cartesian::tensor4s<double> D = A;
+  cppmat::view::cartesian::tensor4s<double,ND> E = cppmat::view::cartesian::tensor4s<double,ND>::Map(A.data());
+  T4s F = D;
+  T4s G = E;
+
+  REQUIRE( D.ndim() == ND );
+  REQUIRE( E.ndim() == ND );
+
+  for ( size_t i = 0 ; i < A.size() ; ++i ) {
+    EQ( F[i], A[i] );
+    EQ( G[i], A[i] );
+  }
+}
+
+// =================================================================================================
+// unit tensors
+// =================================================================================================
+
+SECTION( "Is, Isd, II" )
+{
+  T4 A(T4s::Is ());
+  T4 B(T4s::Isd());
+  T4 C(T4s::II ());
+
+  T4 D = T4::Is ();
+  T4 E = T4::Isd();
+  T4 F = T4::II ();
+
+  for ( size_t i = 0 ; i < A.size() ; ++i ) {
+    EQ( A[i], D[i] );
+    EQ( B[i], E[i] );
+    EQ( C[i], F[i] );
+  }
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+SECTION( "T4s.ddot(T2s), T2s.ddot(T4s)" )
+{
+  T4s A = T4s::Random();
+  T2s B = T2s::Random();
+
+  T2s C = A.ddot(B);
+  T2s D = B.ddot(A);
+  T2  E = T4(A).ddot(B);
+
+  for ( size_t i = 0 ; i < ND ; ++i ) {
+    for ( size_t j = 0 ; j < ND ; ++j ) {
+      EQ( C(i,j), E(i,j) );
+      EQ( D(i,j), E(i,j) );
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "T4s.ddot(T2s) - 2-D" )
+{
+  typedef cppmat::tiny::cartesian::tensor4 <double,2> T4_2;
+  typedef cppmat::tiny::cartesian::tensor4s<double,2> T4s_2;
+  typedef cppmat::tiny::cartesian::tensor2 <double,2> T2_2;
+  typedef cppmat::tiny::cartesian::tensor2s<double,2> T2s_2;
+
+  T4s_2 A = T4s_2::Random();
+  T2s_2 B = T2s_2::Random();
+
+  T2s_2 C = A.ddot(B);
+  T2_2  E = T4_2(A).ddot(B);
+
+  REQUIRE( A.size() == 6 );
+
+  for ( size_t i = 0 ; i < 2 ; ++i )
+    for ( size_t j = 0 ; j < 2 ; ++j )
+      EQ( C(i,j), E(i,j) );
+}
+
+// =================================================================================================
+
+}
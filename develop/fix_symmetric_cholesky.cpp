@@ -0,0 +1,74 @@
+
+#include "support.h"
+
+// =================================================================================================
+
+// symmetric positive definite, and symmetric indefinite (that can be factorized without pivoting)
+template<size_t N>
+void check()
+{
+  typedef cppmat::tiny::symmetric::matrix<double,N,N> sMat;
+  typedef cppmat::tiny::matrix<double,N,4>            Mat;
+  typedef cppmat::tiny::vector<double,N>              Vec;
+
+  MatD r = MatD::Random(N,N);
+  MatD a = makeSymmetric(r * r.transpose()) + static_cast<double>(N) * MatD::Identity(N,N);
+  MatD q = makeSymmetric(MatD::Random(N,N));
+  MatD b = MatD::Random(N,1);
+  MatD B = MatD::Random(N,4);
+
+  for ( size_t i = 0 ; i < N ; ++i )
+    q(i,i) = ( i % 2 == 0 ? 1. : -1. ) * static_cast<double>(N);
+
+  sMat A = sMat::CopyDense(a.data(), a.data()+a.size());
+  sMat Q = sMat::CopyDense(q.data(), q.data()+q.size());
+  Vec  x = Vec ::Copy(b.data(), b.data()+b.size());
+  Mat  X = Mat ::Copy(B.data(), B.data()+B.size());
+
+  // Cholesky
+  cppmat::tiny::symmetric::cholesky<double,N> llt(A);
+
+  Equal(cppmat::vector<double>(llt.solve(x)), MatD(a.llt().solve(b)));
+  Equal(cppmat::matrix<double>(llt.solve(X)), MatD(a.llt().solve(B)));
+
+  REQUIRE_THAT( llt.determinant(), Catch::WithinRel(a.determinant(), 1.e-8) );
+
+  // Cholesky: from view
+  cppmat::view::symmetric::matrix<double,N,N> VA = cppmat::view::symmetric::matrix<double,N,N>::Map(A.data());
+
+  cppmat::tiny::symmetric::cholesky<double,N> vllt(VA);
+
+  Equal(cppmat::vector<double>(vllt.solve(x)), MatD(a.llt().solve(b)));
+
+  // Cholesky: not positive definite
+  typedef cppmat::tiny::symmetric::cholesky<double,N> LLT;
+
+  REQUIRE_THROWS_AS( LLT(Q), std::domain_error );
+
+  // LDLT
+  cppmat::tiny::symmetric::ldlt<double,N> ldlt(Q);
+
+  Equal(cppmat::vector<double>(ldlt.solve(x)), MatD(q.lu().solve(b)));
+  Equal(cppmat::matrix<double>(ldlt.solve(X)), MatD(q.lu().solve(B)));
+
+  REQUIRE_THAT( ldlt.determinant(), Catch::WithinRel(q.determinant(), 1.e-8) );
+
+  ldlt.solveInPlace(x);
+  Equal(cppmat::vector<double>(x), MatD(q.lu().solve(b)));
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::tiny::symmetric::cholesky", "fix_symmetric_cholesky.h")
+{
+
+// =================================================================================================
+
+SECTION( "cholesky, ldlt: N = 2" ) { check<2>(); }
+SECTION( "cholesky, ldlt: N = 3" ) { check<3>(); }
+SECTION( "cholesky, ldlt: N = 6" ) { check<6>(); }
+SECTION( "cholesky, ldlt: N = 20") { check<20>(); }
+
+// =================================================================================================
+
+}
@@ -529,6 +529,53 @@ SECTION( "abs" )
   Equal(C, c);
 }
 
+// =================================================================================================
+// products
+// =================================================================================================
+
+SECTION( "matrix.dot(...), matrix.quadratic(vector), matrix.rankUpdate(...)" )
+{
+  MatD a = makeSymmetric(MatD::Random(M,N));
+  MatD b = MatD::Random(N,4);
+  MatD c = MatD::Random(N,4);
+  MatD x = MatD::Random(N,1);
+
+  sMat A = sMat::CopyDense(a.data(), a.data()+a.size());
+
+  cppmat::tiny::matrix<double,N,4> B = cppmat::tiny::matrix<double,N,4>::Copy(b.data(), b.data()+b.size());
+  cppmat::tiny::matrix<double,N,4> C = cppmat::tiny::matrix<double,N,4>::Copy(c.data(), c.data()+c.size());
+  cppmat::tiny::vector<double,N>   X = cppmat::tiny::vector<double,N>  ::Copy(x.data(), x.data()+x.size());
+
+  Equal(cppmat::matrix<double>(A.dot(B)), MatD(a * b));
+  Equal(cppmat::matrix<double>(cppmat::tiny::symmetric::matmul(A, B)), MatD(a * b));
+  Equal(cppmat::vector<double>(A.dot(X)), MatD(a * x));
+  Equal(cppmat::vector<double>(cppmat::tiny::symmetric::matvec(A, X)), MatD(a * x));
+
+  EQ( A.quadratic(X), ( x.transpose() * a * x )(0,0) );
+
+  // view
+  cppmat::view::symmetric::matrix<double,M,N> VA = cppmat::view::symmetric::matrix<double,M,N>::Map(A.data());
+  cppmat::view::matrix<double,N,4>            VB = cppmat::view::matrix<double,N,4>::Map(B.data());
+  cppmat::view::vector<double,N>              VX = cppmat::view::vector<double,N>::Map(X.data());
+
+  Equal(cppmat::matrix<double>(VA.dot(VB)), MatD(a * b));
+  Equal(cppmat::vector<double>(VA.dot(VX)), MatD(a * x));
+
+  EQ( VA.quadratic(VX), ( x.transpose() * a * x )(0,0) );
+
+  // rank updates
+  A.rankUpdate(X, 2.);
+  Equal(cppmat::symmetric::matrix<double>(A), MatD(a + 2. * x * x.transpose()));
+
+  A = sMat::CopyDense(a.data(), a.data()+a.size());
+  A.rankUpdate(B, 2., .5);
+  Equal(cppmat::symmetric::matrix<double>(A), MatD(2. * b * b.transpose() + .5 * a));
+
+  A = sMat::CopyDense(a.data(), a.data()+a.size());
+  A.rankUpdate(B, C);
+  Equal(cppmat::symmetric::matrix<double>(A), MatD(b * c.transpose() + c * b.transpose() + a));
+}
+
 // =================================================================================================
 // index operators
 // =================================================================================================
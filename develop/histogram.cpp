@@ -0,0 +1,385 @@
+
+#include "support.h"
+
+typedef cppmat::histogram_accumulator Hist;
+typedef cppmat::array<double> Arr;
+
+// =================================================================================================
+
+// reference: the direct (three-pass) implementation of "cppmat::histogram"
+inline std::tuple<std::vector<double>, std::vector<double>> histogram_reference(
+  const std::vector<double> &data, size_t bins, bool density, bool return_edges)
+{
+  double Bins = static_cast<double>(bins);
+  double N    = static_cast<double>(data.size());
+  double min  = *std::min_element(data.begin(),data.end());
+  double max  = *std::max_element(data.begin(),data.end());
+  double h    = (max - min) / Bins;
+
+  std::vector<size_t> count(bins, 0);
+
+  for ( auto &i : data )
+    count[std::min(static_cast<size_t>((i-min)/h),bins-1)]++;
+
+  std::vector<double> countD(count.begin(), count.end());
+
+  if ( density )
+    for ( auto &i : countD )
+      i /= ( h * N );
+
+  if ( return_edges ) return std::make_tuple(countD, cppmat::linspace(min     , max     , bins+1));
+  else                return std::make_tuple(countD, cppmat::linspace(min+h/2., max-h/2., bins  ));
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::histogram", "histogram.h")
+{
+
+// =================================================================================================
+
+SECTION( "histogram: equal to the direct implementation" )
+{
+  cppmat::random::engine rng(1);
+
+  std::vector<double> data(10000);
+
+  rng.fillNormal(data.begin(), data.end(), 1., 2.);
+
+  for ( bool density : {false, true} )
+  {
+    for ( bool return_edges : {false, true} )
+    {
+      std::vector<double> P, x, Q, y;
+
+      std::tie(P, x) = cppmat::histogram  (data, 17, density, return_edges);
+      std::tie(Q, y) = histogram_reference(data, 17, density, return_edges);
+
+      REQUIRE( P == Q );
+      REQUIRE( x == y );
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram: parallel binning equal to the direct implementation, also at the bin-edges" )
+{
+  cppmat::parallel::setThreshold(1000);
+
+  // integers: many entries exactly on a bin-edge (where rounding matters)
+  std::vector<double> data(100000);
+
+  for ( size_t i = 0 ; i < data.size() ; ++i )
+    data[i] = static_cast<double>( (i * 7919) % 1001 ) * 0.1;
+
+  for ( size_t bins : {7, 10, 13, 100, 1000} )
+  {
+    std::vector<double> P, x, Q, y;
+
+    std::tie(P, x) = cppmat::histogram  (data, bins, true, true);
+    std::tie(Q, y) = histogram_reference(data, bins, true, true);
+
+    REQUIRE( P == Q );
+    REQUIRE( x == y );
+  }
+
+  // contiguous storage, e.g. of an array
+  Arr A = Arr::Random({100,100}, -1., 1.);
+
+  std::vector<double> a(A.begin(), A.end());
+
+  std::vector<double> P, x, Q, y;
+
+  std::tie(P, x) = cppmat::histogram  (A.data(), A.size(), 20);
+  std::tie(Q, y) = histogram_reference(a, 20, false, false);
+
+  REQUIRE( P == Q );
+  REQUIRE( x == y );
+
+  cppmat::parallel::setThreshold();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram: weights" )
+{
+  cppmat::parallel::setThreshold(1000);
+
+  cppmat::random::engine rng(4);
+
+  size_t n = 100000;
+
+  std::vector<double> data(n), weights(n), ones(n, 1.);
+
+  rng.fillUniform(data   .begin(), data   .end(), 0., 1.);
+  rng.fillUniform(weights.begin(), weights.end(), 0., 2.);
+
+  // unit weights: equal to the count
+  std::vector<double> P, x, Q, y;
+
+  std::tie(P, x) = cppmat::histogram(data,       10, true);
+  std::tie(Q, y) = cppmat::histogram(data, ones, 10, true);
+
+  REQUIRE( P == Q );
+  REQUIRE( x == y );
+
+  // sum of the weights per bin
+  std::tie(P, x) = cppmat::histogram(data, weights, 10, false, true);
+
+  std::vector<double> S(10, 0.0);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    S[std::min(static_cast<size_t>((data[i]-x[0])/(x[1]-x[0])), size_t(9))] += weights[i];
+
+  for ( size_t j = 0 ; j < 10 ; ++j )
+    EQ( P[j] / S[j], 1. );
+
+  // independent of the number of threads
+  cppmat::parallel::setNumThreads(1);
+
+  std::tie(Q, y) = cppmat::histogram(data, weights, 10, false, true);
+
+  REQUIRE( P == Q );
+
+  cppmat::parallel::setNumThreads();
+
+  // accumulator: weighted and unweighted data, adaptive range
+  Hist a(8);
+
+  a.push(data.data(), n/2);
+  a.push(data.data() + n/2, weights.data() + n/2, n - n/2);
+
+  REQUIRE( a.size() == n );
+
+  std::vector<double> edges = a.edges();
+  std::vector<double> w     = a.weight();
+
+  for ( size_t j = 0 ; j < a.bins() ; ++j )
+  {
+    double s = 0.0;
+
+    for ( size_t i = 0 ; i < n ; ++i )
+      if ( data[i] >= edges[j] and data[i] < edges[j+1] )
+        s += ( i < n/2 ) ? 1. : weights[i];
+
+    EQ( w[j], s );
+  }
+
+  cppmat::parallel::setThreshold();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram_accumulator: fixed range, pushed in chunks and merged" )
+{
+  cppmat::random::engine rng(2);
+
+  std::vector<double> data(10000);
+
+  rng.fillUniform(data.begin(), data.end(), -1., 3.);
+
+  double min = *std::min_element(data.begin(), data.end());
+  double max = *std::max_element(data.begin(), data.end());
+
+  // push in chunks, in two accumulators that are merged
+  Hist a(20, min, max);
+  Hist b(20, min, max);
+
+  a.push(data.begin()       , data.begin() + 3000);
+  b.push(data.begin() + 3000, data.begin() + 7000);
+
+  for ( size_t i = 7000 ; i < data.size() ; ++i )
+    a.push(data[i]);
+
+  a.merge(b);
+
+  REQUIRE( a.size() == data.size() );
+  REQUIRE( a.min()  == min );
+  REQUIRE( a.max()  == max );
+
+  for ( bool density : {false, true} )
+  {
+    for ( bool return_edges : {false, true} )
+    {
+      std::vector<double> P, x, Q, y;
+
+      std::tie(P, x) = a.get(density, return_edges);
+      std::tie(Q, y) = cppmat::histogram(data, 20, density, return_edges);
+
+      REQUIRE( P == Q );
+      REQUIRE( x == y );
+    }
+  }
+
+  // data outside the range is only counted
+  Hist c(4, 0., 1.);
+
+  c.push(std::vector<double>({-1., 0., 0.3, 0.5, 1., 2., 3.}));
+
+  REQUIRE( c.count()     == std::vector<size_t>({1, 1, 1, 1}) );
+  REQUIRE( c.size()      == 4 );
+  REQUIRE( c.underflow() == 1 );
+  REQUIRE( c.overflow()  == 2 );
+  REQUIRE( c.min()       == -1. );
+  REQUIRE( c.max()       ==  3. );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram_accumulator: adaptive range, independent of how the data is split" )
+{
+  cppmat::random::engine rng(3);
+
+  std::vector<double> data(10000);
+
+  rng.fillNormal(data.begin(), data.end(), 10., 3.);
+
+  // all data at once
+  Hist a(16);
+
+  a.push(data);
+
+  // one-by-one, starting with a narrow range
+  Hist b(16);
+
+  for ( auto &i : data )
+    b.push(i);
+
+  // chunks in reverse order, merged
+  Hist c(16);
+
+  for ( size_t i = 0 ; i < 10 ; ++i ) {
+    Hist d(16);
+    d.push(data.end() - (i+1)*1000, data.end() - i*1000);
+    c.merge(d);
+  }
+
+  REQUIRE( a.size()    == data.size() );
+  REQUIRE( a.count()   == b.count() );
+  REQUIRE( a.count()   == c.count() );
+  REQUIRE( a.edges()   == b.edges() );
+  REQUIRE( a.edges()   == c.edges() );
+  REQUIRE( a.density() == c.density() );
+
+  // the count equals a direct count using the edges
+  std::vector<double> edges = a.edges();
+  std::vector<size_t> count = a.count();
+
+  REQUIRE( edges.front() <= a.min() );
+  REQUIRE( edges.back()  >  a.max() );
+
+  for ( size_t j = 0 ; j < a.bins() ; ++j )
+  {
+    size_t n = 0;
+
+    for ( auto &i : data )
+      if ( i >= edges[j] and i < edges[j+1] )
+        ++n;
+
+    REQUIRE( count[j] == n );
+  }
+
+  // the bins are the finest possible: the data does not fit in bins of half the width
+  double h = edges[1] - edges[0];
+
+  REQUIRE( std::floor(a.max()/(h/2.)) - std::floor(a.min()/(h/2.)) > static_cast<double>(a.bins()-1) );
+
+  // the density integrates to one
+  double sum = 0.0;
+
+  for ( auto &i : a.density() )
+    sum += i * h;
+
+  EQ( sum, 1. );
+
+  // integer data is supported
+  Hist e(4);
+
+  e.push(std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}));
+
+  REQUIRE( e.count() == std::vector<size_t>({2, 2, 2, 2}) );
+  REQUIRE( e.edges() == std::vector<double>({0., 2., 4., 6., 8.}) );
+  REQUIRE( e.mid()   == std::vector<double>({1., 3., 5., 7.}) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "quantile_sketch: accuracy, bounded memory, merge" )
+{
+  cppmat::random::engine rng(5);
+
+  size_t n = 1000000;
+
+  std::vector<double> data(n);
+
+  rng.fillNormal(data.begin(), data.end(), 0., 1.);
+
+  // all data, and two halves that are merged
+  cppmat::quantile_sketch a(0.01);
+  cppmat::quantile_sketch b(0.01, 1);
+  cppmat::quantile_sketch c(0.01, 2);
+
+  a.push(data);
+  b.push(data.data()      , n/2);
+  c.push(data.data() + n/2, n/2);
+
+  b.merge(c);
+
+  REQUIRE( a.size() == n );
+  REQUIRE( b.size() == n );
+  REQUIRE( a.stored() < 4 * a.k() );
+  REQUIRE( b.stored() < 4 * b.k() );
+
+  // exact quantiles
+  std::vector<double> sorted = data;
+
+  std::sort(sorted.begin(), sorted.end());
+
+  REQUIRE( a.min() == sorted.front() );
+  REQUIRE( a.max() == sorted.back () );
+  REQUIRE( a.quantile(0.) == sorted.front() );
+  REQUIRE( a.quantile(1.) == sorted.back () );
+
+  // error in the rank
+  for ( auto &sketch : {a, b} )
+  {
+    for ( double q : {0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99} )
+    {
+      double x = sketch.quantile(q);
+      double r = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), x) - sorted.begin());
+
+      REQUIRE( std::abs(r / static_cast<double>(n) - q) < 0.01 );
+      REQUIRE( std::abs(sketch.rank(sorted[static_cast<size_t>(q * n)]) - q) < 0.01 );
+    }
+  }
+
+  // approximate "histogram_uniform"
+  std::vector<double> P, x, Q, y;
+
+  std::tie(P, x) = cppmat::histogram_uniform(b, 10, false, true);
+  std::tie(Q, y) = cppmat::histogram_uniform(data, 10, false, true);
+
+  REQUIRE( x.front() == y.front() );
+  REQUIRE( x.back () == y.back () );
+  EQ( std::accumulate(P.begin(), P.end(), 0.0), static_cast<double>(n) );
+
+  for ( size_t j = 0 ; j < 10 ; ++j ) {
+    REQUIRE( std::abs(P[j] / static_cast<double>(n) - 0.1) < 0.01 );
+    REQUIRE( std::abs(Q[j] / static_cast<double>(n) - 0.1) < 0.01 );
+  }
+
+  // the density integrates to one
+  std::tie(P, x) = cppmat::histogram_uniform(b, 10, true, true);
+
+  double sum = 0.0;
+
+  for ( size_t j = 0 ; j < 10 ; ++j )
+    sum += P[j] * ( x[j+1] - x[j] );
+
+  EQ( sum, 1. );
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,250 @@
+
+#include "support.h"
+
+typedef cppmat::array<double>                Arr;
+typedef cppmat::view::strided<const double>  View;
+typedef cppmat::histogram_axis               Axis;
+typedef cppmat::histogram_nd                 Hist;
+
+// =================================================================================================
+
+// reference: bin of "x" using the edges (the last bin includes its upper edge), "bins" if outside
+inline size_t bin_reference(const std::vector<double> &edges, double x)
+{
+  size_t bins = edges.size()-1;
+
+  if ( x < edges.front() or x > edges.back() ) return bins;
+
+  for ( size_t i = 0 ; i < bins-1 ; ++i )
+    if ( x < edges[i+1] )
+      return i;
+
+  return bins-1;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::histogram_nd", "histogram_nd.h")
+{
+
+// =================================================================================================
+
+SECTION( "histogramdd: two fields, marginal equal to histogram" )
+{
+  cppmat::parallel::setThreshold(1000);
+
+  cppmat::random::engine rng(10);
+
+  Arr A({200,100});
+  Arr B({200,100});
+
+  rng.fillNormal (A.begin(), A.end(), 0., 1.);
+  rng.fillUniform(B.begin(), B.end(), 2., 5.);
+
+  std::vector<Axis> axes = {
+    Axis::Linear(12, A.min(), A.max()),
+    Axis::Linear( 7, B.min(), B.max())
+  };
+
+  Arr P;
+  std::vector<std::vector<double>> x;
+
+  std::tie(P, x) = cppmat::histogramdd(std::vector<View>({A.strided(), B.strided()}), axes, false, true);
+
+  REQUIRE( P.shape() == std::vector<size_t>({12, 7}) );
+  REQUIRE( x.size() == 2 );
+  REQUIRE( x[0].size() == 13 );
+  REQUIRE( x[1].size() == 8 );
+
+  // marginals
+  std::vector<double> PA, xA, PB, xB;
+
+  std::tie(PA, xA) = cppmat::histogram(A.data(), A.size(), 12, false, true);
+  std::tie(PB, xB) = cppmat::histogram(B.data(), B.size(),  7, false, true);
+
+  REQUIRE( x[0] == xA );
+  REQUIRE( x[1] == xB );
+
+  Arr QA = P.sum(1);
+  Arr QB = P.sum(0);
+
+  for ( size_t i = 0 ; i < 12 ; ++i ) REQUIRE( QA[i] == PA[i] );
+  for ( size_t j = 0 ;  j < 7 ; ++j ) REQUIRE( QB[j] == PB[j] );
+
+  // joint count
+  Arr Q = Arr::Zero({12, 7});
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+    Q(bin_reference(x[0], A[i]), bin_reference(x[1], B[i])) += 1.;
+
+  REQUIRE( P == Q );
+
+  // independent of the number of threads
+  cppmat::parallel::setNumThreads(1);
+
+  Arr R;
+
+  std::tie(R, x) = cppmat::histogramdd(std::vector<View>({A.strided(), B.strided()}), axes);
+
+  REQUIRE( P == R );
+
+  cppmat::parallel::setNumThreads();
+  cppmat::parallel::setThreshold();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram_nd: rows of an array, weights, outside the range, merge" )
+{
+  cppmat::random::engine rng(11);
+
+  size_t n = 50000;
+
+  Arr A({n, 2});
+  Arr W({n});
+
+  rng.fillUniform(A.begin(), A.end(), 0., 1.);
+  rng.fillUniform(W.begin(), W.end(), 0., 2.);
+
+  std::vector<Axis> axes = {
+    Axis::Linear(5, 0.1, 0.9),
+    Axis::Edges({0.0, 0.1, 0.5, 0.6, 1.0})
+  };
+
+  // in two chunks, merged
+  Hist a(axes);
+  Hist b(axes);
+
+  a.push(A.strided().slice(0, 0, n/2).copy(), W.strided().slice(0, 0, n/2).copy());
+  b.push(std::vector<View>({A.strided().slice(0, n/2, n).select(1, 0), A.strided().slice(0, n/2, n).select(1, 1)}),
+    View(W.strided().slice(0, n/2, n)));
+
+  a.merge(b);
+
+  REQUIRE( a.size() + a.outside() == n );
+
+  // reference
+  Arr    Q = Arr::Zero({5, 4});
+  Arr    C = Arr::Zero({5, 4});
+  size_t outside = 0;
+
+  std::vector<double> x0 = axes[0].edges();
+  std::vector<double> x1 = axes[1].edges();
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    size_t i0 = bin_reference(x0, A(i,0));
+    size_t i1 = bin_reference(x1, A(i,1));
+
+    if ( i0 == 5 or i1 == 4 ) { ++outside; continue; }
+
+    Q(i0,i1) += W[i];
+    C(i0,i1) += 1.;
+  }
+
+  REQUIRE( a.outside() == outside );
+
+  cppmat::array<double> P = a.weight();
+  cppmat::array<size_t> N = a.count();
+
+  for ( size_t j = 0 ; j < P.size() ; ++j ) {
+    EQ( P[j], Q[j] );
+    REQUIRE( static_cast<double>(N[j]) == C[j] );
+  }
+
+  // the density integrates to one
+  cppmat::array<double> D = a.density();
+
+  std::vector<double> w0 = axes[0].width();
+  std::vector<double> w1 = axes[1].width();
+
+  double sum = 0.0;
+
+  for ( size_t i = 0 ; i < 5 ; ++i )
+    for ( size_t j = 0 ; j < 4 ; ++j )
+      sum += D(i,j) * w0[i] * w1[j];
+
+  EQ( sum, 1. );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram_nd: logarithmic bins" )
+{
+  cppmat::random::engine rng(12);
+
+  Arr A({10000});
+  Arr B({10000});
+
+  rng.fillUniform(A.begin(), A.end(), -3., 3.);
+  rng.fillUniform(B.begin(), B.end(),  0., 1.);
+
+  for ( auto &a : A ) a = std::pow(10., a);
+
+  std::vector<Axis> axes = {
+    Axis::Log(6, 1.e-3, 1.e3),
+    Axis::Linear(3, 0., 1.)
+  };
+
+  std::vector<double> x0 = axes[0].edges();
+  std::vector<double> m0 = axes[0].mid();
+
+  REQUIRE( x0.front() == 1.e-3 );
+  REQUIRE( x0.back () == 1.e3  );
+
+  for ( size_t i = 0 ; i < 6 ; ++i ) {
+    EQ( x0[i+1] / x0[i], 10. );
+    EQ( m0[i] / x0[i], std::sqrt(10.) );
+  }
+
+  Hist a(axes);
+
+  a.push(std::vector<View>({A.strided(), B.strided()}));
+
+  Arr Q = Arr::Zero({6, 3});
+
+  for ( size_t i = 0 ; i < A.size() ; ++i )
+  {
+    size_t i0 = bin_reference(x0, A[i]);
+    size_t i1 = bin_reference(axes[1].edges(), B[i]);
+
+    if ( i0 < 6 and i1 < 3 ) Q(i0,i1) += 1.;
+  }
+
+  REQUIRE( a.weight() == Q );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "histogram_nd: view without a constant stride, number of axes" )
+{
+  Arr A = Arr::Arange({4, 4});
+  Arr W = Arr::Ones({4, 4});
+
+  W(1,0) = 2.;
+
+  // sub-block: entries 0, 1, 4, 5
+  View a = A.strided().slice(0, 0, 2).slice(1, 0, 2);
+  View w = W.strided().slice(0, 0, 2).slice(1, 0, 2);
+
+  Hist h({Axis::Linear(16, 0., 16.)});
+
+  h.push(std::vector<View>({a}), w);
+
+  Arr Q = Arr::Zero({16});
+
+  Q(0) = 1.;
+  Q(1) = 1.;
+  Q(4) = 2.;
+  Q(5) = 1.;
+
+  REQUIRE( h.weight() == Q );
+  REQUIRE( h.size() == 4 );
+
+  REQUIRE_THROWS_AS( Hist(std::vector<Axis>()), std::invalid_argument );
+  REQUIRE_THROWS_AS( Hist(std::vector<Axis>(7, Axis::Linear(2, 0., 1.))), std::invalid_argument );
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,334 @@
+
+#include "support.h"
+
+typedef cppmat::array<double>                Arr;
+typedef cppmat::cartesian::tensor2<double>   T2;
+typedef cppmat::cartesian::tensor4<double>   T4;
+typedef cppmat::symmetric::matrix<double>    Sym;
+typedef cppmat::diagonal::matrix<double>     Diag;
+
+// =================================================================================================
+
+// check that a pointer is aligned to "CPPMAT_ALIGN" bytes
+inline bool aligned(const void *p)
+{
+  return reinterpret_cast<std::uintptr_t>(p) % CPPMAT_ALIGN == 0;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::memory", "allocator.h")
+{
+
+// =================================================================================================
+
+SECTION( "arena: temporaries of a time-step" )
+{
+  // large enough not to be stored inline
+  T4 C = T4::Random(10);
+  T2 A = T2::Random(10);
+
+  // reference on the heap
+  T2 B = C.ddot(A) + A.dot(A);
+
+  cppmat::memory::arena arena(16384);
+
+  REQUIRE( cppmat::memory::get() == cppmat::memory::heap_resource() );
+
+  for ( size_t step = 0 ; step < 10 ; ++step )
+  {
+    arena.reset();
+
+    REQUIRE( arena.used() == 0 );
+
+    cppmat::memory::scope scope(arena);
+
+    REQUIRE( cppmat::memory::get() == &arena );
+
+    // the temporaries, and the result, are allocated from the arena
+    T2 D = C.ddot(A) + A.dot(A);
+
+    REQUIRE( D == B );
+    REQUIRE( aligned(D.data()) );
+    REQUIRE( arena.used() > 0 );
+    REQUIRE( arena.capacity() == 16384 );
+
+    // a new array
+    Arr E = Arr::Random({10, 10});
+
+    REQUIRE( aligned(E.data()) );
+
+    // the most recent allocation is reclaimed when it is freed
+    double *p;
+
+    {
+      T2 F = A;
+      p = F.data();
+    }
+
+    {
+      T2 F = A;
+      REQUIRE( F.data() == p );
+    }
+  }
+
+  // the default is restored at the end of the scope
+  REQUIRE( cppmat::memory::get() == cppmat::memory::heap_resource() );
+
+  // the memory is reused after "reset"
+  arena.reset();
+
+  double *p;
+
+  {
+    cppmat::memory::scope scope(arena);
+    T2 D = A;
+    p = D.data();
+  }
+
+  arena.reset();
+
+  {
+    cppmat::memory::scope scope(arena);
+    T2 D = A;
+    REQUIRE( D.data() == p );
+  }
+
+  // large allocations get their own chunk
+  {
+    cppmat::memory::scope scope(arena);
+    Arr E = Arr::Zero({100, 100});
+    REQUIRE( E.sum() == 0. );
+    REQUIRE( arena.capacity() >= 16384 + 100*100*sizeof(double) );
+  }
+
+  arena.release();
+
+  REQUIRE( arena.capacity() == 0 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "arena: storage that is kept after reset" )
+{
+  cppmat::memory::arena arena(16384);
+
+  // kept from one time-step to the next
+  Arr sig;
+
+  for ( size_t step = 0 ; step < 10 ; ++step )
+  {
+    arena.reset();
+
+    cppmat::memory::scope scope(arena);
+
+    Arr A = Arr::Constant({1000}, static_cast<double>(step));
+
+    // the previous value of "sig" is freed after the reset
+    sig = std::move(A);
+
+    // a new temporary does not overlap with "sig"
+    Arr B = Arr::Constant({1000}, 100.);
+
+    REQUIRE( sig.data() != B.data() );
+    REQUIRE( sig[0] == static_cast<double>(step) );
+    REQUIRE( sig[999] == static_cast<double>(step) );
+    REQUIRE( B[0] == 100. );
+  }
+
+  // the chunks are reused
+  REQUIRE( arena.capacity() <= 3 * 16384 );
+
+  sig = Arr();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "storage is returned to the resource that allocated it" )
+{
+  cppmat::memory::pool pool;
+
+  Arr A = Arr::Random({10, 10});
+  Arr B;
+
+  {
+    cppmat::memory::scope scope(pool);
+
+    // copy: allocated from the pool
+    B = A;
+
+    // "A" is resized inside the scope: the old storage is returned to the heap
+    A.resize({20, 20});
+    A.setZero();
+  }
+
+  REQUIRE( B.size() == 100 );
+  REQUIRE( A.sum() == 0. );
+
+  // both are freed outside the scope: "B" is returned to the pool
+  A = Arr();
+  B = Arr();
+
+  // nested scopes
+  cppmat::memory::arena arena;
+
+  {
+    cppmat::memory::scope outer(pool);
+    {
+      cppmat::memory::scope inner(arena);
+      REQUIRE( cppmat::memory::get() == &arena );
+    }
+    REQUIRE( cppmat::memory::get() == &pool );
+  }
+
+  REQUIRE( cppmat::memory::get() == cppmat::memory::heap_resource() );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "pool: recycle blocks of equal size" )
+{
+  cppmat::memory::pool pool;
+
+  cppmat::memory::scope scope(pool);
+
+  T2   A = T2::Random(10);
+  Sym  S = Sym::Random(20, 20);
+  Diag D = Diag::Random(10, 10);
+
+  REQUIRE( aligned(A.data()) );
+  REQUIRE( aligned(S.data()) );
+  REQUIRE( aligned(D.data()) );
+
+  double *p;
+
+  {
+    T2 B = A.dot(A);
+    p = B.data();
+  }
+
+  size_t capacity = pool.capacity();
+
+  // many short-lived temporaries: the same blocks are reused
+  for ( size_t i = 0 ; i < 1000 ; ++i )
+  {
+    T2 B = A.dot(A);
+    T2 C = A.dot(A) + A;
+    REQUIRE( B.data() == p );
+  }
+
+  REQUIRE( pool.capacity() == capacity );
+
+  // large blocks are passed to the heap
+  Arr E = Arr::Zero({100, 100});
+
+  REQUIRE( pool.capacity() == capacity );
+  REQUIRE( aligned(E.data()) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "small tensors are stored inline" )
+{
+  typedef cppmat::cartesian::tensor2s<double> T2s;
+  typedef cppmat::cartesian::tensor2d<double> T2d;
+  typedef cppmat::cartesian::vector  <double> Vec;
+
+  cppmat::memory::arena arena;
+
+  T4  C = T4::Random(3);
+  T2  A = T2::Random(3);
+  T2s S = T2s::Random(3);
+  T2d D = T2d::Random(3);
+  Vec V = Vec::Random(3);
+
+  // reference
+  T2 B = C.ddot(A) + S.dot(D) + V.dyadic(V);
+
+  {
+    cppmat::memory::scope scope(arena);
+
+    // nothing is allocated
+    T2 E = C.ddot(A) + S.dot(D) + V.dyadic(V);
+    T4 F = C.ddot(C);
+
+    REQUIRE( E == B );
+    REQUIRE( F(0,1,2,0) == C.ddot(C)(0,1,2,0) );
+    REQUIRE( arena.capacity() == 0 );
+
+    // larger tensors are allocated
+    T2 G = T2::Random(10);
+
+    REQUIRE( aligned(G.data()) );
+    REQUIRE( arena.capacity() > 0 );
+  }
+
+  // copy and move of inline storage
+  T2 E = B;
+  T2 F = std::move(E);
+
+  REQUIRE( F == B );
+  REQUIRE( F.data() != B.data() );
+
+  E = F;
+  F = std::move(B);
+
+  REQUIRE( E == F );
+
+  // move of allocated storage: the storage is taken
+  T2 G = T2::Random(10);
+  double *p = G.data();
+  T2 H = std::move(G);
+
+  REQUIRE( H.data() == p );
+
+  // the inline storage is sized per class
+  REQUIRE( sizeof(Arr) < sizeof(Vec) );
+  REQUIRE( sizeof(Vec) < sizeof(T2)  );
+  REQUIRE( sizeof(T2)  < sizeof(T4)  );
+  REQUIRE( sizeof(Arr) + 9*sizeof(double) <= sizeof(T2) );
+
+  // to and from a class without inline storage
+  Arr M = T2(F);
+  T2  K = M;
+  T2  L = std::move(M);
+
+  REQUIRE( K == F );
+  REQUIRE( L == F );
+
+  {
+    cppmat::memory::scope scope(arena);
+
+    size_t used = arena.used();
+
+    // a small tensor that is moved to "cppmat::array" is copied to allocated storage
+    Arr N = T2(F);
+
+    REQUIRE( arena.used() > used );
+
+    // and back to inline storage
+    used = arena.used();
+
+    T2 O = std::move(N);
+
+    REQUIRE( O == F );
+    REQUIRE( arena.used() == used );
+  }
+
+  // grow beyond the inline storage, and shrink
+  cppmat::vector<double> W = cppmat::vector<double>::Arange(80);
+
+  for ( size_t i = 80 ; i < 200 ; ++i )
+    W.push_back(static_cast<double>(i));
+
+  REQUIRE( W == cppmat::vector<double>::Arange(200) );
+  REQUIRE( aligned(W.data()) );
+
+  W.resize(3);
+
+  REQUIRE( W == cppmat::vector<double>::Arange(3) );
+}
+
+// =================================================================================================
+
+}
@@ -0,0 +1,178 @@
+
+#include "support.h"
+
+typedef cppmat::array<double> Arr;
+typedef cppmat::random::engine Engine;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::random", "random.h")
+{
+
+// =================================================================================================
+
+SECTION( "engine: reproducible, random access" )
+{
+  Engine a(12345);
+  Engine b(12345);
+  Engine c(12345, 1);
+  Engine d(54321);
+
+  size_t ndiff_stream = 0;
+  size_t ndiff_seed   = 0;
+
+  for ( size_t i = 0 ; i < 1000 ; ++i )
+  {
+    uint64_t x = a();
+
+    REQUIRE( x == b() );
+    REQUIRE( x == b.at(i) );
+
+    if ( x != c() ) ++ndiff_stream;
+    if ( x != d() ) ++ndiff_seed;
+  }
+
+  REQUIRE( a.counter() == 1000 );
+  REQUIRE( ndiff_stream == 1000 );
+  REQUIRE( ndiff_seed   == 1000 );
+
+  b.setCounter(10);
+
+  REQUIRE( b() == a.at(10) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "engine: fill equals a sequence of single numbers, independent of the number of threads" )
+{
+  cppmat::parallel::setThreshold(1000);
+
+  size_t n = 100000;
+
+  std::vector<double> A(n), B(n), C(n), D(n);
+  std::vector<int>    E(n), F(n);
+
+  Engine rng(7);
+
+  rng.fillUniform(A.begin(), A.end(), -1., 2.);
+  rng.fillNormal (B.begin(), B.end(), 1., 2.);
+  rng.fillInteger(E.begin(), E.end(), -3, 3);
+
+  REQUIRE( rng.counter() == 4*n );
+
+  cppmat::parallel::setNumThreads(1);
+
+  rng.seed(7);
+
+  rng.fillUniform(C.begin(), C.end(), -1., 2.);
+  rng.fillNormal (D.begin(), D.end(), 1., 2.);
+  rng.fillInteger(F.begin(), F.end(), -3, 3);
+
+  rng.seed(7);
+
+  for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( A[i] == rng.uniform(-1., 2.) );
+  for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( B[i] == rng.normal (1., 2.) );
+  for ( size_t i = 0 ; i < n ; ++i ) REQUIRE( E[i] == rng.integer(-3, 3) );
+
+  REQUIRE( A == C );
+  REQUIRE( B == D );
+  REQUIRE( E == F );
+
+  cppmat::parallel::setNumThreads();
+  cppmat::parallel::setThreshold();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "engine: distributions" )
+{
+  size_t n = 200000;
+
+  std::vector<double> A(n), B(n);
+  std::vector<int>    C(n);
+
+  Engine rng(42);
+
+  rng.fillUniform(A.begin(), A.end(), 2., 4.);
+  rng.fillNormal (B.begin(), B.end(), 1., 3.);
+  rng.fillInteger(C.begin(), C.end(), -2, 2);
+
+  // uniform: bounds, mean, and variance (of a uniform distribution on [2, 4): 3 and 1/3)
+  double mean = 0.0;
+  double var  = 0.0;
+
+  for ( auto &a : A ) {
+    REQUIRE( a >= 2. );
+    REQUIRE( a <  4. );
+    mean += a / static_cast<double>(n);
+  }
+
+  for ( auto &a : A )
+    var += (a - mean) * (a - mean) / static_cast<double>(n);
+
+  REQUIRE( std::abs(mean - 3.     ) < 0.01 );
+  REQUIRE( std::abs(var  - 1. / 3.) < 0.01 );
+
+  // normal: mean and standard deviation
+  mean = 0.0;
+  var  = 0.0;
+
+  for ( auto &b : B ) mean += b / static_cast<double>(n);
+  for ( auto &b : B ) var  += (b - mean) * (b - mean) / static_cast<double>(n);
+
+  REQUIRE( std::abs(mean - 1.) < 0.05 );
+  REQUIRE( std::abs(std::sqrt(var) - 3.) < 0.05 );
+
+  // integer: bounds (both included), and each value equally likely
+  std::vector<size_t> count(5, 0);
+
+  for ( auto &c : C ) {
+    REQUIRE( c >= -2 );
+    REQUIRE( c <=  2 );
+    count[c+2]++;
+  }
+
+  for ( auto &i : count )
+    REQUIRE( std::abs(static_cast<double>(i) / static_cast<double>(n) - 0.2) < 0.01 );
+
+  // uniform at the maximal raw draw: "lower + (upper - lower) * u" rounds to "upper", it is excluded
+  uint64_t last = std::numeric_limits<uint64_t>::max();
+
+  REQUIRE( 1.f + 1.f * cppmat::Private::random_unit<float >(last) == 2.f );
+  REQUIRE( 1.  + 1.  * cppmat::Private::random_unit<double>(last) == 2.  );
+
+  REQUIRE( cppmat::Private::random_uniform<float >(last, 1.f, 2.f) == std::nextafter(2.f, 1.f) );
+  REQUIRE( cppmat::Private::random_uniform<double>(last, 1. , 2. ) == std::nextafter(2. , 1. ) );
+  REQUIRE( cppmat::Private::random_uniform<double>(last, 2. , 4. ) <  4. );
+  REQUIRE( cppmat::Private::random_uniform<double>(0   , 2. , 4. ) == 2. );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "global generator: seed makes Random reproducible" )
+{
+  cppmat::random::seed(2018);
+
+  Arr A = Arr::Random({10,20});
+  Arr B = Arr::Random({10,20});
+
+  cppmat::random::seed(2018);
+
+  Arr C = Arr::Random({10,20});
+  Arr D = Arr::Random({10,20});
+
+  for ( size_t i = 0 ; i < A.size() ; ++i ) {
+    REQUIRE( A[i] == C[i] );
+    REQUIRE( B[i] == D[i] );
+    REQUIRE( A[i] != B[i] );
+  }
+
+  cppmat::tiny::cartesian::tensor2<double,3> E = cppmat::tiny::cartesian::tensor2<double,3>::Random();
+  cppmat::tiny::cartesian::tensor2<double,3> F = cppmat::tiny::cartesian::tensor2<double,3>::Random();
+
+  REQUIRE( E[0] != F[0] );
+}
+
+// =================================================================================================
+
+}
@@ -141,4 +141,114 @@ inline void Equal(const cppmat::diagonal::matrix<double> &A, const MatD &B)
 
 // =================================================================================================
 
+// eigen-decomposition of a symmetric "a": eigenvalues "val" (ascending), eigenvectors the columns of
+// "vec" (row-major storage): compare the eigenvalues, and check that "vec" is orthonormal and that it
+// diagonalizes "a"
+inline void EqualEig(const MatD &a, const double *val, const double *vec)
+{
+  auto n = a.rows();
+
+  Eigen::SelfAdjointEigenSolver<MatD> solver(a);
+
+  MatD V = Eigen::Map<const MatD>(vec, n, n);
+  MatD L = Eigen::Map<const ColD>(val, n).asDiagonal();
+
+  for ( auto i = 0 ; i < n ; ++i )
+    EQ( val[i], solver.eigenvalues()(i) );
+
+  MatD I = V.transpose() * V;
+  MatD A = V * L * V.transpose();
+
+  for ( auto i = 0 ; i < n ; ++i ) {
+    for ( auto j = 0 ; j < n ; ++j ) {
+      EQ( I(i,j), i == j ? 1. : 0. );
+      EQ( A(i,j), a(i,j) );
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// symmetric matrices with (almost) repeated eigenvalues: "Q * diag(l) * Q^T", with "Q" a random
+// rotation (or the identity)
+inline MatD makeSymmetricWithEigenvalues(const ColD &l, bool rotate=true)
+{
+  auto n = l.size();
+
+  MatD Q = MatD::Identity(n,n);
+
+  if ( rotate )
+    Q = Eigen::HouseholderQR<MatD>(MatD::Random(n,n)).householderQ();
+
+  return makeSymmetric(Q * l.asDiagonal() * Q.transpose());
+}
+
+// =================================================================================================
+
+// compare a symmetric tensor (of any "tensor2s" class) with a dense matrix
+template<class T>
+inline void EqualSymmetric(const T &A, const MatD &B)
+{
+  for ( auto i = 0 ; i < B.rows() ; ++i )
+    for ( auto j = 0 ; j < B.cols() ; ++j )
+      EQ( A(i,j), B(i,j) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// isotropic function of a symmetric matrix "a": "V * diag(f(l)) * V^T", with "l" and "V" from Eigen
+template<class F>
+inline MatD isotropicFunction(const MatD &a, F f)
+{
+  Eigen::SelfAdjointEigenSolver<MatD> solver(a);
+
+  ColD l = solver.eigenvalues().unaryExpr(f);
+
+  return solver.eigenvectors() * l.asDiagonal() * solver.eigenvectors().transpose();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// compare the derivative "dFdA" (row-major "tensor4") of "F = func(A)" (with "A" and "F" "tensor2s")
+// with central finite differences, relative to the largest component of "dFdA"
+// N.B. perturbing "A(k,l)" perturbs both "A_kl" and "A_lk": "dF_ij = ( C_ijkl + C_ijlk ) * h"
+template<class T, class F>
+inline void EqualDerivative(const T &A, const double *dFdA, F func)
+{
+  size_t n     = A.ndim();
+  double h     = 1.e-5;
+  double scale = 1.;
+  double err   = 0.;
+
+  for ( size_t i = 0 ; i < n*n*n*n ; ++i )
+    scale = std::max(scale, std::abs(dFdA[i]));
+
+  for ( size_t k = 0 ; k < n ; ++k ) {
+    for ( size_t l = k ; l < n ; ++l ) {
+
+      T Ap = A;
+      T Am = A;
+
+      Ap(k,l) += h;
+      Am(k,l) -= h;
+
+      T Fp = func(Ap);
+      T Fm = func(Am);
+
+      for ( size_t i = 0 ; i < n ; ++i ) {
+        for ( size_t j = 0 ; j < n ; ++j ) {
+          double fd = ( Fp(i,j) - Fm(i,j) ) / ( 2. * h );
+          double c  = dFdA[((i*n+j)*n+k)*n+l] + dFdA[((i*n+j)*n+l)*n+k];
+          if ( k == l ) c /= 2.;
+          err = std::max(err, std::abs(fd - c));
+        }
+      }
+    }
+  }
+
+  REQUIRE( err < 1.e-6 * scale );
+}
+
+// =================================================================================================
+
 #endif
@@ -0,0 +1,381 @@
+
+#include "support.h"
+
+static const size_t ND = 3;
+static const size_t N  = 50;
+
+typedef cppmat::tiny::cartesian::tensor4 <double,ND> T4;
+typedef cppmat::tiny::cartesian::tensor2 <double,ND> T2;
+typedef cppmat::tiny::cartesian::tensor2s<double,ND> T2s;
+typedef cppmat::tiny::cartesian::tensor2d<double,ND> T2d;
+typedef cppmat::tiny::cartesian::vector  <double,ND> V;
+
+typedef cppmat::cartesian::storage Storage;
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+cppmat::cartesian::field<T> randomField(size_t n, Storage layout)
+{
+  cppmat::cartesian::field<T> out(n, layout);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    out.set(i, T::Random());
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+void EqualTensor(const T &A, const T &B)
+{
+  for ( size_t c = 0 ; c < T::Size() ; ++c )
+    EQ( A[c], B[c] );
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::cartesian::field", "var_cartesian_field.h")
+{
+
+// =================================================================================================
+// storage
+// =================================================================================================
+
+SECTION( "AoS, SoA: get, set, as" )
+{
+  auto A = randomField<T2s>(N, Storage::AoS);
+  auto B = A.as(Storage::SoA);
+
+  REQUIRE( B.layout() == Storage::SoA );
+  REQUIRE( B.size() == N );
+  REQUIRE( B.ncomp() == 6 );
+
+  for ( size_t i = 0 ; i < N ; ++i ) {
+    EqualTensor(A[i], B[i]);
+    for ( size_t c = 0 ; c < A.ncomp() ; ++c ) {
+      REQUIRE( A(i,c) == A.data()[i*A.ncomp()+c] );
+      REQUIRE( B(i,c) == B.data()[c*N+i] );
+    }
+  }
+
+  auto C = B.as(Storage::AoS);
+
+  for ( size_t i = 0 ; i < N*A.ncomp() ; ++i )
+    REQUIRE( A.data()[i] == C.data()[i] );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "arithmetic" )
+{
+  auto A = randomField<T2>(N, Storage::SoA);
+  auto B = randomField<T2>(N, Storage::SoA);
+  auto C = A;
+
+  C += B;
+  C *= 2.;
+
+  for ( size_t i = 0 ; i < N ; ++i )
+    EqualTensor(C[i], T2(2. * (A[i] + B[i])));
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+SECTION( "ddot(field<T4>, field<T2s>), ddot(T4, field<T2s>)" )
+{
+  for ( auto layout : {Storage::AoS, Storage::SoA} )
+  {
+    auto A = randomField<T4 >(N, layout);
+    auto B = randomField<T2s>(N, layout);
+    T4   D = T4::Random();
+
+    auto C = cppmat::cartesian::ddot(A, B);
+    auto E = cppmat::cartesian::ddot(D, B);
+
+    REQUIRE( C.layout() == layout );
+
+    for ( size_t i = 0 ; i < N ; ++i ) {
+      EqualTensor(C[i], A[i].ddot(B[i]));
+      EqualTensor(E[i], D.ddot(B[i]));
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "ddot(field<T2s>, field<T2s>), dot(field<T2>, field<V>), dyadic(field<T2s>, T2s)" )
+{
+  for ( auto layout : {Storage::AoS, Storage::SoA} )
+  {
+    auto A = randomField<T2s>(N, layout);
+    auto B = randomField<T2s>(N, layout);
+    auto F = randomField<T2 >(N, layout);
+    auto G = randomField<V  >(N, layout);
+    T2s  I = T2s::I();
+
+    cppmat::array<double> C = cppmat::cartesian::ddot(A, B);
+    auto H = cppmat::cartesian::dot(F, G);
+    auto K = cppmat::cartesian::dyadic(A, I);
+
+    REQUIRE( C.shape() == std::vector<size_t>({N}) );
+
+    for ( size_t i = 0 ; i < N ; ++i ) {
+      EQ( C[i], A[i].ddot(B[i]) );
+      EqualTensor(H[i], F[i].dot(G[i]));
+      EqualTensor(K[i], A[i].dyadic(I));
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "batched (SoA): dot(field<T2>, field<T2>), dyadic(field<T2s>, field<T2s>), inv, det" )
+{
+  // at least one full block, and a remainder
+  size_t n = 2 * CPPMAT_BATCH + 3;
+
+  auto A = randomField<T2 >(n, Storage::SoA);
+  auto B = randomField<T2 >(n, Storage::SoA);
+  auto F = randomField<T2s>(n, Storage::SoA);
+  auto G = randomField<T2s>(n, Storage::SoA);
+  auto P = randomField<T4 >(n, Storage::SoA);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    F.set(i, T2s(F[i] + 2. * T2s::I()));
+
+  auto C = cppmat::cartesian::dot(A, B);
+  auto D = cppmat::cartesian::dyadic(F, G);
+  auto H = cppmat::cartesian::inv(F);
+  auto K = cppmat::cartesian::det(F);
+  auto Q = cppmat::cartesian::ddot(P, G);
+  auto R = cppmat::cartesian::ddot(F, G);
+
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    EqualTensor(C[i], A[i].dot(B[i]));
+    EqualTensor(D[i], F[i].dyadic(G[i]));
+    EqualTensor(H[i], F[i].inv());
+    EQ( K[i], F[i].det() );
+    EqualTensor(Q[i], P[i].ddot(G[i]));
+    EQ( R[i], F[i].ddot(G[i]) );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "batched (SoA): 2-D" )
+{
+  typedef cppmat::tiny::cartesian::tensor4 <double,2> T4_2;
+  typedef cppmat::tiny::cartesian::tensor2 <double,2> T2_2;
+  typedef cppmat::tiny::cartesian::tensor2s<double,2> T2s_2;
+
+  size_t n = 2 * CPPMAT_BATCH + 3;
+
+  auto A = randomField<T4_2 >(n, Storage::SoA);
+  auto B = randomField<T2s_2>(n, Storage::SoA);
+  auto F = randomField<T2_2 >(n, Storage::SoA);
+
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    B.set(i, T2s_2(B[i] + 2. * T2s_2::I()));
+    F.set(i, T2_2 (F[i] + 2. * T2_2 ::I()));
+  }
+
+  auto C = cppmat::cartesian::ddot(A, B);
+  auto D = cppmat::cartesian::ddot(B, B);
+  auto H = cppmat::cartesian::inv(B);
+  auto K = cppmat::cartesian::det(B);
+  auto L = cppmat::cartesian::inv(F);
+  auto M = cppmat::cartesian::det(F);
+
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    EqualTensor(C[i], A[i].ddot(B[i]));
+    EQ( D[i], B[i].ddot(B[i]) );
+    EqualTensor(H[i], B[i].inv());
+    EQ( K[i], B[i].det() );
+    EqualTensor(L[i], F[i].inv());
+    EQ( M[i], F[i].det() );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "SoA: inv, det in 4-D (per tensor)" )
+{
+  typedef cppmat::tiny::cartesian::tensor2 <double,4> T2_4;
+  typedef cppmat::tiny::cartesian::tensor2s<double,4> T2s_4;
+
+  cppmat::cartesian::field<T2_4 > A(2, Storage::SoA);
+  cppmat::cartesian::field<T2s_4> B(2, Storage::SoA);
+
+  A.set(0, T2_4 ::I()); A.set(1, T2_4 (2. * T2_4 ::I()));
+  B.set(0, T2s_4::I()); B.set(1, T2s_4(2. * T2s_4::I()));
+
+  auto C = cppmat::cartesian::det(A);
+  auto D = cppmat::cartesian::det(B);
+  auto E = cppmat::cartesian::inv(A);
+  auto F = cppmat::cartesian::inv(B);
+
+  EQ( C[0],  1. ); EQ( C[1], 16. );
+  EQ( D[0],  1. ); EQ( D[1], 16. );
+
+  EqualTensor(E[1], T2_4 (0.5 * T2_4 ::I()));
+  EqualTensor(F[1], T2s_4(0.5 * T2s_4::I()));
+
+  // pivoting
+  T2_4 P = T2_4::Zero();
+
+  P(0,1) = P(1,0) = P(2,2) = P(3,3) = 1.;
+
+  EQ( P.det(), -1. );
+  EqualTensor(P.inv(), P);
+
+  // general tensors
+  size_t n = 20;
+
+  auto G = randomField<T2_4 >(n, Storage::SoA);
+  auto H = randomField<T2s_4>(n, Storage::SoA);
+
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    G.set(i, T2_4 (G[i] + 2. * T2_4 ::I()));
+    H.set(i, T2s_4(H[i] + 2. * T2s_4::I()));
+  }
+
+  auto K = cppmat::cartesian::inv(G);
+  auto L = cppmat::cartesian::inv(H);
+  auto M = cppmat::cartesian::det(G);
+
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    EqualTensor(K[i].dot(G[i]), T2_4::I());
+    EqualTensor(L[i].dot(H[i]), T2_4::I());
+    EQ( M[i] * K[i].det(), 1. );
+  }
+}
+
+// =================================================================================================
+// operations on each tensor
+// =================================================================================================
+
+SECTION( "inv, det, trace, hyd, dev" )
+{
+  for ( auto layout : {Storage::AoS, Storage::SoA} )
+  {
+    cppmat::cartesian::field<T2> A(N, layout);
+
+    for ( size_t i = 0 ; i < N ; ++i )
+      A.set(i, T2(T2::Random() + 2. * T2::I()));
+
+    auto B = cppmat::cartesian::inv(A);
+    auto C = cppmat::cartesian::det(A);
+    auto D = cppmat::cartesian::trace(A);
+    auto E = cppmat::cartesian::dev(A);
+    auto F = cppmat::cartesian::hyd(A);
+
+    for ( size_t i = 0 ; i < N ; ++i ) {
+      EqualTensor(B[i].dot(A[i]), T2::I());
+      EQ( C[i], A[i].det() );
+      EQ( D[i], A[i].trace() );
+      EQ( E[i].trace(), 0.0 );
+      EQ( F[i], D[i] / 3. );
+      EqualTensor(T2(E[i] + F[i] * T2::I()), A[i]);
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "apply" )
+{
+  auto A = randomField<T2s>(N, Storage::SoA);
+  auto B = randomField<V  >(N, Storage::SoA);
+
+  auto C = cppmat::cartesian::apply(A, B, [](const T2s &a, const V &b) { return b.dot(a.dot(b)); });
+
+  for ( size_t i = 0 ; i < N ; ++i )
+    EQ( C[i], B[i].dot(A[i].dot(B[i])) );
+}
+
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+SECTION( "eig(field<T2s>), eigenvalues(field<T2s>)" )
+{
+  size_t n = 2 * CPPMAT_BATCH + 3;
+
+  for ( auto layout : {Storage::AoS, Storage::SoA} )
+  {
+    auto A = randomField<T2s>(n, layout);
+
+    cppmat::cartesian::field<V>  val;
+    cppmat::cartesian::field<T2> vec;
+
+    cppmat::cartesian::eig(A, val, vec);
+
+    auto L = cppmat::cartesian::eigenvalues(A);
+
+    REQUIRE( val.layout() == layout );
+    REQUIRE( vec.layout() == layout );
+
+    for ( size_t i = 0 ; i < n ; ++i ) {
+      V  l;
+      T2 v;
+      A[i].eig(l, v);
+      EqualTensor(val[i], l);
+      EqualTensor(vec[i], v);
+      EqualTensor(L[i], l);
+    }
+  }
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+SECTION( "log, exp, sqrt, pow (field<T2s>), with derivative" )
+{
+  size_t n = 2 * CPPMAT_BATCH + 3;
+
+  for ( auto layout : {Storage::AoS, Storage::SoA} )
+  {
+    // positive definite
+    cppmat::cartesian::field<T2s> A(n, layout);
+
+    for ( size_t i = 0 ; i < n ; ++i ) {
+      MatD m = MatD::Random(ND,ND);
+      MatD a = makeSymmetric(m * m.transpose() + MatD::Identity(ND,ND));
+      A.set(i, T2s::CopyDense(a.data(), a.data()+a.size()));
+    }
+
+    cppmat::cartesian::field<T4> dF;
+
+    auto F = cppmat::cartesian::log(A, dF);
+    auto G = cppmat::cartesian::exp(A);
+    auto H = cppmat::cartesian::sqrt(A);
+    auto P = cppmat::cartesian::pow(A, -.5);
+
+    REQUIRE( F.layout() == layout );
+    REQUIRE( dF.layout() == layout );
+
+    for ( size_t i = 0 ; i < n ; ++i ) {
+      T4 d;
+      EqualTensor(F[i], cppmat::cartesian::log(A[i], d));
+      EqualTensor(dF[i], d);
+      EqualTensor(G[i], A[i].exp());
+      EqualTensor(H[i], A[i].sqrt());
+      EqualTensor(P[i], A[i].pow(-.5));
+    }
+
+    auto N = A;
+
+    N *= -1.;
+
+    REQUIRE_THROWS_AS(cppmat::cartesian::log(N), std::domain_error);
+  }
+}
+
+// =================================================================================================
+
+}
@@ -237,6 +237,70 @@ SECTION("T2s.inv() -- 2D")
   Equal(C, c);
 }
 
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+SECTION("T2s.eig(), T2s.eigenvalues() -- 2D, 3D, 5D")
+{
+  for ( size_t nd : {size_t(2), size_t(3), size_t(5)} )
+  {
+    MatD a = makeSymmetric(MatD::Random(nd,nd));
+
+    T2s A = T2s::CopyDense(nd, a.data(), a.data()+a.size());
+    V   val;
+    T2  vec;
+
+    A.eig(val, vec);
+
+    REQUIRE( val.ndim() == nd );
+    REQUIRE( vec.ndim() == nd );
+
+    EqualEig(a, val.data(), vec.data());
+
+    V L = A.eigenvalues();
+
+    for ( size_t i = 0 ; i < nd ; ++i )
+      EQ( L[i], val[i] );
+  }
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+SECTION("log(T2s), exp(T2s), sqrt(T2s), pow(T2s) -- 2D, 3D, 5D, with derivative")
+{
+  for ( size_t nd : {size_t(2), size_t(3), size_t(5)} )
+  {
+    MatD m = MatD::Random(nd,nd);
+    MatD a = makeSymmetric(m * m.transpose() + MatD::Identity(nd,nd));
+
+    T2s A = T2s::CopyDense(nd, a.data(), a.data()+a.size());
+    T4  dF;
+
+    EqualSymmetric(cppmat::cartesian::log(A, dF), isotropicFunction(a, [](double x) { return std::log(x); }));
+    REQUIRE( dF.ndim() == nd );
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::log(x); });
+
+    EqualSymmetric(cppmat::cartesian::exp(A, dF), isotropicFunction(a, [](double x) { return std::exp(x); }));
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::exp(x); });
+
+    EqualSymmetric(cppmat::cartesian::sqrt(A, dF), isotropicFunction(a, [](double x) { return std::sqrt(x); }));
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::sqrt(x); });
+
+    EqualSymmetric(cppmat::cartesian::pow(A, .5, dF), isotropicFunction(a, [](double x) { return std::sqrt(x); }));
+    EqualDerivative(A, dF.data(), [](const T2s &x) { return cppmat::cartesian::pow(x, .5); });
+
+    EqualSymmetric(A.log(), isotropicFunction(a, [](double x) { return std::log(x); }));
+    EqualSymmetric(A.pow(-1.), MatD(a.inverse()));
+
+    T2s Z = T2s::Zero(nd);
+
+    REQUIRE_THROWS_AS(Z.log(), std::domain_error);
+  }
+}
+
 // =================================================================================================
 
 }
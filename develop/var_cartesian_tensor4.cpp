@@ -301,6 +301,80 @@ SECTION( "II, T4.ddot(T2d)" )
   Equal(C, A.trace()*T2::I(ND));
 }
 
+// =================================================================================================
+// tensor products (against index notation)
+// =================================================================================================
+
+SECTION( "T4.ddot(T4), T4.ddot(T2), T4.ddot(T2s), T2.ddot(T4), T2s.ddot(T4)" )
+{
+  // the unfolding (nd^2 = 169) spans more than one block of the matrix product
+  size_t nd = 13;
+
+  T4  A = T4 ::Random(nd);
+  T4  B = T4 ::Random(nd);
+  T2  E = T2 ::Random(nd);
+  T2s F = T2s::Random(nd);
+
+  T4 C = A.ddot(B);
+  T4 D = T4::Zero(nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i )
+    for ( size_t j = 0 ; j < nd ; ++j )
+      for ( size_t k = 0 ; k < nd ; ++k )
+        for ( size_t l = 0 ; l < nd ; ++l )
+          for ( size_t m = 0 ; m < nd ; ++m )
+            for ( size_t n = 0 ; n < nd ; ++n )
+              D(i,j,m,n) += A(i,j,k,l) * B(l,k,m,n);
+
+  Equal(C, D);
+
+  T2 G = T2::Zero(nd), H = T2::Zero(nd), K = T2::Zero(nd), L = T2::Zero(nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          G(i,j) += A(i,j,k,l) * E(l,k);
+          H(i,j) += A(i,j,k,l) * F(l,k);
+          K(k,l) += E(i,j) * A(j,i,k,l);
+          L(k,l) += F(i,j) * A(j,i,k,l);
+        }
+      }
+    }
+  }
+
+  Equal(A.ddot(E), G);
+  Equal(A.ddot(F), H);
+  Equal(E.ddot(A), K);
+  Equal(F.ddot(A), L);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "T2.dyadic(T2), T2.dyadic(T2s), T2s.dyadic(T2), T2s.dyadic(T2s)" )
+{
+  T2  A = T2 ::Random(ND);
+  T2s B = T2s::Random(ND);
+
+  T4 C = A.dyadic(A);
+  T4 D = A.dyadic(B);
+  T4 E = B.dyadic(A);
+  T4 F = B.dyadic(B);
+
+  for ( size_t i = 0 ; i < ND ; ++i ) {
+    for ( size_t j = 0 ; j < ND ; ++j ) {
+      for ( size_t k = 0 ; k < ND ; ++k ) {
+        for ( size_t l = 0 ; l < ND ; ++l ) {
+          EQ( C(i,j,k,l), A(i,j) * A(k,l) );
+          EQ( D(i,j,k,l), A(i,j) * B(k,l) );
+          EQ( E(i,j,k,l), B(i,j) * A(k,l) );
+          EQ( F(i,j,k,l), B(i,j) * B(k,l) );
+        }
+      }
+    }
+  }
+}
+
 // =================================================================================================
 
 }
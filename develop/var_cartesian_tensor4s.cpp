@@ -0,0 +1,100 @@
+
+#include "support.h"
+
+static const size_t ND = 3;
+
+typedef cppmat::cartesian::tensor4 <double> T4;
+typedef cppmat::cartesian::tensor4s<double> T4s;
+typedef cppmat::cartesian::tensor2 <double> T2;
+typedef cppmat::cartesian::tensor2s<double> T2s;
+
+// =================================================================================================
+
+TEST_CASE("cppmat::cartesian::tensor4s", "var_cartesian_tensor4s.h")
+{
+
+// =================================================================================================
+// storage
+// =================================================================================================
+
+SECTION( "size, T4s(T4), T4(T4s)" )
+{
+  for ( size_t nd : {2, 3, 5} )
+  {
+    T4s A = T4s::Random(nd);
+
+    REQUIRE( A.ndim() == nd );
+    REQUIRE( A.shape(0) == nd*(nd+1)/2 );
+    REQUIRE( A.size() == ( (nd*(nd+1)/2) * (nd*(nd+1)/2 + 1) ) / 2 );
+
+    // full storage has minor and major symmetry
+    T4 B(A);
+
+    for ( size_t i = 0 ; i < nd ; ++i ) {
+      for ( size_t j = 0 ; j < nd ; ++j ) {
+        for ( size_t k = 0 ; k < nd ; ++k ) {
+          for ( size_t l = 0 ; l < nd ; ++l ) {
+            EQ( B(i,j,k,l), B(j,i,k,l) );
+            EQ( B(i,j,k,l), B(i,j,l,k) );
+            EQ( B(i,j,k,l), B(k,l,i,j) );
+          }
+        }
+      }
+    }
+
+    // conversion back
+    T4s C(B);
+
+    for ( size_t i = 0 ; i < A.size() ; ++i )
+      EQ( C[i], A[i] );
+  }
+}
+
+// =================================================================================================
+// unit tensors
+// =================================================================================================
+
+SECTION( "Is, Isd, II" )
+{
+  Equal(T4(T4s::Is (ND)), T4::Is (ND));
+  Equal(T4(T4s::Isd(ND)), T4::Isd(ND));
+  Equal(T4(T4s::II (ND)), T4::II (ND));
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+SECTION( "T4s.ddot(T2s), T2s.ddot(T4s)" )
+{
+  for ( size_t nd : {2, 3, 5} )
+  {
+    T4s A = T4s::Random(nd);
+    T2s B = T2s::Random(nd);
+
+    T2s C = A.ddot(B);
+    T2s D = B.ddot(A);
+    T2  E = T4(A).ddot(B);
+
+    Equal(E, C);
+    Equal(E, D);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "Isd, T4s.ddot(T2s)" )
+{
+  T4s I = T4s::Isd(ND);
+  T2s A = T2s::Random(ND);
+
+  T2s C = I.ddot(A);
+  T2s D = A - A.trace()/static_cast<double>(ND)*T2s::I(ND);
+
+  for ( size_t i = 0 ; i < C.size() ; ++i )
+    EQ( C[i], D[i] );
+}
+
+// =================================================================================================
+
+}
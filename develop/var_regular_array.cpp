@@ -415,6 +415,152 @@ SECTION( "scalar / array" )
   Equal(C, c);
 }
 
+// =================================================================================================
+// arithmetic - expressions
+// =================================================================================================
+
+SECTION( "array * array + scalar * array - array" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N);
+  MatD c = MatD::Random(M,N);
+  MatD d = MatD::Random(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+  Arr C = Arr::Copy({M,N}, c.data(), c.data()+c.size());
+  Arr D = Arr::Copy({M,N}, d.data(), d.data()+d.size());
+
+  MatD e = MatD::Zero(M,N);
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      e(i,j) = a(i,j) * b(i,j) + 2. * c(i,j) - d(i,j);
+
+  Arr E = A * B + 2. * C - D;
+
+  Equal(E, e);
+
+  E = Arr::Zero({M,N});
+  E = A * B + 2. * C - D;
+
+  Equal(E, e);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "-(array + array) / scalar + scalar" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+
+  MatD c = MatD::Zero(M,N);
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      c(i,j) = - ( a(i,j) + b(i,j) ) / 2. + 1.;
+
+  Arr C = - ( A + B ) / 2. + 1.;
+
+  Equal(C, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "array += array * array" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N);
+  MatD c = MatD::Random(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+  Arr C = Arr::Copy({M,N}, c.data(), c.data()+c.size());
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      c(i,j) += a(i,j) * b(i,j);
+
+  C += A * B;
+
+  Equal(C, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "array * tiny + view" )
+{
+  MatD a = MatD::Random(3,3);
+  MatD b = MatD::Random(3,3);
+  MatD c = MatD::Random(3,3);
+
+  Arr A = Arr::Copy({3,3}, a.data(), a.data()+a.size());
+
+  cppmat::tiny::matrix<double,3,3> B = cppmat::tiny::matrix<double,3,3>::Copy(b.data());
+
+  cppmat::view::matrix<double,3,3> C(c.data());
+
+  MatD d = MatD::Zero(3,3);
+
+  for ( size_t i = 0 ; i < 3 ; ++i )
+    for ( size_t j = 0 ; j < 3 ; ++j )
+      d(i,j) = a(i,j) * b(i,j) + c(i,j);
+
+  Arr D = A * B + C;
+
+  Equal(D, d);
+
+  // a temporary fixed size array is copied into the expression
+  auto E = A + cppmat::tiny::matrix<double,3,3>::Ones();
+
+  Arr F = E;
+
+  for ( size_t i = 0 ; i < 3 ; ++i )
+    for ( size_t j = 0 ; j < 3 ; ++j )
+      EQ( F(i,j), a(i,j) + 1. );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "(array * array).sum()" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+
+  EQ( (A * B).sum(), a.cwiseProduct(b).sum() );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "(array - array)(i,j), min, max, norm" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+
+  MatD c = a - b;
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      EQ( (A - B)(i,j), c(i,j) );
+
+  EQ( (A - B)(-1,-2), c(M-1,N-2) );
+  EQ( (-(A - B))(1,2), -c(1,2) );
+
+  REQUIRE( (A - B).min() == c.minCoeff() );
+  REQUIRE( (A - B).max() == c.maxCoeff() );
+  EQ( (A - B).norm(), c.cwiseAbs().sum() );
+  EQ( (-(A - B)).norm(), c.cwiseAbs().sum() );
+}
+
 // =================================================================================================
 // algebra - partial
 // =================================================================================================
@@ -523,8 +669,59 @@ SECTION( "average" )
   Equal(C, c);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "sum - non-adjacent axes" )
+{
+  Arr A = Arr::Random({M,N,O,P});
+
+  Arr C = A.sum({1,3});
+
+  Arr c = Arr::Zero({M,O});
+
+  for ( size_t i = 0 ; i < M ; i++ )
+    for ( size_t j = 0 ; j < N ; j++ )
+      for ( size_t k = 0 ; k < O ; k++ )
+        for ( size_t l = 0 ; l < P ; l++ )
+          c(i,k) += A(i,j,k,l);
+
+  Equal(C, c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "argmin, argmax" )
+{
+  Arr A = Arr::Random({M,N,O});
+
+  for ( int axis = 0 ; axis < 3 ; ++axis )
+  {
+    cppmat::array<size_t> I = A.argmin(axis);
+    cppmat::array<size_t> J = A.argmax(axis);
+    Arr                   C = A.min(axis);
+    Arr                   D = A.max(axis);
+
+    for ( size_t i = 0 ; i < I.shape(0) ; i++ )
+    {
+      for ( size_t j = 0 ; j < I.shape(1) ; j++ )
+      {
+        std::vector<size_t> idx = {i, j};
+        std::vector<size_t> jdx = {i, j};
+
+        idx.insert(idx.begin()+axis, I(i,j));
+        jdx.insert(jdx.begin()+axis, J(i,j));
+
+        EQ( A.at(idx.begin(), idx.end()), C(i,j) );
+        EQ( A.at(jdx.begin(), jdx.end()), D(i,j) );
+      }
+    }
+  }
+}
+
 // =================================================================================================
 // algebra
+// =================================================================================================// =================================================================================================
+// algebra
 // =================================================================================================
 
 SECTION( "min" )
@@ -654,6 +851,32 @@ SECTION( "at" )
 
 // -------------------------------------------------------------------------------------------------
 
+SECTION( "negative and periodic index" )
+{
+  Arr A = Arr::Random({M,N,O});
+
+  int m = static_cast<int>(M);
+  int n = static_cast<int>(N);
+  int o = static_cast<int>(O);
+
+  for ( int i = 0 ; i < m ; ++i )
+    for ( int j = 0 ; j < n ; ++j )
+      for ( int k = 0 ; k < o ; ++k )
+        REQUIRE( &A(i-m,j-n,k-o) == &A(i,j,k) );
+
+  A.setPeriodic(true);
+
+  for ( int i = 0 ; i < m ; ++i )
+    for ( int j = 0 ; j < n ; ++j )
+      for ( int k = 0 ; k < o ; ++k )
+        REQUIRE( &A(i+m,j-2*n,k+3*o) == &A(i,j,k) );
+
+  REQUIRE( A.compress(-1,-1,-1) == A.size()-1 );
+  REQUIRE( A.compress(m,n,o) == 0 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
 SECTION( "decompress" )
 {
   Arr A = Arr::Random({M,N,O,P});
@@ -681,6 +904,200 @@ SECTION( "where" )
   for ( auto &i : l ) REQUIRE( A[i] <= .5 );
 }
 
+// =================================================================================================
+// storage
+// =================================================================================================
+
+SECTION( "aligned storage" )
+{
+  Arr A = Arr::Random({M,N});
+  Arr B = A;
+
+  B.resize({M*N+1});
+
+  REQUIRE( reinterpret_cast<std::uintptr_t>(A.data()) % CPPMAT_ALIGN == 0 );
+  REQUIRE( reinterpret_cast<std::uintptr_t>(B.data()) % CPPMAT_ALIGN == 0 );
+}
+
+// =================================================================================================
+// strided view
+// =================================================================================================
+
+SECTION( "strided - slice" )
+{
+  Arr A = Arr::Random({M,N,O});
+
+  cppmat::view::strided<double> S = A.strided().range({1,M,2},{},{-4,-1});
+
+  REQUIRE( S.shape() == std::vector<size_t>({(M-1)/2, N, 3}) );
+
+  for ( size_t i = 0 ; i < S.shape(0) ; ++i )
+    for ( size_t j = 0 ; j < S.shape(1) ; ++j )
+      for ( size_t k = 0 ; k < S.shape(2) ; ++k )
+        REQUIRE( &S(i,j,k) == &A(1+2*i,j,O-4+k) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "strided - transpose, permute, select" )
+{
+  Arr A = Arr::Random({M,N,O});
+
+  cppmat::view::strided<const double> S = A.strided();
+  cppmat::view::strided<const double> T = S.transpose();
+  cppmat::view::strided<const double> P = S.permute({1,2,0});
+  cppmat::view::strided<const double> R = S.select(1,3);
+
+  REQUIRE( S.isContiguous() );
+  REQUIRE( not T.isContiguous() );
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      for ( size_t k = 0 ; k < O ; ++k )
+        REQUIRE( &T(k,j,i) == &A(i,j,k) );
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t j = 0 ; j < N ; ++j )
+      for ( size_t k = 0 ; k < O ; ++k )
+        REQUIRE( &P(j,k,i) == &A(i,j,k) );
+
+  for ( size_t i = 0 ; i < M ; ++i )
+    for ( size_t k = 0 ; k < O ; ++k )
+      REQUIRE( &R(i,k) == &A(i,3,k) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "strided - modify" )
+{
+  MatD a = MatD::Random(M,N);
+  MatD b = MatD::Random(M,N);
+
+  Arr A = Arr::Copy({M,N}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({M,N}, b.data(), b.data()+b.size());
+
+  for ( size_t i = 1 ; i < M ; i += 3 )
+    for ( size_t j = 0 ; j < 4 ; ++j )
+      a(i,j) += 2. * b(i,j);
+
+  cppmat::view::strided<double> S = A.strided().range({1,M,3},{0,4});
+
+  Arr C = S.copy();
+
+  S += 2. * B.strided().transpose().range({0,4},{1,M,3}).transpose().copy();
+
+  Equal(A, a);
+
+  S.setCopy(C);
+  S.setCopy(S.copy());
+
+  for ( size_t i = 0 ; i < C.shape(0) ; ++i )
+    for ( size_t j = 0 ; j < C.shape(1) ; ++j )
+      EQ( S(i,j), C(i,j) );
+
+  EQ( S.sum(), C.sum() );
+}
+
+SECTION( "parallel - element-wise and deterministic reductions" )
+{
+  cppmat::parallel::setThreshold(1000);
+
+  MatD a = MatD::Random(100,1000);
+  MatD b = MatD::Random(100,1000);
+
+  Arr A = Arr::Copy({100,1000}, a.data(), a.data()+a.size());
+  Arr B = Arr::Copy({100,1000}, b.data(), b.data()+b.size());
+
+  Arr C = A * B + 2. * A;
+  A += B;
+
+  MatD c = a.cwiseProduct(b) + 2. * a;
+  MatD d = a + b;
+
+  Equal(C, c);
+  Equal(A, d);
+
+  std::vector<size_t> idx = A.greater(0.5).where();
+
+  REQUIRE( idx.size() > 0 );
+  REQUIRE( idx.size() == static_cast<size_t>(A.greater(0.5).sum()) );
+
+  for ( size_t i = 1 ; i < idx.size() ; ++i )
+    REQUIRE( idx[i-1] < idx[i] );
+
+  cppmat::parallel::setNumThreads(3);
+
+  double sum = A.sum();
+  double min = A.min();
+  double max = A.max();
+
+  cppmat::parallel::setNumThreads(1);
+
+  REQUIRE( sum == A.sum() );
+  REQUIRE( min == A.min() );
+  REQUIRE( max == A.max() );
+  REQUIRE( A.min() == d.minCoeff() );
+  REQUIRE( A.max() == d.maxCoeff() );
+  EQ( A.sum(), d.sum() );
+
+  // reductions along an axis, comparison
+  cppmat::parallel::setNumThreads(3);
+
+  Arr    S0 = A.sum(0);
+  Arr    S1 = A.sum(1);
+  Arr    M0 = A.min(0);
+  Arr    M1 = A.max(1);
+  auto   I0 = A.argmin(0);
+  auto   I1 = A.argmax(1);
+  bool   eq = ( A == A );
+  bool   ne = ( A != C );
+
+  cppmat::parallel::setNumThreads(1);
+
+  REQUIRE( S0 == A.sum(0) );
+  REQUIRE( S1 == A.sum(1) );
+  REQUIRE( M0 == A.min(0) );
+  REQUIRE( M1 == A.max(1) );
+  REQUIRE( I0 == A.argmin(0) );
+  REQUIRE( I1 == A.argmax(1) );
+  REQUIRE( eq );
+  REQUIRE( ne );
+
+  for ( size_t j = 0 ; j < A.shape(1) ; ++j )
+    EQ( S0(j), d.col(j).sum() );
+
+  for ( size_t i = 0 ; i < A.shape(0) ; ++i )
+    REQUIRE( M1(i) == d.row(i).maxCoeff() );
+
+  cppmat::parallel::setNumThreads(3);
+
+  Arr P = A.pad({2,3}, -1.);
+  Arr S = A.slice({-1,0,5}, {});
+
+  cppmat::parallel::setNumThreads(1);
+
+  REQUIRE( P.shape(0) == 104 );
+  REQUIRE( P.shape(1) == 1006 );
+  REQUIRE( P(0,0) == -1. );
+  REQUIRE( P(103,1005) == -1. );
+  REQUIRE( P.sum() == A.pad({2,3}, -1.).sum() );
+  REQUIRE( S.shape(0) == 3 );
+  REQUIRE( S.shape(1) == 1000 );
+
+  for ( size_t i = 0 ; i < A.shape(0) ; ++i )
+    for ( size_t j = 0 ; j < A.shape(1) ; ++j )
+      REQUIRE( P(i+2,j+3) == A(i,j) );
+
+  for ( size_t j = 0 ; j < A.shape(1) ; ++j ) {
+    REQUIRE( S(0,j) == A(99,j) );
+    REQUIRE( S(1,j) == A( 0,j) );
+    REQUIRE( S(2,j) == A( 5,j) );
+  }
+
+  cppmat::parallel::setNumThreads();
+  cppmat::parallel::setThreshold();
+}
+
 // =================================================================================================
 
 }
@@ -0,0 +1,127 @@
+
+#include "support.h"
+
+typedef cppmat::matrix<double> Mat;
+typedef cppmat::vector<double> Vec;
+
+// =================================================================================================
+
+// copy to a row-major Eigen matrix
+inline MatD toEigen(const cppmat::array<double> &A)
+{
+  size_t m = A.shape(0);
+  size_t n = A.rank() > 1 ? A.shape(1) : 1;
+
+  MatD out(m, n);
+
+  std::copy(A.begin(), A.end(), out.data());
+
+  return out;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::matrix", "var_regular_matrix.h")
+{
+
+// =================================================================================================
+// matrix products : cppmat::matrix
+// =================================================================================================
+
+SECTION( "matrix.dot(matrix)" )
+{
+  // small, not a multiple of the kernel, with more than one block of "k", and of "n"
+  std::vector<std::vector<size_t>> shapes = {{5,3,7}, {131,77,300}, {37,600,20}, {64,64,64}};
+
+  for ( auto &shape : shapes )
+  {
+    Mat A = Mat::Random(shape[0], shape[2], -1., 1.);
+    Mat B = Mat::Random(shape[2], shape[1], -1., 1.);
+
+    MatD C = toEigen(A) * toEigen(B);
+
+    Equal(A.dot(B), C);
+    Equal(cppmat::matmul(A, B), C);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "matrix.dot(vector)" )
+{
+  std::vector<std::vector<size_t>> shapes = {{3,5}, {131,77}, {4,1000}};
+
+  for ( auto &shape : shapes )
+  {
+    Mat A = Mat::Random(shape[0], shape[1], -1., 1.);
+    Vec b = Vec::Random(shape[1], -1., 1.);
+
+    MatD c = toEigen(A) * toEigen(b);
+
+    Equal(A.dot(b), c);
+    Equal(cppmat::matvec(A, b), c);
+  }
+}
+
+// =================================================================================================
+// matrix products : cppmat::tiny::matrix and cppmat::view::matrix
+// =================================================================================================
+
+SECTION( "tiny::matrix.dot(tiny::matrix)" )
+{
+  // small: unrolled
+  {
+    cppmat::tiny::matrix<double,3,4> A = cppmat::tiny::matrix<double,3,4>::Random(-1., 1.);
+    cppmat::tiny::matrix<double,4,2> B = cppmat::tiny::matrix<double,4,2>::Random(-1., 1.);
+
+    MatD C = toEigen(Mat(A)) * toEigen(Mat(B));
+
+    Equal(Mat(A.dot(B)), C);
+    Equal(Mat(cppmat::tiny::matmul(A, B)), C);
+  }
+
+  // large: cache-blocked
+  {
+    cppmat::tiny::matrix<double,40,30> A = cppmat::tiny::matrix<double,40,30>::Random(-1., 1.);
+    cppmat::tiny::matrix<double,30,50> B = cppmat::tiny::matrix<double,30,50>::Random(-1., 1.);
+
+    MatD C = toEigen(Mat(A)) * toEigen(Mat(B));
+
+    Equal(Mat(A.dot(B)), C);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "tiny::matrix.dot(tiny::vector)" )
+{
+  cppmat::tiny::matrix<double,3,5> A = cppmat::tiny::matrix<double,3,5>::Random(-1., 1.);
+  cppmat::tiny::vector<double,5>   b = cppmat::tiny::vector<double,5>  ::Random(-1., 1.);
+
+  MatD c = toEigen(Mat(A)) * toEigen(Vec(b));
+
+  Equal(Vec(A.dot(b)), c);
+  Equal(Vec(cppmat::tiny::matvec(A, b)), c);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "view::matrix.dot(view::matrix), view::matrix.dot(view::vector)" )
+{
+  Mat A = Mat::Random(3, 4, -1., 1.);
+  Mat B = Mat::Random(4, 2, -1., 1.);
+  Vec b = Vec::Random(4, -1., 1.);
+
+  cppmat::view::matrix<double,3,4> VA = cppmat::view::matrix<double,3,4>::Map(A.data());
+  cppmat::view::matrix<double,4,2> VB = cppmat::view::matrix<double,4,2>::Map(B.data());
+  cppmat::view::vector<double,4>   vb = cppmat::view::vector<double,4>  ::Map(b.data());
+
+  Equal(Mat(VA.dot(VB)), toEigen(A) * toEigen(B));
+  Equal(Mat(cppmat::view::matmul(VA, VB)), toEigen(A) * toEigen(B));
+  Equal(Vec(VA.dot(vb)), toEigen(A) * toEigen(b));
+  Equal(Vec(cppmat::view::matvec(VA, vb)), toEigen(A) * toEigen(b));
+}
+
+// =================================================================================================
+
+}
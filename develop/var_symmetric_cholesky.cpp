@@ -0,0 +1,139 @@
+
+#include "support.h"
+
+typedef cppmat::symmetric::matrix<double> sMat;
+
+// =================================================================================================
+
+// symmetric positive definite matrix
+inline MatD makeSPD(size_t n)
+{
+  MatD a = MatD::Random(n,n);
+
+  return makeSymmetric(a * a.transpose()) + static_cast<double>(n) * MatD::Identity(n,n);
+}
+
+// symmetric indefinite matrix, that can be factorized without pivoting
+inline MatD makeQuasiDefinite(size_t n)
+{
+  MatD a = makeSymmetric(MatD::Random(n,n));
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    a(i,i) = ( i % 2 == 0 ? 1. : -1. ) * static_cast<double>(n);
+
+  return a;
+}
+
+// =================================================================================================
+
+TEST_CASE("cppmat::symmetric::cholesky", "var_symmetric_cholesky.h")
+{
+
+// =================================================================================================
+
+SECTION( "cholesky" )
+{
+  for ( size_t n : {size_t(1), size_t(11), size_t(200)} )
+  {
+    MatD a = makeSPD(n);
+    MatD b = MatD::Random(n,1);
+    MatD B = MatD::Random(n,40);
+
+    sMat A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+
+    cppmat::symmetric::cholesky<double> llt(A);
+
+    // factor
+    MatD u = MatD::Zero(n,n);
+
+    for ( size_t i = 0 ; i < n ; ++i )
+      for ( size_t j = i ; j < n ; ++j )
+        u(i,j) = llt.factor()(i,j);
+
+    Equal(A, MatD(u.transpose() * u));
+
+    REQUIRE_THAT( llt.determinant(), Catch::WithinRel(a.determinant(), 1.e-8) );
+
+    // solve
+    cppmat::vector<double> x = cppmat::vector<double>::Copy(n, b.data(), b.data()+b.size());
+    cppmat::matrix<double> X = cppmat::matrix<double>::Copy(n, 40, B.data(), B.data()+B.size());
+
+    Equal(llt.solve(x), MatD(a.llt().solve(b)));
+    Equal(llt.solve(X), MatD(a.llt().solve(B)));
+
+    llt.solveInPlace(X);
+    Equal(X, MatD(a.llt().solve(B)));
+
+    // factorize by moving in the matrix
+    llt.compute(std::move(A));
+    Equal(llt.solve(x), MatD(a.llt().solve(b)));
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "cholesky: not positive definite" )
+{
+  MatD a = makeQuasiDefinite(11);
+
+  sMat A = sMat::CopyDense(11, 11, a.data(), a.data()+a.size());
+
+  REQUIRE_THROWS_AS( cppmat::symmetric::cholesky<double>(A), std::domain_error );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "ldlt" )
+{
+  for ( size_t n : {size_t(1), size_t(11), size_t(200)} )
+  {
+    MatD a = makeQuasiDefinite(n);
+    MatD b = MatD::Random(n,1);
+    MatD B = MatD::Random(n,40);
+
+    sMat A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+
+    cppmat::symmetric::ldlt<double> ldlt(A);
+
+    // factors
+    MatD u = MatD::Identity(n,n);
+    MatD d = MatD::Zero(n,n);
+
+    for ( size_t i = 0 ; i < n ; ++i ) {
+      d(i,i) = ldlt.factor()(i,i);
+      for ( size_t j = i+1 ; j < n ; ++j )
+        u(i,j) = ldlt.factor()(i,j);
+    }
+
+    Equal(A, MatD(u.transpose() * d * u));
+
+    REQUIRE_THAT( ldlt.determinant(), Catch::WithinRel(a.determinant(), 1.e-8) );
+
+    // solve
+    cppmat::vector<double> x = cppmat::vector<double>::Copy(n, b.data(), b.data()+b.size());
+    cppmat::matrix<double> X = cppmat::matrix<double>::Copy(n, 40, B.data(), B.data()+B.size());
+
+    Equal(ldlt.solve(x), MatD(a.lu().solve(b)));
+    Equal(ldlt.solve(X), MatD(a.lu().solve(B)));
+
+    ldlt.solveInPlace(X);
+    Equal(X, MatD(a.lu().solve(B)));
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "ldlt: singular" )
+{
+  MatD a = makeSymmetric(MatD::Random(11,11));
+
+  a(0,0) = 0.;
+
+  sMat A = sMat::CopyDense(11, 11, a.data(), a.data()+a.size());
+
+  REQUIRE_THROWS_AS( cppmat::symmetric::ldlt<double>(A), std::domain_error );
+}
+
+// =================================================================================================
+
+}
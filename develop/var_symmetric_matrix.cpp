@@ -529,6 +529,85 @@ SECTION( "abs" )
   Equal(C, c);
 }
 
+// =================================================================================================
+// products (small, and large enough to be blocked, or to run in parallel)
+// =================================================================================================
+
+SECTION( "matrix.dot(matrix)" )
+{
+  for ( size_t n : {N, size_t(130)} )
+  {
+    MatD a = makeSymmetric(MatD::Random(n,n));
+    MatD b = MatD::Random(n,70);
+
+    sMat A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+
+    cppmat::matrix<double> B = cppmat::matrix<double>::Copy(n, 70, b.data(), b.data()+b.size());
+
+    Equal(A.dot(B), MatD(a * b));
+    Equal(cppmat::symmetric::matmul(A, B), MatD(a * b));
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "matrix.dot(vector), matrix.quadratic(vector)" )
+{
+  for ( size_t n : {N, size_t(300)} )
+  {
+    MatD a = makeSymmetric(MatD::Random(n,n));
+    MatD b = MatD::Random(n,1);
+
+    sMat A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+
+    cppmat::vector<double> B = cppmat::vector<double>::Copy(n, b.data(), b.data()+b.size());
+
+    Equal(A.dot(B), MatD(a * b));
+    Equal(cppmat::symmetric::matvec(A, B), MatD(a * b));
+
+    EQ( A.quadratic(B), ( b.transpose() * a * b )(0,0) );
+    EQ( cppmat::symmetric::quadratic(A, B), ( b.transpose() * a * b )(0,0) );
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+SECTION( "matrix.rankUpdate(...)" )
+{
+  for ( size_t n : {N, size_t(250)} )
+  {
+    MatD a = makeSymmetric(MatD::Random(n,n));
+    MatD b = MatD::Random(n,40);
+    MatD c = MatD::Random(n,40);
+
+    cppmat::matrix<double> B = cppmat::matrix<double>::Copy(n, 40, b.data(), b.data()+b.size());
+    cppmat::matrix<double> C = cppmat::matrix<double>::Copy(n, 40, c.data(), c.data()+c.size());
+
+    cppmat::vector<double> x = cppmat::vector<double>::Copy(n, b.data(), b.data()+n);
+    MatD                   X = Eigen::Map<ColD>(b.data(), n);
+
+    // rank-1
+    sMat A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+    A.rankUpdate(x, 2.);
+    Equal(A, MatD(a + 2. * X * X.transpose()));
+
+    // rank-k
+    A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+    A.rankUpdate(B, 2., .5);
+    Equal(A, MatD(2. * b * b.transpose() + .5 * a));
+
+    // rank-k: "beta == 0" does not read the current entries
+    A.setConstant(std::numeric_limits<double>::quiet_NaN());
+    A.rankUpdate(B, 1., 0.);
+    Equal(A, MatD(b * b.transpose()));
+
+    // rank-2k
+    A = sMat::CopyDense(n, n, a.data(), a.data()+a.size());
+    A.rankUpdate(B, C, 2., .5);
+    Equal(A, MatD(2. * ( b * c.transpose() + c * b.transpose() ) + .5 * a));
+  }
+}
+
 // =================================================================================================
 // index operators
 // =================================================================================================
@@ -34,8 +34,20 @@ setup(
     'src/cppmat/private.h',
     'src/cppmat/stl.hpp',
     'src/cppmat/stl.h',
+    'src/cppmat/allocator.hpp',
+    'src/cppmat/allocator.h',
+    'src/cppmat/small_vector.hpp',
+    'src/cppmat/small_vector.h',
+    'src/cppmat/parallel.hpp',
+    'src/cppmat/parallel.h',
+    'src/cppmat/random.hpp',
+    'src/cppmat/random.h',
     'src/cppmat/histogram.hpp',
     'src/cppmat/histogram.h',
+    'src/cppmat/histogram_nd.hpp',
+    'src/cppmat/histogram_nd.h',
+    'src/cppmat/expression.hpp',
+    'src/cppmat/expression.h',
     'src/cppmat/fix_cartesian.hpp',
     'src/cppmat/fix_cartesian.h',
     'src/cppmat/fix_cartesian_2.hpp',
@@ -48,6 +60,8 @@ setup(
     'src/cppmat/fix_cartesian_tensor2s.h',
     'src/cppmat/fix_cartesian_tensor4.hpp',
     'src/cppmat/fix_cartesian_tensor4.h',
+    'src/cppmat/fix_cartesian_tensor4s.hpp',
+    'src/cppmat/fix_cartesian_tensor4s.h',
     'src/cppmat/fix_cartesian_vector.hpp',
     'src/cppmat/fix_cartesian_vector.h',
     'src/cppmat/fix_diagonal_matrix.hpp',
@@ -60,6 +74,8 @@ setup(
     'src/cppmat/fix_regular_matrix.h',
     'src/cppmat/fix_regular_vector.hpp',
     'src/cppmat/fix_regular_vector.h',
+    'src/cppmat/fix_symmetric_cholesky.hpp',
+    'src/cppmat/fix_symmetric_cholesky.h',
     'src/cppmat/fix_symmetric_matrix.hpp',
     'src/cppmat/fix_symmetric_matrix.h',
     'src/cppmat/map_cartesian_tensor2.hpp',
@@ -70,6 +86,8 @@ setup(
     'src/cppmat/map_cartesian_tensor2s.h',
     'src/cppmat/map_cartesian_tensor4.hpp',
     'src/cppmat/map_cartesian_tensor4.h',
+    'src/cppmat/map_cartesian_tensor4s.hpp',
+    'src/cppmat/map_cartesian_tensor4s.h',
     'src/cppmat/map_cartesian_vector.hpp',
     'src/cppmat/map_cartesian_vector.h',
     'src/cppmat/map_diagonal_matrix.hpp',
@@ -80,6 +98,8 @@ setup(
     'src/cppmat/map_regular_matrix.h',
     'src/cppmat/map_regular_vector.hpp',
     'src/cppmat/map_regular_vector.h',
+    'src/cppmat/map_strided_array.hpp',
+    'src/cppmat/map_strided_array.h',
     'src/cppmat/map_symmetric_matrix.hpp',
     'src/cppmat/map_symmetric_matrix.h',
     'src/cppmat/var_cartesian.hpp',
@@ -92,8 +112,13 @@ setup(
     'src/cppmat/var_cartesian_tensor2s.h',
     'src/cppmat/var_cartesian_tensor4.hpp',
     'src/cppmat/var_cartesian_tensor4.h',
+    'src/cppmat/var_cartesian_tensor4s.hpp',
+    'src/cppmat/var_cartesian_tensor4s.h',
     'src/cppmat/var_cartesian_vector.hpp',
     'src/cppmat/var_cartesian_vector.h',
+    'src/cppmat/var_cartesian_field.hpp',
+    'src/cppmat/var_cartesian_field.h',
+    'src/cppmat/var_cartesian_field_batch.hpp',
     'src/cppmat/var_diagonal_matrix.hpp',
     'src/cppmat/var_diagonal_matrix.h',
     'src/cppmat/var_misc_matrix.hpp',
@@ -104,9 +129,12 @@ setup(
     'src/cppmat/var_regular_matrix.h',
     'src/cppmat/var_regular_vector.hpp',
     'src/cppmat/var_regular_vector.h',
+    'src/cppmat/var_symmetric_cholesky.hpp',
+    'src/cppmat/var_symmetric_cholesky.h',
     'src/cppmat/var_symmetric_matrix.hpp',
     'src/cppmat/var_symmetric_matrix.h',
     'src/cppmat/pybind11.h',
+    'src/cppmat/pybind11_cartesian.hpp',
     'src/cppmat/pybind11_fix_cartesian_tensor2.hpp',
     'src/cppmat/pybind11_fix_cartesian_tensor2d.hpp',
     'src/cppmat/pybind11_fix_cartesian_tensor2s.hpp',
@@ -117,6 +145,14 @@ setup(
     'src/cppmat/pybind11_fix_regular_matrix.hpp',
     'src/cppmat/pybind11_fix_regular_vector.hpp',
     'src/cppmat/pybind11_fix_symmetric_matrix.hpp',
+    'src/cppmat/pybind11_map_cartesian_tensor2.hpp',
+    'src/cppmat/pybind11_map_cartesian_tensor4.hpp',
+    'src/cppmat/pybind11_map_cartesian_vector.hpp',
+    'src/cppmat/pybind11_map_regular_array.hpp',
+    'src/cppmat/pybind11_map_regular_matrix.hpp',
+    'src/cppmat/pybind11_map_regular_vector.hpp',
+    'src/cppmat/pybind11_map_strided_array.hpp',
+    'src/cppmat/pybind11_private.hpp',
     'src/cppmat/pybind11_var_cartesian_tensor2.hpp',
     'src/cppmat/pybind11_var_cartesian_tensor2d.hpp',
     'src/cppmat/pybind11_var_cartesian_tensor2s.hpp',
@@ -0,0 +1,248 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_ALLOCATOR_H
+#define CPPMAT_ALLOCATOR_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace memory {
+
+// =================================================================================================
+// cppmat::memory::resource - source of the storage of the dynamically sized classes
+// - the resource is selected per thread (see "scope" below), by default the heap is used
+// - the storage remembers its resource: it is always returned to the resource that allocated it
+//   (also when it is freed after the resource is no longer selected)
+// =================================================================================================
+
+class resource
+{
+public:
+
+  virtual ~resource() = default;
+
+  // allocate "bytes" aligned to "align" bytes (a power of two), or throw "std::bad_alloc"
+  virtual void* allocate(size_t bytes, size_t align) = 0;
+
+  // return memory obtained from "allocate(bytes, align)"
+  virtual void deallocate(void *p, size_t bytes, size_t align) = 0;
+};
+
+// =================================================================================================
+// cppmat::memory::heap - "new" and "delete" (thread-safe)
+// =================================================================================================
+
+class heap : public resource
+{
+public:
+
+  void* allocate  (size_t bytes, size_t align) override;
+  void  deallocate(void *p, size_t bytes, size_t align) override;
+};
+
+// =================================================================================================
+// cppmat::memory::arena - bump allocator, e.g. for the temporaries of one time-step
+// - memory is taken from large chunks, and is reclaimed by "reset()"; in addition the most recent
+//   allocation is reclaimed when it is freed, and the current chunk is reused once all storage
+//   allocated from it has been freed
+// - "reset()" makes all chunks available again, except chunks that still hold storage that has not
+//   been freed: these are skipped until that storage has been freed (it thus remains valid)
+// - not thread-safe: use one arena per thread
+// =================================================================================================
+
+class arena : public resource
+{
+private:
+
+  struct chunk { char *data; size_t size; size_t align; size_t live; bool pinned; };
+
+  std::vector<chunk> mChunks;    // chunks obtained from "mUpstream"
+  size_t             mChunk;     // (minimal) size of a chunk [bytes]
+  size_t             mIndex=0;   // chunk that is currently used
+  size_t             mOffset=0;  // bytes used of the current chunk
+  resource          *mUpstream;  // source of the chunks
+
+public:
+
+  // constructor: chunks of (at least) "chunk" bytes, obtained from "upstream" (default: the heap)
+  arena(size_t chunk=1048576, resource *upstream=nullptr);
+
+  // return all chunks to "upstream"
+  ~arena();
+
+  // no copies
+  arena(const arena &) = delete;
+  arena& operator=(const arena &) = delete;
+
+  // allocate/deallocate
+  void* allocate  (size_t bytes, size_t align) override;
+  void  deallocate(void *p, size_t bytes, size_t align) override;
+
+  // make all memory available again (the chunks are kept), except chunks with storage in use
+  void reset();
+
+  // return all chunks to "upstream"
+  void release();
+
+  // bytes used since the last "reset()" (including padding), and the total size of the chunks
+  size_t used() const;
+  size_t capacity() const;
+};
+
+// =================================================================================================
+// cppmat::memory::pool - recycle blocks of equal size, e.g. for many short-lived small objects
+// - requests up to "max_block" bytes are rounded up to a multiple of "CPPMAT_ALIGN", and served from
+//   a list of free blocks of that size (refilled by chunks from "upstream"), larger requests are
+//   passed to "upstream"
+// - freed blocks are kept for reuse, they are only returned to "upstream" by "release()"
+// - not thread-safe: use one pool per thread
+// =================================================================================================
+
+class pool : public resource
+{
+private:
+
+  size_t              mMaxBlock;  // largest block taken from the pool [bytes]
+  size_t              mChunk;     // (minimal) size of a chunk [bytes]
+  std::vector<void*>  mFree;      // free list per block size ("(i+1)*CPPMAT_ALIGN" bytes)
+  std::vector<void*>  mChunks;    // chunks obtained from "mUpstream"
+  std::vector<size_t> mSizes;     // size of each chunk
+  resource           *mUpstream;  // source of the chunks, and of large blocks
+
+public:
+
+  // constructor: see above
+  pool(size_t max_block=4096, size_t chunk=65536, resource *upstream=nullptr);
+
+  // return all chunks to "upstream"
+  ~pool();
+
+  // no copies
+  pool(const pool &) = delete;
+  pool& operator=(const pool &) = delete;
+
+  // allocate/deallocate
+  void* allocate  (size_t bytes, size_t align) override;
+  void  deallocate(void *p, size_t bytes, size_t align) override;
+
+  // return all chunks to "upstream" (all storage obtained from the pool must be freed before that)
+  void release();
+
+  // total size of the chunks
+  size_t capacity() const;
+};
+
+// =================================================================================================
+// selection of the resource of the current thread
+// =================================================================================================
+
+// the heap (a global instance)
+resource* heap_resource();
+
+// resource that is used by the current thread (default: the heap)
+resource* get();
+
+// use "r" in the current thread ("nullptr": the default), returns the previous resource
+resource* set(resource *r);
+
+// use a resource in the current thread until the end of the scope, for example:
+//
+//   cppmat::memory::arena arena;
+//
+//   for ( ... ) {
+//     arena.reset();
+//     cppmat::memory::scope scope(arena);
+//     ... // temporaries are allocated from the arena
+//   }
+class scope
+{
+private:
+
+  resource *mPrevious;
+
+public:
+
+  scope(resource &r);
+  ~scope();
+
+  scope(const scope &) = delete;
+  scope& operator=(const scope &) = delete;
+};
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+
+// resource that is selected in the current thread ("nullptr" for the default)
+memory::resource*& memory_current();
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::aligned_allocator - allocate memory aligned to "ALIGN" bytes (e.g. to a cache line), from
+// the resource of the current thread (see "cppmat::memory")
+// - all instances are interchangeable: storage is returned to the resource that allocated it
+// =================================================================================================
+
+template<typename X, size_t ALIGN=CPPMAT_ALIGN>
+class aligned_allocator
+{
+  static_assert( ALIGN >= alignof(void*) && ( ALIGN & (ALIGN-1) ) == 0, "Invalid alignment" );
+
+public:
+
+  typedef X         value_type;
+  typedef X*        pointer;
+  typedef const X*  const_pointer;
+  typedef X&        reference;
+  typedef const X&  const_reference;
+  typedef size_t    size_type;
+  typedef ptrdiff_t difference_type;
+
+  // convert to allocator of different type
+  template<typename U> struct rebind { typedef aligned_allocator<U,ALIGN> other; };
+
+  // constructors
+  aligned_allocator() = default;
+  template<typename U> aligned_allocator(const aligned_allocator<U,ALIGN> &);
+
+  // allocate/deallocate "n" entries
+  X*   allocate  (size_t n);
+  void deallocate(X *p, size_t n);
+};
+
+// comparison: all instances are interchangeable
+template<typename X, typename U, size_t ALIGN>
+bool operator== (const aligned_allocator<X,ALIGN> &, const aligned_allocator<U,ALIGN> &);
+
+template<typename X, typename U, size_t ALIGN>
+bool operator!= (const aligned_allocator<X,ALIGN> &, const aligned_allocator<U,ALIGN> &);
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
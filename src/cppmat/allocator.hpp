@@ -0,0 +1,454 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_ALLOCATOR_HPP
+#define CPPMAT_ALLOCATOR_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace memory {
+
+// =================================================================================================
+// cppmat::memory::heap
+// =================================================================================================
+
+inline
+void* heap::allocate(size_t bytes, size_t align)
+{
+  if ( bytes > std::numeric_limits<size_t>::max() - align - sizeof(void*) ) throw std::bad_alloc();
+
+  // allocate with sufficient padding to align, and to store the original pointer
+  void *raw = ::operator new(bytes + align + sizeof(void*));
+
+  // align, leaving space for the original pointer
+  std::uintptr_t ptr = ( reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + align - 1 ) & ~( align - 1 );
+
+  // store the original pointer just before the aligned memory
+  reinterpret_cast<void**>(ptr)[-1] = raw;
+
+  return reinterpret_cast<void*>(ptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void heap::deallocate(void *p, size_t bytes, size_t align)
+{
+  UNUSED(bytes);
+  UNUSED(align);
+
+  ::operator delete(reinterpret_cast<void**>(p)[-1]);
+}
+
+// =================================================================================================
+// cppmat::memory::arena
+// =================================================================================================
+
+inline
+arena::arena(size_t chunk, resource *upstream) :
+  mChunk(chunk), mUpstream(upstream ? upstream : heap_resource())
+{
+  Assert( chunk > 0 );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+arena::~arena()
+{
+  release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void* arena::allocate(size_t bytes, size_t align)
+{
+  // first chunk (starting from the current chunk) in which the aligned block fits
+  for ( ; mIndex < mChunks.size() ; ++mIndex, mOffset = 0 )
+  {
+    // skip chunks with storage from before the last "reset()"
+    if ( mChunks[mIndex].pinned ) continue;
+
+    std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(mChunks[mIndex].data);
+    std::uintptr_t ptr   = ( begin + mOffset + align - 1 ) & ~( align - 1 );
+
+    if ( ptr + bytes <= begin + mChunks[mIndex].size )
+    {
+      mOffset = ptr + bytes - begin;
+      mChunks[mIndex].live++;
+      return reinterpret_cast<void*>(ptr);
+    }
+  }
+
+  // new chunk
+  if ( bytes > std::numeric_limits<size_t>::max() - align ) throw std::bad_alloc();
+
+  size_t size = std::max(mChunk, bytes + align);
+
+  mChunks.reserve(mChunks.size()+1);
+  mChunks.push_back({static_cast<char*>(mUpstream->allocate(size, align)), size, align, 1, false});
+
+  mIndex  = mChunks.size()-1;
+  mOffset = bytes;
+
+  return mChunks[mIndex].data;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void arena::deallocate(void *p, size_t bytes, size_t align)
+{
+  UNUSED(align);
+
+  if ( mChunks.empty() ) return;
+
+  char *ptr = static_cast<char*>(p);
+
+  // chunk that contains "p" (most likely the current chunk)
+  size_t i = std::min(mIndex, mChunks.size()-1);
+
+  if ( ptr < mChunks[i].data or ptr >= mChunks[i].data + mChunks[i].size )
+    for ( i = 0 ; i < mChunks.size() ; ++i )
+      if ( ptr >= mChunks[i].data and ptr < mChunks[i].data + mChunks[i].size )
+        break;
+
+  if ( i >= mChunks.size() or mChunks[i].live == 0 ) return;
+
+  mChunks[i].live--;
+
+  // storage from before the last "reset()": the chunk is available again at the next "reset()"
+  if ( i != mIndex or mChunks[i].pinned ) return;
+
+  // reuse the current chunk if all its storage has been freed, or reclaim the most recent allocation
+  if      ( mChunks[i].live == 0                    ) mOffset = 0;
+  else if ( ptr + bytes == mChunks[i].data + mOffset ) mOffset = static_cast<size_t>( ptr - mChunks[i].data );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void arena::reset()
+{
+  // chunks that still hold storage are kept aside, until all that storage has been freed
+  for ( auto &i : mChunks )
+    i.pinned = ( i.live > 0 );
+
+  mIndex  = 0;
+  mOffset = 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void arena::release()
+{
+  for ( auto &i : mChunks )
+    mUpstream->deallocate(i.data, i.size, i.align);
+
+  mChunks.clear();
+
+  reset();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t arena::used() const
+{
+  size_t out = 0;
+
+  for ( size_t i = 0 ; i < std::min(mIndex, mChunks.size()) ; ++i )
+    out += mChunks[i].size;
+
+  if ( mIndex < mChunks.size() ) out += mOffset;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t arena::capacity() const
+{
+  size_t out = 0;
+
+  for ( auto &i : mChunks )
+    out += i.size;
+
+  return out;
+}
+
+// =================================================================================================
+// cppmat::memory::pool
+// =================================================================================================
+
+inline
+pool::pool(size_t max_block, size_t chunk, resource *upstream) :
+  mMaxBlock(max_block), mChunk(chunk), mUpstream(upstream ? upstream : heap_resource())
+{
+  Assert( max_block > 0 );
+
+  mFree.resize( ( max_block - 1 ) / CPPMAT_ALIGN + 1, nullptr );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+pool::~pool()
+{
+  release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void* pool::allocate(size_t bytes, size_t align)
+{
+  // large or over-aligned block: pass to "upstream"
+  if ( bytes > mMaxBlock or align > CPPMAT_ALIGN ) return mUpstream->allocate(bytes, align);
+
+  // block size: "(i+1)*CPPMAT_ALIGN" bytes
+  size_t i = ( std::max(bytes, size_t(1)) - 1 ) / CPPMAT_ALIGN;
+
+  // no free block: split a new chunk in blocks
+  if ( mFree[i] == nullptr )
+  {
+    size_t block = ( i + 1 ) * CPPMAT_ALIGN;
+    size_t n     = std::max(mChunk / block, size_t(1));
+
+    mChunks.reserve(mChunks.size()+1);
+    mSizes .reserve(mSizes .size()+1);
+
+    char *data = static_cast<char*>(mUpstream->allocate(n * block, CPPMAT_ALIGN));
+
+    mChunks.push_back(data);
+    mSizes .push_back(n * block);
+
+    for ( size_t j = n ; j-- > 0 ; )
+    {
+      *reinterpret_cast<void**>(data + j * block) = mFree[i];
+      mFree[i] = data + j * block;
+    }
+  }
+
+  // take the first free block
+  void *out = mFree[i];
+
+  mFree[i] = *reinterpret_cast<void**>(out);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void pool::deallocate(void *p, size_t bytes, size_t align)
+{
+  if ( bytes > mMaxBlock or align > CPPMAT_ALIGN ) return mUpstream->deallocate(p, bytes, align);
+
+  size_t i = ( std::max(bytes, size_t(1)) - 1 ) / CPPMAT_ALIGN;
+
+  *reinterpret_cast<void**>(p) = mFree[i];
+
+  mFree[i] = p;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void pool::release()
+{
+  for ( size_t i = 0 ; i < mChunks.size() ; ++i )
+    mUpstream->deallocate(mChunks[i], mSizes[i], CPPMAT_ALIGN);
+
+  mChunks.clear();
+  mSizes .clear();
+
+  std::fill(mFree.begin(), mFree.end(), nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t pool::capacity() const
+{
+  return std::accumulate(mSizes.begin(), mSizes.end(), size_t(0));
+}
+
+// =================================================================================================
+// selection of the resource of the current thread
+// =================================================================================================
+
+inline
+resource* heap_resource()
+{
+  static heap out;
+
+  return &out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+resource* get()
+{
+  resource *out = Private::memory_current();
+
+  return out ? out : heap_resource();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+resource* set(resource *r)
+{
+  resource *out = Private::memory_current();
+
+  Private::memory_current() = r;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+scope::scope(resource &r) : mPrevious(set(&r))
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+scope::~scope()
+{
+  set(mPrevious);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+
+inline
+memory::resource*& memory_current()
+{
+  static thread_local memory::resource *out = nullptr;
+
+  return out;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::aligned_allocator
+// - the resource that allocated the storage is stored just before the aligned storage (a
+//   "nullptr" for the default, for which the original pointer is stored before that)
+// =================================================================================================
+
+template<typename X, size_t ALIGN>
+template<typename U>
+inline
+aligned_allocator<X,ALIGN>::aligned_allocator(const aligned_allocator<U,ALIGN> &)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ALIGN>
+inline
+X* aligned_allocator<X,ALIGN>::allocate(size_t n)
+{
+  if ( n == 0 ) return nullptr;
+
+  if ( n > ( std::numeric_limits<size_t>::max() - ALIGN - 2*sizeof(void*) ) / sizeof(X) )
+    throw std::bad_alloc();
+
+  memory::resource *r = Private::memory_current();
+
+  // default: "new" with sufficient padding to align, and to store the original pointer
+  if ( r == nullptr )
+  {
+    void *raw = ::operator new(n * sizeof(X) + ALIGN + 2*sizeof(void*));
+
+    std::uintptr_t ptr = ( reinterpret_cast<std::uintptr_t>(raw) + 2*sizeof(void*) + ALIGN - 1 ) & ~( ALIGN - 1 );
+
+    reinterpret_cast<void**>(ptr)[-1] = nullptr;
+    reinterpret_cast<void**>(ptr)[-2] = raw;
+
+    return reinterpret_cast<X*>(ptr);
+  }
+
+  // resource: store the resource in front of the storage
+  char *ptr = static_cast<char*>(r->allocate(n * sizeof(X) + ALIGN, ALIGN)) + ALIGN;
+
+  reinterpret_cast<memory::resource**>(ptr)[-1] = r;
+
+  return reinterpret_cast<X*>(ptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ALIGN>
+inline
+void aligned_allocator<X,ALIGN>::deallocate(X *p, size_t n)
+{
+  if ( p == nullptr ) return;
+
+  memory::resource *r = reinterpret_cast<memory::resource**>(p)[-1];
+
+  if ( r == nullptr )
+  {
+    ::operator delete(reinterpret_cast<void**>(p)[-2]);
+    return;
+  }
+
+  r->deallocate(reinterpret_cast<char*>(p) - ALIGN, n * sizeof(X) + ALIGN, ALIGN);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename U, size_t ALIGN>
+inline
+bool operator== (const aligned_allocator<X,ALIGN> &, const aligned_allocator<U,ALIGN> &)
+{
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename U, size_t ALIGN>
+inline
+bool operator!= (const aligned_allocator<X,ALIGN> &, const aligned_allocator<U,ALIGN> &)
+{
+  return false;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
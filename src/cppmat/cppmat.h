@@ -10,15 +10,24 @@
 // =================================================================================================
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <memory>
+#include <new>
 #include <string>
 #include <vector>
 #include <numeric>
 #include <random>
+#include <stdexcept>
 #include <ctime>
+#include <type_traits>
 #include <iso646.h> // to fix a Microsoft Visual Studio error on "and" and "or"
 
 // =================================================================================================
@@ -44,6 +53,72 @@
 
 // -------------------------------------------------------------------------------------------------
 
+// alignment (in bytes) of the storage of the dynamically sized classes (default: a cache line)
+#ifndef CPPMAT_ALIGN
+  #define CPPMAT_ALIGN 64
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+// number of tensors processed together by the batched kernels of "cppmat::cartesian::field"
+// (a block that is long enough to amortize the many components of a tensor4, while the partial
+// results of the block remain in the L1 cache)
+#ifndef CPPMAT_BATCH
+  #define CPPMAT_BATCH 256
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+// hint that a loop over plain storage has no loop-carried dependencies, and should be vectorized
+// (uses "#pragma omp simd" with "-fopenmp", or with "-fopenmp-simd -DCPPMAT_OPENMP_SIMD")
+#if defined(CPPMAT_NO_SIMD)
+  #define CPPMAT_SIMD
+#elif defined(_OPENMP) || defined(CPPMAT_OPENMP_SIMD)
+  #define CPPMAT_SIMD _Pragma("omp simd")
+#elif defined(__clang__)
+  #define CPPMAT_SIMD _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined(__GNUC__)
+  #define CPPMAT_SIMD _Pragma("GCC ivdep")
+#else
+  #define CPPMAT_SIMD
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+// width (in bytes) of a SIMD register, sets the size of the register-blocked matrix-product kernels
+// (default: derived from the target, e.g. "-march=native")
+#ifndef CPPMAT_SIMD_BYTES
+  #if defined(__AVX512F__)
+    #define CPPMAT_SIMD_BYTES 64
+  #elif defined(__AVX__)
+    #define CPPMAT_SIMD_BYTES 32
+  #else
+    #define CPPMAT_SIMD_BYTES 16
+  #endif
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+// multithreading of operations on the entire storage, opt-in: compile with "-fopenmp -DCPPMAT_PARALLEL"
+// - "CPPMAT_PARALLEL_THRESHOLD": default minimal number of entries to run in parallel
+// - "CPPMAT_PARALLEL_BLOCK": number of entries per block of a reduction (fixes the order of summation)
+#ifdef CPPMAT_PARALLEL
+  #ifndef _OPENMP
+    #error "CPPMAT_PARALLEL requires OpenMP, e.g. compile with '-fopenmp'"
+  #endif
+  #include <omp.h>
+#endif
+
+#ifndef CPPMAT_PARALLEL_THRESHOLD
+  #define CPPMAT_PARALLEL_THRESHOLD 32768
+#endif
+
+#ifndef CPPMAT_PARALLEL_BLOCK
+  #define CPPMAT_PARALLEL_BLOCK 8192
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
 #ifndef NDEBUG
 
   #define Assert(x) assert(x)
@@ -71,6 +146,8 @@ namespace cppmat {
 namespace symmetric {
 
   template<typename X> class matrix;
+  template<typename X> class cholesky;
+  template<typename X> class ldlt;
 
 }}
 
@@ -89,10 +166,12 @@ namespace cppmat {
 namespace cartesian {
 
   template<typename X> class tensor4;
+  template<typename X> class tensor4s;
   template<typename X> class tensor2;
   template<typename X> class tensor2s;
   template<typename X> class tensor2d;
   template<typename X> class vector;
+  template<class T> class field;
 
 }}
 
@@ -114,6 +193,8 @@ namespace tiny {
 namespace symmetric {
 
   template<typename X, size_t M, size_t N=M> class matrix;
+  template<typename X, size_t N> class cholesky;
+  template<typename X, size_t N> class ldlt;
 
 }}}
 
@@ -134,6 +215,7 @@ namespace tiny {
 namespace cartesian {
 
   template<typename X, size_t ND> class tensor4;
+  template<typename X, size_t ND> class tensor4s;
   template<typename X, size_t ND> class tensor2;
   template<typename X, size_t ND> class tensor2s;
   template<typename X, size_t ND> class tensor2d;
@@ -149,6 +231,7 @@ namespace view {
   template<typename X, size_t RANK, size_t I, size_t J=1, size_t K=1, size_t L=1, size_t M=1, size_t N=1> class array;
   template<typename X, size_t M, size_t N> class matrix;
   template<typename X, size_t M> class vector;
+  template<typename X> class strided;
 
 }}
 
@@ -179,6 +262,7 @@ namespace view {
 namespace cartesian {
 
   template<typename X, size_t ND> class tensor4;
+  template<typename X, size_t ND> class tensor4s;
   template<typename X, size_t ND> class tensor2;
   template<typename X, size_t ND> class tensor2s;
   template<typename X, size_t ND> class tensor2d;
@@ -189,30 +273,40 @@ namespace cartesian {
 // =================================================================================================
 
 #include "stl.h"
+#include "allocator.h"
+#include "small_vector.h"
+#include "parallel.h"
+#include "random.h"
 #include "private.h"
 #include "histogram.h"
+#include "expression.h"
 
 #include "var_regular_array.h"
 #include "var_regular_matrix.h"
 #include "var_regular_vector.h"
 #include "var_symmetric_matrix.h"
+#include "var_symmetric_cholesky.h"
 #include "var_diagonal_matrix.h"
 #include "var_misc_matrix.h"
 #include "var_cartesian.h"
 #include "var_cartesian_tensor4.h"
+#include "var_cartesian_tensor4s.h"
 #include "var_cartesian_tensor2.h"
 #include "var_cartesian_tensor2s.h"
 #include "var_cartesian_tensor2d.h"
 #include "var_cartesian_vector.h"
+#include "var_cartesian_field.h"
 
 #include "fix_regular_array.h"
 #include "fix_regular_matrix.h"
 #include "fix_regular_vector.h"
 #include "fix_symmetric_matrix.h"
+#include "fix_symmetric_cholesky.h"
 #include "fix_diagonal_matrix.h"
 #include "fix_misc_matrix.h"
 #include "fix_cartesian.h"
 #include "fix_cartesian_tensor4.h"
+#include "fix_cartesian_tensor4s.h"
 #include "fix_cartesian_tensor2.h"
 #include "fix_cartesian_tensor2s.h"
 #include "fix_cartesian_tensor2d.h"
@@ -224,38 +318,53 @@ namespace cartesian {
 #include "map_symmetric_matrix.h"
 #include "map_diagonal_matrix.h"
 #include "map_cartesian_tensor4.h"
+#include "map_cartesian_tensor4s.h"
 #include "map_cartesian_tensor2.h"
 #include "map_cartesian_tensor2s.h"
 #include "map_cartesian_tensor2d.h"
 #include "map_cartesian_vector.h"
+#include "map_strided_array.h"
+
+#include "histogram_nd.h"
 
 #include "stl.hpp"
+#include "allocator.hpp"
+#include "small_vector.hpp"
+#include "parallel.hpp"
+#include "random.hpp"
 #include "private.hpp"
 #include "histogram.hpp"
+#include "expression.hpp"
 
 #include "var_regular_array.hpp"
 #include "var_regular_matrix.hpp"
 #include "var_regular_vector.hpp"
 #include "var_symmetric_matrix.hpp"
+#include "var_symmetric_cholesky.hpp"
 #include "var_diagonal_matrix.hpp"
 #include "var_misc_matrix.hpp"
 #include "var_cartesian.hpp"
 #include "var_cartesian_tensor4.hpp"
+#include "var_cartesian_tensor4s.hpp"
 #include "var_cartesian_tensor2.hpp"
 #include "var_cartesian_tensor2s.hpp"
 #include "var_cartesian_tensor2d.hpp"
 #include "var_cartesian_vector.hpp"
+#include "var_cartesian_field_batch.hpp"
+#include "var_cartesian_field.hpp"
 
 #include "fix_regular_array.hpp"
 #include "fix_regular_matrix.hpp"
 #include "fix_regular_vector.hpp"
 #include "fix_symmetric_matrix.hpp"
+#include "fix_symmetric_cholesky.hpp"
 #include "fix_diagonal_matrix.hpp"
 #include "fix_misc_matrix.hpp"
 #include "fix_cartesian.hpp"
 #include "fix_cartesian_2.hpp"
 #include "fix_cartesian_3.hpp"
 #include "fix_cartesian_tensor4.hpp"
+#include "fix_cartesian_tensor4s.hpp"
 #include "fix_cartesian_tensor2.hpp"
 #include "fix_cartesian_tensor2s.hpp"
 #include "fix_cartesian_tensor2d.hpp"
@@ -267,10 +376,14 @@ namespace cartesian {
 #include "map_symmetric_matrix.hpp"
 #include "map_diagonal_matrix.hpp"
 #include "map_cartesian_tensor4.hpp"
+#include "map_cartesian_tensor4s.hpp"
 #include "map_cartesian_tensor2.hpp"
 #include "map_cartesian_tensor2s.hpp"
 #include "map_cartesian_tensor2d.hpp"
 #include "map_cartesian_vector.hpp"
+#include "map_strided_array.hpp"
+
+#include "histogram_nd.hpp"
 
 // =================================================================================================
 
@@ -0,0 +1,410 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_EXPRESSION_H
+#define CPPMAT_EXPRESSION_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace expr {
+
+// =================================================================================================
+// tag from which all expressions derive
+// =================================================================================================
+
+struct base {};
+
+// =================================================================================================
+// element-wise operations
+// =================================================================================================
+
+struct plus       { template<typename X> static X apply(const X &a, const X &b); };
+struct minus      { template<typename X> static X apply(const X &a, const X &b); };
+struct multiplies { template<typename X> static X apply(const X &a, const X &b); };
+struct divides    { template<typename X> static X apply(const X &a, const X &b); };
+struct negate     { template<typename X> static X apply(const X &a); };
+
+// =================================================================================================
+// temporary owned by an expression: the entries of a small temporary (up to a 3-d tensor4) are
+// stored inline, i.e. they share the allocation of the "std::shared_ptr" that keeps them alive
+// =================================================================================================
+
+template<typename X>
+class temporary : public cppmat::array<X>
+{
+private:
+
+  static const size_t INLINE=81;
+  cppmat::Private::inline_buffer<X,INLINE> mInline;
+
+public:
+
+  // constructor: take the storage of "A", or copy its entries
+  temporary(cppmat::array<X> &&A);
+
+  // constructor: copy the entries of a fixed size array
+  template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+  temporary(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &A);
+};
+
+// =================================================================================================
+// cppmat::expr::leaf - reference to an operand with contiguous storage
+// =================================================================================================
+
+template<typename X>
+class leaf
+{
+private:
+
+  static const size_t MAX_DIM=6;                   // maximum number of dimensions
+  std::shared_ptr<const cppmat::array<X>> mOwn;    // (only) used to keep a temporary alive
+  const X *mData;                                  // pointer to the data
+  size_t   mSize;                                  // total size
+  size_t   mRank;                                  // rank (number of axes)
+  size_t   mShape[MAX_DIM];                        // number of entries along each axis
+
+  // copy the dimensions of the operand
+  template<typename T> void setShape(const T &A);
+
+public:
+
+  typedef X value_type;
+
+  // mark as non-scalar
+  static const bool is_scalar=false;
+
+  // constructor: reference existing data
+  leaf(const cppmat::array<X> &A);
+
+  // constructor: take ownership of a temporary
+  leaf(cppmat::array<X> &&A);
+
+  // constructor: reference fixed size
+  template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+  leaf(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &A);
+
+  // constructor: copy a temporary fixed size array (its entries are part of the object)
+  template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+  leaf(cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &&A);
+
+  // constructor: reference view (i.e. the external storage, also if the view is a temporary)
+  template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+  leaf(const cppmat::view::array<X,RANK,I,J,K,L,M,N> &A);
+
+  // get dimensions
+  size_t size() const;
+  size_t rank() const;
+  size_t shape(size_t i) const;
+
+  // index operator: access plain storage
+  const X& operator[](size_t i) const;
+};
+
+// =================================================================================================
+// cppmat::expr::scalar - scalar operand (broadcast to every entry)
+// =================================================================================================
+
+template<typename X>
+class scalar
+{
+private:
+
+  X mData; // value
+
+public:
+
+  typedef X value_type;
+
+  // mark as scalar
+  static const bool is_scalar=true;
+
+  // constructor
+  scalar(const X &D);
+
+  // get dimensions (empty)
+  size_t size() const;
+  size_t rank() const;
+  size_t shape(size_t i) const;
+
+  // index operator: return the value for each index
+  const X& operator[](size_t i) const;
+};
+
+// =================================================================================================
+// cppmat::expr::binary - element-wise operation on two operands
+// =================================================================================================
+
+template<typename X, class Op, class Lhs, class Rhs>
+class binary : public cppmat::expr::base
+{
+private:
+
+  Lhs mLhs; // left-hand-side operand
+  Rhs mRhs; // right-hand-side operand
+
+public:
+
+  typedef X value_type;
+
+  // mark as non-scalar
+  static const bool is_scalar=false;
+
+  // constructor
+  binary(const Lhs &A, const Rhs &B);
+
+  // get dimensions
+  size_t size() const;
+  size_t rank() const;
+  size_t shape(size_t i) const;
+  std::vector<size_t> shape() const;
+
+  // index operator: evaluate the expression for one entry of the plain storage
+  X operator[](size_t i) const;
+
+  // index operator: evaluate the expression for one entry, identified by its array-indices
+  // (a negative index counts down from the last index)
+  template<typename... T> X operator()(T... idx) const;
+
+  // evaluate into a new array
+  cppmat::array<X> eval() const;
+
+  // reductions of the entire expression (evaluated without temporary)
+  X sum() const;
+  X min() const;
+  X max() const;
+  X norm() const;
+};
+
+// =================================================================================================
+// cppmat::expr::unary - element-wise operation on one operand
+// =================================================================================================
+
+template<typename X, class Op, class Arg>
+class unary : public cppmat::expr::base
+{
+private:
+
+  Arg mArg; // operand
+
+public:
+
+  typedef X value_type;
+
+  // mark as non-scalar
+  static const bool is_scalar=false;
+
+  // constructor
+  unary(const Arg &A);
+
+  // get dimensions
+  size_t size() const;
+  size_t rank() const;
+  size_t shape(size_t i) const;
+  std::vector<size_t> shape() const;
+
+  // index operator: evaluate the expression for one entry of the plain storage
+  X operator[](size_t i) const;
+
+  // index operator: evaluate the expression for one entry, identified by its array-indices
+  // (a negative index counts down from the last index)
+  template<typename... T> X operator()(T... idx) const;
+
+  // evaluate into a new array
+  cppmat::array<X> eval() const;
+
+  // reductions of the entire expression (evaluated without temporary)
+  X sum() const;
+  X min() const;
+  X max() const;
+  X norm() const;
+};
+
+// =================================================================================================
+// type traits to select the operands that participate in an expression
+// =================================================================================================
+
+template<typename X>
+std::true_type is_var_test(const cppmat::array<X> *);
+std::false_type is_var_test(...);
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+std::true_type is_fix_test(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> *);
+std::false_type is_fix_test(...);
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+std::true_type is_map_test(const cppmat::view::array<X,RANK,I,J,K,L,M,N> *);
+std::false_type is_map_test(...);
+
+// operand is (derived from) "cppmat::array" or is an expression: triggers lazy evaluation
+template<class T>
+struct is_lazy : std::integral_constant<bool,
+  decltype(is_var_test(std::declval<typename std::decay<T>::type*>()))::value ||
+  std::is_base_of<cppmat::expr::base, typename std::decay<T>::type>::value> {};
+
+// operand can be referenced by an expression
+template<class T>
+struct is_operand : std::integral_constant<bool,
+  is_lazy<T>::value ||
+  decltype(is_fix_test(std::declval<typename std::decay<T>::type*>()))::value ||
+  decltype(is_map_test(std::declval<typename std::decay<T>::type*>()))::value> {};
+
+// operand is a scalar
+template<class T>
+struct is_scalar : std::is_arithmetic<typename std::decay<T>::type> {};
+
+// =================================================================================================
+// convert operand to expression node
+// =================================================================================================
+
+template<typename X>
+cppmat::expr::leaf<X> wrap(const cppmat::array<X> &A);
+
+template<typename X>
+cppmat::expr::leaf<X> wrap(cppmat::array<X> &&A);
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+cppmat::expr::leaf<X> wrap(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &A);
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+cppmat::expr::leaf<X> wrap(cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &&A);
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+cppmat::expr::leaf<X> wrap(const cppmat::view::array<X,RANK,I,J,K,L,M,N> &A);
+
+template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+E wrap(const E &A);
+
+// -------------------------------------------------------------------------------------------------
+
+// node type of an operand
+template<class T>
+struct node { typedef decltype(wrap(std::declval<T>())) type; };
+
+// -------------------------------------------------------------------------------------------------
+
+// allowed combination of operands:
+// - at least one should trigger lazy evaluation ("cppmat::array" or expression)
+// - the other operand may also be a fixed size array, a view, or a scalar
+// - the value-type of all non-scalar operands must be the same
+template<class L, class R, class V=void>
+struct is_binary : std::false_type {};
+
+template<class L, class R>
+struct is_binary<L, R, typename std::enable_if<
+  ( is_lazy<L>::value and is_operand<R>::value ) or
+  ( is_lazy<R>::value and is_operand<L>::value )
+>::type> : std::integral_constant<bool, std::is_same<
+  typename node<L>::type::value_type,
+  typename node<R>::type::value_type>::value> {};
+
+template<class L, class R>
+struct is_binary<L, R, typename std::enable_if<
+  is_lazy<L>::value and is_scalar<R>::value
+>::type> : std::true_type {};
+
+template<class L, class R>
+struct is_binary<L, R, typename std::enable_if<
+  is_scalar<L>::value and is_lazy<R>::value
+>::type> : std::true_type {};
+
+// -------------------------------------------------------------------------------------------------
+
+// type of the resulting expression
+template<class Op, class L, class R, class V=void>
+struct binary_type;
+
+template<class Op, class L, class R>
+struct binary_type<Op, L, R, typename std::enable_if<
+  not is_scalar<L>::value and not is_scalar<R>::value>::type>
+{
+  typedef typename node<L>::type Lhs;
+  typedef typename node<R>::type Rhs;
+  typedef cppmat::expr::binary<typename Lhs::value_type, Op, Lhs, Rhs> type;
+};
+
+template<class Op, class L, class R>
+struct binary_type<Op, L, R, typename std::enable_if<is_scalar<R>::value>::type>
+{
+  typedef typename node<L>::type Lhs;
+  typedef cppmat::expr::scalar<typename Lhs::value_type> Rhs;
+  typedef cppmat::expr::binary<typename Lhs::value_type, Op, Lhs, Rhs> type;
+};
+
+template<class Op, class L, class R>
+struct binary_type<Op, L, R, typename std::enable_if<is_scalar<L>::value>::type>
+{
+  typedef typename node<R>::type Rhs;
+  typedef cppmat::expr::scalar<typename Rhs::value_type> Lhs;
+  typedef cppmat::expr::binary<typename Rhs::value_type, Op, Lhs, Rhs> type;
+};
+
+// =================================================================================================
+// element access and reductions of an expression "A" (used by "binary" and "unary")
+// =================================================================================================
+
+// index in the plain storage of the entry with array-indices "idx"
+template<class E> size_t flat_index(const E &A, std::initializer_list<ptrdiff_t> idx);
+
+// reductions: sum, minimum, maximum, sum of absolute values
+template<class E> typename E::value_type reduce_sum (const E &A);
+template<class E> typename E::value_type reduce_min (const E &A);
+template<class E> typename E::value_type reduce_max (const E &A);
+template<class E> typename E::value_type reduce_norm(const E &A);
+
+// =================================================================================================
+// evaluate expression into pre-allocated storage (single loop)
+// =================================================================================================
+
+template<typename X, class E> void assign    (X *data, const E &A);
+template<typename X, class E> void assign_add(X *data, const E &A);
+template<typename X, class E> void assign_sub(X *data, const E &A);
+template<typename X, class E> void assign_mul(X *data, const E &A);
+template<typename X, class E> void assign_div(X *data, const E &A);
+
+// =================================================================================================
+// external arithmetic operators: build expression
+// =================================================================================================
+
+template<class L, class R, typename=typename std::enable_if<cppmat::expr::is_binary<L,R>::value>::type>
+typename cppmat::expr::binary_type<cppmat::expr::multiplies,L,R>::type operator* (L &&A, R &&B);
+
+template<class L, class R, typename=typename std::enable_if<cppmat::expr::is_binary<L,R>::value>::type>
+typename cppmat::expr::binary_type<cppmat::expr::divides,L,R>::type operator/ (L &&A, R &&B);
+
+template<class L, class R, typename=typename std::enable_if<cppmat::expr::is_binary<L,R>::value>::type>
+typename cppmat::expr::binary_type<cppmat::expr::plus,L,R>::type operator+ (L &&A, R &&B);
+
+template<class L, class R, typename=typename std::enable_if<cppmat::expr::is_binary<L,R>::value>::type>
+typename cppmat::expr::binary_type<cppmat::expr::minus,L,R>::type operator- (L &&A, R &&B);
+
+template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+cppmat::expr::unary<typename E::value_type,cppmat::expr::negate,E> operator- (const E &A);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// =================================================================================================
+// make the operators available for "cppmat::array" (and derived classes)
+// =================================================================================================
+
+namespace cppmat {
+
+using cppmat::expr::operator*;
+using cppmat::expr::operator/;
+using cppmat::expr::operator+;
+using cppmat::expr::operator-;
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
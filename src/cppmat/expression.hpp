@@ -0,0 +1,788 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_EXPRESSION_HPP
+#define CPPMAT_EXPRESSION_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace expr {
+
+// =================================================================================================
+// element-wise operations
+// =================================================================================================
+
+template<typename X>
+inline
+X plus::apply(const X &a, const X &b)
+{
+  return a + b;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X minus::apply(const X &a, const X &b)
+{
+  return a - b;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X multiplies::apply(const X &a, const X &b)
+{
+  return a * b;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X divides::apply(const X &a, const X &b)
+{
+  return a / b;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X negate::apply(const X &a)
+{
+  return -a;
+}
+
+// =================================================================================================
+// cppmat::expr::temporary
+// =================================================================================================
+
+template<typename X>
+inline
+temporary<X>::temporary(cppmat::array<X> &&A) : cppmat::array<X>(mInline)
+{
+  cppmat::array<X>::operator=(std::move(A));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+temporary<X>::temporary(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &A) :
+  cppmat::array<X>(mInline)
+{
+  this->resize(A.shape());
+
+  this->setCopy(A.begin(), A.end());
+}
+
+// =================================================================================================
+// cppmat::expr::leaf
+// =================================================================================================
+
+template<typename X>
+template<typename T>
+inline
+void leaf<X>::setShape(const T &A)
+{
+  mSize = A.size();
+  mRank = A.rank();
+
+  std::fill(std::begin(mShape), std::end(mShape), 1);
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+    mShape[i] = A.shape(i);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+leaf<X>::leaf(const cppmat::array<X> &A) : mData(A.data())
+{
+  setShape(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+leaf<X>::leaf(cppmat::array<X> &&A) : mOwn(std::make_shared<const temporary<X>>(std::move(A)))
+{
+  mData = mOwn->data();
+
+  setShape(*mOwn);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+leaf<X>::leaf(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &A) : mData(A.data())
+{
+  setShape(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+leaf<X>::leaf(cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &&A) :
+  mOwn(std::make_shared<const temporary<X>>(A))
+{
+  mData = mOwn->data();
+
+  setShape(*mOwn);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+leaf<X>::leaf(const cppmat::view::array<X,RANK,I,J,K,L,M,N> &A) : mData(A.data())
+{
+  setShape(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t leaf<X>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t leaf<X>::rank() const
+{
+  return mRank;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t leaf<X>::shape(size_t i) const
+{
+  Assert( i < mRank );
+
+  return mShape[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& leaf<X>::operator[](size_t i) const
+{
+  Assert( i < mSize );
+
+  return mData[i];
+}
+
+// =================================================================================================
+// cppmat::expr::scalar
+// =================================================================================================
+
+template<typename X>
+inline
+scalar<X>::scalar(const X &D) : mData(D)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t scalar<X>::size() const
+{
+  return 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t scalar<X>::rank() const
+{
+  return 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t scalar<X>::shape(size_t i) const
+{
+  UNUSED(i);
+
+  return 1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const X& scalar<X>::operator[](size_t i) const
+{
+  UNUSED(i);
+
+  return mData;
+}
+
+// =================================================================================================
+// cppmat::expr::binary
+// =================================================================================================
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+binary<X,Op,Lhs,Rhs>::binary(const Lhs &A, const Rhs &B) : mLhs(A), mRhs(B)
+{
+  #ifndef NDEBUG
+    if ( not Lhs::is_scalar and not Rhs::is_scalar )
+    {
+      Assert( A.size() == B.size() );
+      Assert( A.rank() == B.rank() );
+      for ( size_t i = 0 ; i < A.rank() ; ++i ) Assert( A.shape(i) == B.shape(i) );
+    }
+  #endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+size_t binary<X,Op,Lhs,Rhs>::size() const
+{
+  return Lhs::is_scalar ? mRhs.size() : mLhs.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+size_t binary<X,Op,Lhs,Rhs>::rank() const
+{
+  return Lhs::is_scalar ? mRhs.rank() : mLhs.rank();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+size_t binary<X,Op,Lhs,Rhs>::shape(size_t i) const
+{
+  return Lhs::is_scalar ? mRhs.shape(i) : mLhs.shape(i);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+std::vector<size_t> binary<X,Op,Lhs,Rhs>::shape() const
+{
+  std::vector<size_t> out(rank());
+
+  for ( size_t i = 0 ; i < out.size() ; ++i )
+    out[i] = shape(i);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+X binary<X,Op,Lhs,Rhs>::operator[](size_t i) const
+{
+  return Op::apply(static_cast<X>(mLhs[i]), static_cast<X>(mRhs[i]));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+template<typename... T>
+inline
+X binary<X,Op,Lhs,Rhs>::operator()(T... idx) const
+{
+  return (*this)[cppmat::expr::flat_index(*this, {static_cast<ptrdiff_t>(idx)...})];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+cppmat::array<X> binary<X,Op,Lhs,Rhs>::eval() const
+{
+  return cppmat::array<X>(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+X binary<X,Op,Lhs,Rhs>::sum() const
+{
+  return cppmat::expr::reduce_sum(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+X binary<X,Op,Lhs,Rhs>::min() const
+{
+  return cppmat::expr::reduce_min(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+X binary<X,Op,Lhs,Rhs>::max() const
+{
+  return cppmat::expr::reduce_max(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Lhs, class Rhs>
+inline
+X binary<X,Op,Lhs,Rhs>::norm() const
+{
+  return cppmat::expr::reduce_norm(*this);
+}
+
+// =================================================================================================
+// cppmat::expr::unary
+// =================================================================================================
+
+template<typename X, class Op, class Arg>
+inline
+unary<X,Op,Arg>::unary(const Arg &A) : mArg(A)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+size_t unary<X,Op,Arg>::size() const
+{
+  return mArg.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+size_t unary<X,Op,Arg>::rank() const
+{
+  return mArg.rank();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+size_t unary<X,Op,Arg>::shape(size_t i) const
+{
+  return mArg.shape(i);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+std::vector<size_t> unary<X,Op,Arg>::shape() const
+{
+  std::vector<size_t> out(rank());
+
+  for ( size_t i = 0 ; i < out.size() ; ++i )
+    out[i] = shape(i);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+X unary<X,Op,Arg>::operator[](size_t i) const
+{
+  return Op::apply(static_cast<X>(mArg[i]));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+template<typename... T>
+inline
+X unary<X,Op,Arg>::operator()(T... idx) const
+{
+  return (*this)[cppmat::expr::flat_index(*this, {static_cast<ptrdiff_t>(idx)...})];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+cppmat::array<X> unary<X,Op,Arg>::eval() const
+{
+  return cppmat::array<X>(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+X unary<X,Op,Arg>::sum() const
+{
+  return cppmat::expr::reduce_sum(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+X unary<X,Op,Arg>::min() const
+{
+  return cppmat::expr::reduce_min(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+X unary<X,Op,Arg>::max() const
+{
+  return cppmat::expr::reduce_max(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op, class Arg>
+inline
+X unary<X,Op,Arg>::norm() const
+{
+  return cppmat::expr::reduce_norm(*this);
+}
+
+// =================================================================================================
+// convert operand to expression node
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::expr::leaf<X> wrap(const cppmat::array<X> &A)
+{
+  return cppmat::expr::leaf<X>(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::expr::leaf<X> wrap(cppmat::array<X> &&A)
+{
+  return cppmat::expr::leaf<X>(std::move(A));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+cppmat::expr::leaf<X> wrap(const cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &A)
+{
+  return cppmat::expr::leaf<X>(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+cppmat::expr::leaf<X> wrap(cppmat::tiny::array<X,RANK,I,J,K,L,M,N> &&A)
+{
+  return cppmat::expr::leaf<X>(std::move(A));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+cppmat::expr::leaf<X> wrap(const cppmat::view::array<X,RANK,I,J,K,L,M,N> &A)
+{
+  return cppmat::expr::leaf<X>(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class E, typename V>
+inline
+E wrap(const E &A)
+{
+  return A;
+}
+
+// =================================================================================================
+// element access and reductions
+// =================================================================================================
+
+template<class E>
+inline
+size_t flat_index(const E &A, std::initializer_list<ptrdiff_t> idx)
+{
+  Assert( idx.size() == A.rank() );
+
+  size_t out = 0;
+  size_t i   = 0;
+
+  for ( ptrdiff_t a : idx )
+  {
+    ptrdiff_t n = static_cast<ptrdiff_t>(A.shape(i++));
+
+    Assert( a < n and a >= -n );
+
+    out = out * static_cast<size_t>(n) + static_cast<size_t>( a < 0 ? a + n : a );
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class E>
+inline
+typename E::value_type reduce_sum(const E &A)
+{
+  typedef typename E::value_type X;
+
+  return cppmat::Private::parallel_reduce(A.size(), static_cast<X>(0),
+    [&A](size_t begin, size_t end) {
+      X out = static_cast<X>(0);
+      for ( size_t i = begin ; i < end ; ++i )
+        out += A[i];
+      return out;
+    },
+    [](X a, X b) { return a + b; }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class E>
+inline
+typename E::value_type reduce_min(const E &A)
+{
+  typedef typename E::value_type X;
+
+  Assert( A.size() > 0 );
+
+  return cppmat::Private::parallel_reduce(A.size(), A[0],
+    [&A](size_t begin, size_t end) {
+      X out = A[begin];
+      for ( size_t i = begin+1 ; i < end ; ++i )
+        out = std::min(out, A[i]);
+      return out;
+    },
+    [](X a, X b) { return std::min(a, b); }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class E>
+inline
+typename E::value_type reduce_max(const E &A)
+{
+  typedef typename E::value_type X;
+
+  Assert( A.size() > 0 );
+
+  return cppmat::Private::parallel_reduce(A.size(), A[0],
+    [&A](size_t begin, size_t end) {
+      X out = A[begin];
+      for ( size_t i = begin+1 ; i < end ; ++i )
+        out = std::max(out, A[i]);
+      return out;
+    },
+    [](X a, X b) { return std::max(a, b); }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class E>
+inline
+typename E::value_type reduce_norm(const E &A)
+{
+  typedef typename E::value_type X;
+
+  return cppmat::Private::parallel_reduce(A.size(), static_cast<X>(0),
+    [&A](size_t begin, size_t end) {
+      X out = static_cast<X>(0);
+      for ( size_t i = begin ; i < end ; ++i )
+        out += std::abs(A[i]);
+      return out;
+    },
+    [](X a, X b) { return a + b; }
+  );
+}
+
+// =================================================================================================
+// evaluate expression into pre-allocated storage
+// =================================================================================================
+
+template<typename X, class E>
+inline
+void assign(X *data, const E &A)
+{
+  size_t n = A.size();
+
+  cppmat::Private::parallel_for(n, [data,&A](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      data[i] = A[i];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class E>
+inline
+void assign_add(X *data, const E &A)
+{
+  size_t n = A.size();
+
+  cppmat::Private::parallel_for(n, [data,&A](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      data[i] += A[i];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class E>
+inline
+void assign_sub(X *data, const E &A)
+{
+  size_t n = A.size();
+
+  cppmat::Private::parallel_for(n, [data,&A](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      data[i] -= A[i];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class E>
+inline
+void assign_mul(X *data, const E &A)
+{
+  size_t n = A.size();
+
+  cppmat::Private::parallel_for(n, [data,&A](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      data[i] *= A[i];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class E>
+inline
+void assign_div(X *data, const E &A)
+{
+  size_t n = A.size();
+
+  cppmat::Private::parallel_for(n, [data,&A](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      data[i] /= A[i];
+  });
+}
+
+// =================================================================================================
+// external arithmetic operators: build expression
+// =================================================================================================
+
+template<class L, class R, typename V>
+inline
+typename cppmat::expr::binary_type<cppmat::expr::multiplies,L,R>::type operator* (L &&A, R &&B)
+{
+  typedef typename cppmat::expr::binary_type<cppmat::expr::multiplies,L,R> T;
+
+  return typename T::type(typename T::Lhs(std::forward<L>(A)), typename T::Rhs(std::forward<R>(B)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class L, class R, typename V>
+inline
+typename cppmat::expr::binary_type<cppmat::expr::divides,L,R>::type operator/ (L &&A, R &&B)
+{
+  typedef typename cppmat::expr::binary_type<cppmat::expr::divides,L,R> T;
+
+  return typename T::type(typename T::Lhs(std::forward<L>(A)), typename T::Rhs(std::forward<R>(B)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class L, class R, typename V>
+inline
+typename cppmat::expr::binary_type<cppmat::expr::plus,L,R>::type operator+ (L &&A, R &&B)
+{
+  typedef typename cppmat::expr::binary_type<cppmat::expr::plus,L,R> T;
+
+  return typename T::type(typename T::Lhs(std::forward<L>(A)), typename T::Rhs(std::forward<R>(B)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class L, class R, typename V>
+inline
+typename cppmat::expr::binary_type<cppmat::expr::minus,L,R>::type operator- (L &&A, R &&B)
+{
+  typedef typename cppmat::expr::binary_type<cppmat::expr::minus,L,R> T;
+
+  return typename T::type(typename T::Lhs(std::forward<L>(A)), typename T::Rhs(std::forward<R>(B)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class E, typename V>
+inline
+cppmat::expr::unary<typename E::value_type,cppmat::expr::negate,E> operator- (const E &A)
+{
+  return cppmat::expr::unary<typename E::value_type,cppmat::expr::negate,E>(A);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
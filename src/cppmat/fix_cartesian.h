@@ -69,6 +69,20 @@ cppmat::tiny::cartesian::tensor2<X,ND> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor4s<X,ND> &A, const cppmat::tiny::cartesian::tensor2s<X,ND> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A, const cppmat::tiny::cartesian::tensor4s<X,ND> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X, size_t ND>
 X ddot(
   const cppmat::tiny::cartesian::tensor2<X,ND> &A, const cppmat::tiny::cartesian::tensor2<X,ND> &B
@@ -366,6 +380,8 @@ X trace(const cppmat::tiny::cartesian::tensor2d<X,ND> &A);
 
 // =================================================================================================
 // determinant
+// - "tensor2" and "tensor2s": closed-form in 2-D and 3-D, Gauss-Jordan elimination (with partial
+//   pivoting) otherwise
 // =================================================================================================
 
 template<typename X, size_t ND>
@@ -378,6 +394,8 @@ X det(const cppmat::tiny::cartesian::tensor2d<X,ND> &A);
 
 // =================================================================================================
 // inverse
+// - "tensor2" and "tensor2s": closed-form in 2-D and 3-D, Gauss-Jordan elimination (with partial
+//   pivoting) otherwise
 // =================================================================================================
 
 template<typename X, size_t ND>
@@ -388,6 +406,111 @@ cppmat::tiny::cartesian::tensor2<X,ND> inv(const cppmat::tiny::cartesian::tensor
 template<typename X, size_t ND>
 cppmat::tiny::cartesian::tensor2d<X,ND> inv(const cppmat::tiny::cartesian::tensor2d<X,ND> &A);
 
+// =================================================================================================
+// eigen-decomposition: "A = vec * diag(val) * vec^T", with the eigenvalues "val" in ascending order
+// and the (orthonormal) eigenvectors the columns of "vec" (closed-form in 2-D and 3-D)
+// =================================================================================================
+
+template<typename X, size_t ND>
+void eig(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::vector<X,ND> &val, cppmat::tiny::cartesian::tensor2<X,ND> &vec
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::vector<X,ND> eigenvalues(const cppmat::tiny::cartesian::tensor2s<X,ND> &A);
+
+// =================================================================================================
+// isotropic tensor functions: "F(A) = vec * diag(f(val)) * vec^T" (see "eig"), optionally with the
+// derivative "dFdA = dF/dA" (with minor and major symmetry, for consistent tangents)
+// - "log" and "pow" require "A" to be positive definite, "sqrt" positive semi-definite (but with
+//   an infinite derivative for a zero eigenvalue); otherwise "std::domain_error" is thrown
+// =================================================================================================
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> log(const cppmat::tiny::cartesian::tensor2s<X,ND> &A);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> log(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(const cppmat::tiny::cartesian::tensor2s<X,ND> &A);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(const cppmat::tiny::cartesian::tensor2s<X,ND> &A);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(const cppmat::tiny::cartesian::tensor2s<X,ND> &A, X p);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A, X p,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+// on a view: the result is a "tiny" tensor
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> log(const cppmat::view::cartesian::tensor2s<X,ND> &A);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> log(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(const cppmat::view::cartesian::tensor2s<X,ND> &A);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(const cppmat::view::cartesian::tensor2s<X,ND> &A);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(const cppmat::view::cartesian::tensor2s<X,ND> &A, X p);
+
+template<typename X, size_t ND>
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A, X p,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+);
+
 // =================================================================================================
 // miscellaneous tensor operations
 // =================================================================================================
@@ -153,6 +153,37 @@ cppmat::tiny::cartesian::tensor2<X,ND> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor4s<X,ND> &A, const cppmat::tiny::cartesian::tensor2s<X,ND> &B
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> C;
+
+  cppmat::Private::mandel_ddot(ND, A.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> ddot(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A, const cppmat::tiny::cartesian::tensor4s<X,ND> &B
+)
+{
+  // C_kl = A_ij * B_jikl = B_klji * A_ij (major symmetry)
+  cppmat::tiny::cartesian::tensor2s<X,ND> C;
+
+  cppmat::Private::mandel_ddot(ND, B.data(), A.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X, size_t ND>
 inline
 X ddot(
@@ -915,11 +946,9 @@ template<typename X, size_t ND>
 inline
 X det(const cppmat::tiny::cartesian::tensor2<X,ND> &A)
 {
-  Assert( false );
-
-  UNUSED(A);
+  cppmat::tiny::cartesian::tensor2<X,ND> B = A;
 
-  return static_cast<X>(0);
+  return cppmat::Private::gauss_det(ND, B.data());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -928,11 +957,13 @@ template<typename X, size_t ND>
 inline
 X det(const cppmat::tiny::cartesian::tensor2s<X,ND> &A)
 {
-  Assert( false );
+  cppmat::tiny::cartesian::tensor2<X,ND> B;
 
-  UNUSED(A);
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      B(i,j) = A(i,j);
 
-  return static_cast<X>(0);
+  return cppmat::Private::gauss_det(ND, B.data());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -957,9 +988,12 @@ template<typename X, size_t ND>
 inline
 cppmat::tiny::cartesian::tensor2<X,ND> inv(const cppmat::tiny::cartesian::tensor2<X,ND> &A)
 {
-  Assert(false);
+  cppmat::tiny::cartesian::tensor2<X,ND> B = A;
+  cppmat::tiny::cartesian::tensor2<X,ND> C;
 
-  return A;
+  cppmat::Private::gauss_inv(ND, B.data(), C.data());
+
+  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -968,9 +1002,23 @@ template<typename X, size_t ND>
 inline
 cppmat::tiny::cartesian::tensor2s<X,ND> inv(const cppmat::tiny::cartesian::tensor2s<X,ND> &A)
 {
-  Assert(false);
+  cppmat::tiny::cartesian::tensor2<X,ND> B;
+  cppmat::tiny::cartesian::tensor2<X,ND> D;
 
-  return A;
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      B(i,j) = A(i,j);
+
+  cppmat::Private::gauss_inv(ND, B.data(), D.data());
+
+  // the inverse of a symmetric matrix is symmetric: take the upper triangle
+  cppmat::tiny::cartesian::tensor2s<X,ND> C;
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = i ; j < ND ; ++j )
+      C(i,j) = D(i,j);
+
+  return C;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -987,6 +1035,313 @@ cppmat::tiny::cartesian::tensor2d<X,ND> inv(const cppmat::tiny::cartesian::tenso
   return C;
 }
 
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+void eig(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::vector<X,ND> &val, cppmat::tiny::cartesian::tensor2<X,ND> &vec
+)
+{
+  cppmat::Private::eig_sym(ND, A.data(), val.data(), vec.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::vector<X,ND> eigenvalues(const cppmat::tiny::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::vector<X,ND> val;
+
+  cppmat::Private::eig_sym(ND, A.data(), val.data(), static_cast<X*>(nullptr));
+
+  return val;
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> log(const cppmat::tiny::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_log<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> log(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_log<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(const cppmat::tiny::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(const cppmat::tiny::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(const cppmat::tiny::cartesian::tensor2s<X,ND> &A, X p)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(
+  const cppmat::tiny::cartesian::tensor2s<X,ND> &A, X p,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
+// =================================================================================================
+// isotropic tensor functions: on a view
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> log(const cppmat::view::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_log<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> log(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_log<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(const cppmat::view::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> exp(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(const cppmat::view::cartesian::tensor2s<X,ND> &A)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> sqrt(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(const cppmat::view::cartesian::tensor2s<X,ND> &A, X p)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::tiny::cartesian::tensor2s<X,ND> pow(
+  const cppmat::view::cartesian::tensor2s<X,ND> &A, X p,
+  cppmat::tiny::cartesian::tensor4<X,ND> &dFdA
+)
+{
+  cppmat::tiny::cartesian::tensor2s<X,ND> F;
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  if ( not cppmat::Private::isotropic(ND, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
 // =================================================================================================
 // miscellaneous tensor operations
 // =================================================================================================
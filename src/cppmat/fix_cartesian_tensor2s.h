@@ -59,6 +59,7 @@ public:
   tensor2 <X,ND> dot   (const tensor2d<X,ND> &B) const; // single contract.: C_ik   = A_ij * B_jk
   vector  <X,ND> dot   (const vector  <X,ND> &B) const; // single contract.: C_i    = A_ij * B_j
   tensor2 <X,ND> ddot  (const tensor4 <X,ND> &B) const; // double contract.: C_kl   = A_ij * B_jikl
+  tensor2s<X,ND> ddot  (const tensor4s<X,ND> &B) const; // double contract.: C_kl   = A_ij * B_jikl
   X              ddot  (const tensor2 <X,ND> &B) const; // double contract.: C      = A_ij * B_ji
   X              ddot  (const tensor2s<X,ND> &B) const; // double contract.: C      = A_ij * B_ji
   X              ddot  (const tensor2d<X,ND> &B) const; // double contract.: C      = A_ij * B_ji
@@ -70,6 +71,16 @@ public:
   X              det   ()                        const; // determinant (only in 2D/3D)
   tensor2s<X,ND> inv   ()                        const; // inverse     (only in 2D/3D)
 
+  // eigen-decomposition: "A = vec * diag(val) * vec^T", eigenvalues in ascending order
+  void           eig        (vector<X,ND> &val, tensor2<X,ND> &vec) const;
+  vector<X,ND>   eigenvalues()                                    const;
+
+  // isotropic tensor functions (with derivative: see "cppmat::cartesian::log", etc.)
+  tensor2s<X,ND> log        ()                                    const; // matrix logarithm
+  tensor2s<X,ND> exp        ()                                    const; // matrix exponential
+  tensor2s<X,ND> sqrt       ()                                    const; // matrix square root
+  tensor2s<X,ND> pow        (X p)                                 const; // matrix power
+
 };
 
 // =================================================================================================
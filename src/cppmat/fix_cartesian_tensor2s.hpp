@@ -121,6 +121,15 @@ tensor2<X,ND> tensor2s<X,ND>::ddot(const tensor4<X,ND> &B) const
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X, size_t ND>
+inline
+tensor2s<X,ND> tensor2s<X,ND>::ddot(const tensor4s<X,ND> &B) const
+{
+  return cppmat::cartesian::ddot(*this, B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X, size_t ND>
 inline
 X tensor2s<X,ND>::ddot(const tensor2<X,ND> &B) const
@@ -249,6 +258,64 @@ tensor2s<X,ND> tensor2s<X,ND>::inv() const
   return cppmat::cartesian::inv(*this);
 }
 
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+void tensor2s<X,ND>::eig(vector<X,ND> &val, tensor2<X,ND> &vec) const
+{
+  cppmat::cartesian::eig(*this, val, vec);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+vector<X,ND> tensor2s<X,ND>::eigenvalues() const
+{
+  return cppmat::cartesian::eigenvalues(*this);
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor2s<X,ND> tensor2s<X,ND>::log() const
+{
+  return cppmat::cartesian::log(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor2s<X,ND> tensor2s<X,ND>::exp() const
+{
+  return cppmat::cartesian::exp(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor2s<X,ND> tensor2s<X,ND>::sqrt() const
+{
+  return cppmat::cartesian::sqrt(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor2s<X,ND> tensor2s<X,ND>::pow(X p) const
+{
+  return cppmat::cartesian::pow(*this, p);
+}
+
 // =================================================================================================
 
 }}} // namespace ...
@@ -35,6 +35,9 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor4(const cppmat::tiny::array<U,4,ND,ND,ND,ND> &A);
 
+  // constructor: convert from Mandel storage
+  tensor4(const cppmat::tiny::cartesian::tensor4s<X,ND> &A);
+
   // constructor: copy from dynamic size
   tensor4(const cppmat::cartesian::tensor4<X> &A);
 
@@ -38,6 +38,17 @@ tensor4<X,ND>::tensor4(const cppmat::tiny::array<U,4,ND,ND,ND,ND> &A) : cppmat::
 {
 }
 
+// =================================================================================================
+// constructors: convert from Mandel storage
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4<X,ND>::tensor4(const cppmat::tiny::cartesian::tensor4s<X,ND> &A) : cppmat::tiny::array<X,4,ND,ND,ND,ND>()
+{
+  cppmat::Private::mandel_to_tensor4(ND, A.data(), this->data());
+}
+
 // =================================================================================================
 // constructors: copy from dynamic size
 // =================================================================================================
@@ -0,0 +1,77 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_FIX_CARTESIAN_TENSOR4S_H
+#define CPPMAT_FIX_CARTESIAN_TENSOR4S_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace tiny {
+namespace cartesian {
+
+// =================================================================================================
+// cppmat::tiny::cartesian::tensor4s (see "cppmat::cartesian::tensor4s")
+// =================================================================================================
+
+template<typename X, size_t ND>
+class tensor4s : public cppmat::tiny::symmetric::matrix<X,ND*(ND+1)/2,ND*(ND+1)/2>
+{
+  static_assert( ND > 0, "Number of dimensions must positive" );
+
+private:
+
+  // size of the Mandel matrix
+  static const size_t NM = ND*(ND+1)/2;
+
+public:
+
+  // constructor: allocate, don't initialize
+  tensor4s();
+
+  // constructor: copy from parent (with different type)
+  template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
+  tensor4s(const cppmat::tiny::symmetric::matrix<U,ND*(ND+1)/2,ND*(ND+1)/2> &A);
+
+  // constructor: convert from full storage (minor and major symmetry are assumed)
+  explicit tensor4s(const cppmat::tiny::cartesian::tensor4<X,ND> &A);
+
+  // constructor: copy from dynamic size
+  tensor4s(const cppmat::cartesian::tensor4s<X> &A);
+
+  // constructor: copy from view
+  tensor4s(const cppmat::view::cartesian::tensor4s<X,ND> &A);
+
+  // named constructor: initialize
+  static tensor4s<X,ND> Is ();
+  static tensor4s<X,ND> Isd();
+  static tensor4s<X,ND> II ();
+
+  // get dimensions
+  size_t ndim() const;
+
+  // initialize
+  void setIs();
+  void setIsd();
+  void setII();
+
+  // tensor products / operations
+  tensor2s<X,ND> ddot(const tensor2s<X,ND> &B) const; // double contract.: C_ij = A_ijkl * B_lk
+
+};
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,175 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_FIX_CARTESIAN_TENSOR4S_HPP
+#define CPPMAT_FIX_CARTESIAN_TENSOR4S_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace tiny {
+namespace cartesian {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND>::tensor4s() : cppmat::tiny::symmetric::matrix<X,NM,NM>()
+{
+}
+
+// =================================================================================================
+// constructors: copy from parent (with different type)
+// =================================================================================================
+
+template<typename X, size_t ND>
+template<typename U, typename V>
+inline
+tensor4s<X,ND>::tensor4s(const cppmat::tiny::symmetric::matrix<U,ND*(ND+1)/2,ND*(ND+1)/2> &A) :
+  cppmat::tiny::symmetric::matrix<X,NM,NM>(A)
+{
+}
+
+// =================================================================================================
+// constructors: convert from full storage
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND>::tensor4s(const cppmat::tiny::cartesian::tensor4<X,ND> &A) :
+  cppmat::tiny::symmetric::matrix<X,NM,NM>()
+{
+  cppmat::Private::mandel_from_tensor4(ND, A.data(), this->data());
+}
+
+// =================================================================================================
+// constructors: copy from dynamic size
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND>::tensor4s(const cppmat::cartesian::tensor4s<X> &A) :
+  cppmat::tiny::symmetric::matrix<X,NM,NM>(A)
+{
+}
+
+// =================================================================================================
+// constructors: copy from view
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND>::tensor4s(const cppmat::view::cartesian::tensor4s<X,ND> &A) :
+  cppmat::tiny::symmetric::matrix<X,NM,NM>(A)
+{
+}
+
+// =================================================================================================
+// named constructors: identity tensors
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND> tensor4s<X,ND>::Is()
+{
+  tensor4s<X,ND> out;
+
+  out.setIs();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND> tensor4s<X,ND>::Isd()
+{
+  tensor4s<X,ND> out;
+
+  out.setIsd();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND> tensor4s<X,ND>::II()
+{
+  tensor4s<X,ND> out;
+
+  out.setII();
+
+  return out;
+}
+
+// =================================================================================================
+// dimensions
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+size_t tensor4s<X,ND>::ndim() const
+{
+  return ND;
+}
+
+// =================================================================================================
+// initialize: identity tensors
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+void tensor4s<X,ND>::setIs()
+{
+  cppmat::Private::mandel_unit(ND, static_cast<X>(1), static_cast<X>(0), this->data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+void tensor4s<X,ND>::setIsd()
+{
+  cppmat::Private::mandel_unit(ND, static_cast<X>(1), static_cast<X>(-1)/static_cast<X>(ND), this->data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+void tensor4s<X,ND>::setII()
+{
+  cppmat::Private::mandel_unit(ND, static_cast<X>(0), static_cast<X>(1), this->data());
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor2s<X,ND> tensor4s<X,ND>::ddot(const tensor2s<X,ND> &B) const
+{
+  return cppmat::cartesian::ddot(*this, B);
+}
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
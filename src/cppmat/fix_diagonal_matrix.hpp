@@ -702,17 +702,7 @@ template<typename X, size_t M, size_t N>
 inline
 void matrix<X,M,N>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  cppmat::random::fillUniform(begin(), end(), lower, upper);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -257,6 +257,19 @@ void array<X,RANK,I,J,K,L,M,N>::setPeriodic(bool periodic)
   mPeriodic = periodic;
 }
 
+// =================================================================================================
+// index operators : positive (periodic) index
+// =================================================================================================
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+size_t array<X,RANK,I,J,K,L,M,N>::wrap(int a, int n) const
+{
+  if ( mPeriodic ) return static_cast<size_t>( (n+(a%n)) % n );
+
+  return static_cast<size_t>( a < 0 ? a+n : a );
+}
+
 // =================================================================================================
 // get dimensions
 // =================================================================================================
@@ -450,7 +463,7 @@ X& array<X,RANK,I,J,K,L,M,N>::operator()(int a)
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return mData[\
     A * mStrides[0]];
@@ -466,7 +479,7 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return mData[\
     A * mStrides[0]];
@@ -484,8 +497,8 @@ X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b)
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return mData[\
     A * mStrides[0] +\
@@ -504,8 +517,8 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return mData[\
     A * mStrides[0] +\
@@ -526,9 +539,9 @@ X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c)
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return mData[\
     A * mStrides[0] +\
@@ -550,9 +563,9 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return mData[\
     A * mStrides[0] +\
@@ -576,10 +589,10 @@ X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d)
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return mData[\
     A * mStrides[0] +\
@@ -604,10 +617,10 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return mData[\
     A * mStrides[0] +\
@@ -634,11 +647,11 @@ X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d, int e)
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return mData[\
     A * mStrides[0] +\
@@ -666,11 +679,11 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d, int e
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return mData[\
     A * mStrides[0] +\
@@ -700,12 +713,12 @@ X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d, int e, int
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return mData[\
     A * mStrides[0] +\
@@ -736,12 +749,12 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d, int e
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return mData[\
     A * mStrides[0] +\
@@ -1048,7 +1061,7 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return A * mStrides[0];
 }
@@ -1065,8 +1078,8 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return A * mStrides[0] +\
          B * mStrides[1];
@@ -1086,9 +1099,9 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1111,10 +1124,10 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1140,11 +1153,11 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c, int d, int e) co
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1173,12 +1186,12 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c, int d, int e, in
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1449,7 +1462,7 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a)
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return begin() +
     A * mStrides[0];
@@ -1465,7 +1478,7 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return begin() +
     A * mStrides[0];
@@ -1483,8 +1496,8 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b)
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return begin() +
     A * mStrides[0] +\
@@ -1503,8 +1516,8 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return begin() +
     A * mStrides[0] +\
@@ -1525,9 +1538,9 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c)
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return begin() +
     A * mStrides[0] +\
@@ -1549,9 +1562,9 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return begin() +
     A * mStrides[0] +\
@@ -1575,10 +1588,10 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d)
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return begin() +
     A * mStrides[0] +\
@@ -1603,10 +1616,10 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return begin() +
     A * mStrides[0] +\
@@ -1633,11 +1646,11 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d, int e)
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return begin() +
     A * mStrides[0] +\
@@ -1665,11 +1678,11 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d, int e) const
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return begin() +
     A * mStrides[0] +\
@@ -1699,12 +1712,12 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d, int e, int f)
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return begin() +
     A * mStrides[0] +\
@@ -1735,12 +1748,12 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d, int e, int f) c
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return begin() +
     A * mStrides[0] +\
@@ -1975,17 +1988,7 @@ template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t
 inline
 void array<X,RANK,I,J,K,L,M,N>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  cppmat::random::fillUniform(begin(), end(), lower, upper);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -41,8 +41,12 @@ public:
   matrix(const cppmat::tiny::array<U,2,M,N> &A);
 
   // constructor: copy from other class
-  matrix(const cppmat::tiny::symmetric::matrix<X,M,N> &A);
-  matrix(const cppmat::tiny::diagonal ::matrix<X,M,N> &A);
+  // (templates: "symmetric::matrix" and "diagonal::matrix" are only instantiated for square "M == N")
+  template<size_t m, size_t n, typename=typename std::enable_if<m==M && n==N>::type>
+  matrix(const cppmat::tiny::symmetric::matrix<X,m,n> &A);
+
+  template<size_t m, size_t n, typename=typename std::enable_if<m==M && n==N>::type>
+  matrix(const cppmat::tiny::diagonal ::matrix<X,m,n> &A);
 
   // constructor: copy from dynamic size
   matrix(const cppmat::matrix<X> &A);
@@ -58,8 +62,22 @@ public:
   matrix<X,M,N>& operator*= (const cppmat::tiny::diagonal ::matrix<X,M,N> &B);
   matrix<X,M,N>& operator+= (const cppmat::tiny::diagonal ::matrix<X,M,N> &B);
   matrix<X,M,N>& operator-= (const cppmat::tiny::diagonal ::matrix<X,M,N> &B);
+
+  // matrix products (small products are unrolled at compile time, large products are cache-blocked)
+  template<size_t K> matrix<X,M,K> dot(const matrix<X,N,K> &B) const; // C_ik = A_ij * B_jk
+  vector<X,M>                      dot(const vector<X,N>   &b) const; // c_i  = A_ij * b_j
 };
 
+// =================================================================================================
+// matrix products: the same as "A.dot(B)" and "A.dot(b)"
+// =================================================================================================
+
+template<typename X, size_t M, size_t N, size_t K>
+matrix<X,M,K> matmul(const matrix<X,M,N> &A, const matrix<X,N,K> &B);
+
+template<typename X, size_t M, size_t N>
+vector<X,M> matvec(const matrix<X,M,N> &A, const vector<X,N> &b);
+
 // =================================================================================================
 
 }} // namespace ...
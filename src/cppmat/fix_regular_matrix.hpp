@@ -42,8 +42,9 @@ matrix<X,M,N>::matrix(const cppmat::tiny::array<U,2,M,N> &A) : cppmat::tiny::arr
 // =================================================================================================
 
 template<typename X, size_t M, size_t N>
+template<size_t m, size_t n, typename V>
 inline
-matrix<X,M,N>::matrix(const cppmat::tiny::symmetric::matrix<X,M,N> &A) : cppmat::tiny::matrix<X,M,N>()
+matrix<X,M,N>::matrix(const cppmat::tiny::symmetric::matrix<X,m,n> &A) : cppmat::tiny::matrix<X,M,N>()
 {
   for ( size_t i = 0 ; i < M ; ++i )
     for ( size_t j = 0 ; j < N ; ++j )
@@ -53,8 +54,9 @@ matrix<X,M,N>::matrix(const cppmat::tiny::symmetric::matrix<X,M,N> &A) : cppmat:
 // -------------------------------------------------------------------------------------------------
 
 template<typename X, size_t M, size_t N>
+template<size_t m, size_t n, typename V>
 inline
-matrix<X,M,N>::matrix(const cppmat::tiny::diagonal::matrix<X,M,N> &A) : cppmat::tiny::matrix<X,M,N>()
+matrix<X,M,N>::matrix(const cppmat::tiny::diagonal::matrix<X,m,n> &A) : cppmat::tiny::matrix<X,M,N>()
 {
   for ( size_t i = 0 ; i < M ; ++i )
     for ( size_t j = 0 ; j < N ; ++j )
@@ -81,6 +83,53 @@ matrix<X,M,N>::matrix(const cppmat::view::matrix<X,M,N> &A) : cppmat::tiny::arra
 {
 }
 
+// =================================================================================================
+// matrix products
+// =================================================================================================
+
+template<typename X, size_t M, size_t N>
+template<size_t K>
+inline
+matrix<X,M,K> matrix<X,M,N>::dot(const matrix<X,N,K> &B) const
+{
+  matrix<X,M,K> C;
+
+  cppmat::Private::gemm<X,M,K,N>(this->data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+vector<X,M> matrix<X,M,N>::dot(const vector<X,N> &b) const
+{
+  vector<X,M> c;
+
+  cppmat::Private::gemv<X,M,N>(this->data(), b.data(), c.data());
+
+  return c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N, size_t K>
+inline
+matrix<X,M,K> matmul(const matrix<X,M,N> &A, const matrix<X,N,K> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+vector<X,M> matvec(const matrix<X,M,N> &A, const vector<X,N> &b)
+{
+  return A.dot(b);
+}
+
 // =================================================================================================
 
 }} // namespace ...
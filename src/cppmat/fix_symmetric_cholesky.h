@@ -0,0 +1,124 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_FIX_SYMMETRIC_CHOLESKY_H
+#define CPPMAT_FIX_SYMMETRIC_CHOLESKY_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace tiny {
+namespace symmetric {
+
+// =================================================================================================
+// cppmat::tiny::symmetric::cholesky - see "cppmat::symmetric::cholesky"
+// - the loops have a size known at compile time, and are unrolled for small "N" (e.g. 2, 3, or 6)
+// =================================================================================================
+
+template<typename X, size_t N>
+class cholesky
+{
+protected:
+
+  matrix<X,N,N> mU; // factor "U" (packed storage)
+
+public:
+
+  // constructor: default
+  cholesky() = default;
+
+  // constructor: factorize (throws if "A" is not positive definite)
+  cholesky(const matrix<X,N,N> &A);
+  cholesky(const cppmat::view::symmetric::matrix<X,N,N> &A);
+
+  // factorize
+  void compute(const matrix<X,N,N> &A);
+
+  // factor "U"
+  const matrix<X,N,N>& factor() const;
+
+  // determinant of "A"
+  X determinant() const;
+
+  // solve "A * x = b", or "A * X = B" for each column of "B"
+  cppmat::tiny::vector<X,N> solve(const cppmat::tiny::vector<X,N> &b) const;
+
+  template<size_t K>
+  cppmat::tiny::matrix<X,N,K> solve(const cppmat::tiny::matrix<X,N,K> &B) const;
+
+  // solve in place: "b" or "B" is overwritten by the solution
+  void solveInPlace(cppmat::tiny::vector<X,N> &b) const;
+
+  template<size_t K>
+  void solveInPlace(cppmat::tiny::matrix<X,N,K> &B) const;
+
+private:
+
+  // factorize "mU" in place
+  void factorize();
+
+};
+
+// =================================================================================================
+// cppmat::tiny::symmetric::ldlt - see "cppmat::symmetric::ldlt"
+// =================================================================================================
+
+template<typename X, size_t N>
+class ldlt
+{
+protected:
+
+  matrix<X,N,N> mF; // factors "U" (strictly upper triangle) and "D" (diagonal) (packed storage)
+
+public:
+
+  // constructor: default
+  ldlt() = default;
+
+  // constructor: factorize (throws if a pivot is zero)
+  ldlt(const matrix<X,N,N> &A);
+  ldlt(const cppmat::view::symmetric::matrix<X,N,N> &A);
+
+  // factorize
+  void compute(const matrix<X,N,N> &A);
+
+  // factors "U" and "D"
+  const matrix<X,N,N>& factor() const;
+
+  // determinant of "A"
+  X determinant() const;
+
+  // solve "A * x = b", or "A * X = B" for each column of "B"
+  cppmat::tiny::vector<X,N> solve(const cppmat::tiny::vector<X,N> &b) const;
+
+  template<size_t K>
+  cppmat::tiny::matrix<X,N,K> solve(const cppmat::tiny::matrix<X,N,K> &B) const;
+
+  // solve in place: "b" or "B" is overwritten by the solution
+  void solveInPlace(cppmat::tiny::vector<X,N> &b) const;
+
+  template<size_t K>
+  void solveInPlace(cppmat::tiny::matrix<X,N,K> &B) const;
+
+private:
+
+  // factorize "mF" in place
+  void factorize();
+
+};
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
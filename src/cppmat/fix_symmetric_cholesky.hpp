@@ -0,0 +1,259 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_FIX_SYMMETRIC_CHOLESKY_HPP
+#define CPPMAT_FIX_SYMMETRIC_CHOLESKY_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace tiny {
+namespace symmetric {
+
+// =================================================================================================
+// cppmat::tiny::symmetric::cholesky : constructors
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+cholesky<X,N>::cholesky(const matrix<X,N,N> &A) : mU(A)
+{
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+cholesky<X,N>::cholesky(const cppmat::view::symmetric::matrix<X,N,N> &A) : mU(A)
+{
+  factorize();
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::cholesky : factorize
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+void cholesky<X,N>::compute(const matrix<X,N,N> &A)
+{
+  mU = A;
+
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+void cholesky<X,N>::factorize()
+{
+  if ( not cppmat::Private::cholesky<X,N>(mU.data()) )
+    throw std::domain_error("cppmat::tiny::symmetric::cholesky: Matrix is not positive definite");
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::cholesky : factor and determinant
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+const matrix<X,N,N>& cholesky<X,N>::factor() const
+{
+  return mU;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+X cholesky<X,N>::determinant() const
+{
+  X out = static_cast<X>(1);
+
+  for ( size_t a = 0 ; a < N ; ++a )
+    out *= mU(a,a) * mU(a,a);
+
+  return out;
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::cholesky : solve
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+cppmat::tiny::vector<X,N> cholesky<X,N>::solve(const cppmat::tiny::vector<X,N> &b) const
+{
+  cppmat::tiny::vector<X,N> x = b;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+template<size_t K>
+inline
+cppmat::tiny::matrix<X,N,K> cholesky<X,N>::solve(const cppmat::tiny::matrix<X,N,K> &B) const
+{
+  cppmat::tiny::matrix<X,N,K> x = B;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+void cholesky<X,N>::solveInPlace(cppmat::tiny::vector<X,N> &b) const
+{
+  cppmat::Private::cholesky_solve<X,N>(mU.data(), b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+template<size_t K>
+inline
+void cholesky<X,N>::solveInPlace(cppmat::tiny::matrix<X,N,K> &B) const
+{
+  cppmat::Private::cholesky_solve(N, K, mU.data(), B.data());
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::ldlt : constructors
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+ldlt<X,N>::ldlt(const matrix<X,N,N> &A) : mF(A)
+{
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+ldlt<X,N>::ldlt(const cppmat::view::symmetric::matrix<X,N,N> &A) : mF(A)
+{
+  factorize();
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::ldlt : factorize
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+void ldlt<X,N>::compute(const matrix<X,N,N> &A)
+{
+  mF = A;
+
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+void ldlt<X,N>::factorize()
+{
+  if ( not cppmat::Private::ldlt<X,N>(mF.data()) )
+    throw std::domain_error("cppmat::tiny::symmetric::ldlt: Matrix is singular (or needs pivoting)");
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::ldlt : factor and determinant
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+const matrix<X,N,N>& ldlt<X,N>::factor() const
+{
+  return mF;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+X ldlt<X,N>::determinant() const
+{
+  X out = static_cast<X>(1);
+
+  for ( size_t a = 0 ; a < N ; ++a )
+    out *= mF(a,a);
+
+  return out;
+}
+
+// =================================================================================================
+// cppmat::tiny::symmetric::ldlt : solve
+// =================================================================================================
+
+template<typename X, size_t N>
+inline
+cppmat::tiny::vector<X,N> ldlt<X,N>::solve(const cppmat::tiny::vector<X,N> &b) const
+{
+  cppmat::tiny::vector<X,N> x = b;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+template<size_t K>
+inline
+cppmat::tiny::matrix<X,N,K> ldlt<X,N>::solve(const cppmat::tiny::matrix<X,N,K> &B) const
+{
+  cppmat::tiny::matrix<X,N,K> x = B;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+void ldlt<X,N>::solveInPlace(cppmat::tiny::vector<X,N> &b) const
+{
+  cppmat::Private::ldlt_solve<X,N>(mF.data(), b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+template<size_t K>
+inline
+void ldlt<X,N>::solveInPlace(cppmat::tiny::matrix<X,N,K> &B) const
+{
+  cppmat::Private::ldlt_solve(N, K, mF.data(), B.data());
+}
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -231,8 +231,38 @@ public:
   size_t              where(int    index) const;
   size_t              where(size_t index) const;
 
+  // products, directly on the packed storage (see "cppmat::symmetric::matrix")
+  template<size_t K> cppmat::tiny::matrix<X,M,K> dot(const cppmat::tiny::matrix<X,N,K> &B) const;
+  cppmat::tiny::vector<X,M>                      dot(const cppmat::tiny::vector<X,N>   &b) const;
+
+  // quadratic form: b_i * A_ij * b_j
+  X quadratic(const cppmat::tiny::vector<X,N> &b) const;
+
+  // rank-1 and rank-k updates (see "cppmat::symmetric::matrix")
+  void rankUpdate(const cppmat::tiny::vector<X,N> &b, X alpha=(X)1);
+
+  template<size_t K>
+  void rankUpdate(const cppmat::tiny::matrix<X,N,K> &B, X alpha=(X)1, X beta=(X)1);
+
+  template<size_t K>
+  void rankUpdate(const cppmat::tiny::matrix<X,N,K> &B, const cppmat::tiny::matrix<X,N,K> &C,
+    X alpha=(X)1, X beta=(X)1);
+
 };
 
+// =================================================================================================
+// products: the same as "A.dot(B)", "A.dot(b)", and "A.quadratic(b)"
+// =================================================================================================
+
+template<typename X, size_t M, size_t N, size_t K>
+cppmat::tiny::matrix<X,M,K> matmul(const matrix<X,M,N> &A, const cppmat::tiny::matrix<X,N,K> &B);
+
+template<typename X, size_t M, size_t N>
+cppmat::tiny::vector<X,M> matvec(const matrix<X,M,N> &A, const cppmat::tiny::vector<X,N> &b);
+
+template<typename X, size_t M, size_t N>
+X quadratic(const matrix<X,M,N> &A, const cppmat::tiny::vector<X,N> &b);
+
 // =================================================================================================
 // equality operators
 // =================================================================================================
@@ -723,17 +723,7 @@ template<typename X, size_t M, size_t N>
 inline
 void matrix<X,M,N>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  cppmat::random::fillUniform(begin(), end(), lower, upper);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1464,6 +1454,101 @@ size_t matrix<X,M,N>::where(int index) const
   throw std::runtime_error("Out-of-bounds");
 }
 
+// =================================================================================================
+// products
+// =================================================================================================
+
+template<typename X, size_t M, size_t N>
+template<size_t K>
+inline
+cppmat::tiny::matrix<X,M,K> matrix<X,M,N>::dot(const cppmat::tiny::matrix<X,N,K> &B) const
+{
+  cppmat::tiny::matrix<X,M,K> C;
+
+  cppmat::Private::spmm(N, K, mData, B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+cppmat::tiny::vector<X,M> matrix<X,M,N>::dot(const cppmat::tiny::vector<X,N> &b) const
+{
+  cppmat::tiny::vector<X,M> c;
+
+  cppmat::Private::spmv<X,N>(mData, b.data(), c.data());
+
+  return c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+X matrix<X,M,N>::quadratic(const cppmat::tiny::vector<X,N> &b) const
+{
+  return cppmat::Private::spquad<X,N>(mData, b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+void matrix<X,M,N>::rankUpdate(const cppmat::tiny::vector<X,N> &b, X alpha)
+{
+  cppmat::Private::spr(N, alpha, b.data(), mData);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+template<size_t K>
+inline
+void matrix<X,M,N>::rankUpdate(const cppmat::tiny::matrix<X,N,K> &B, X alpha, X beta)
+{
+  cppmat::Private::sprk(N, K, alpha, B.data(), beta, mData);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+template<size_t K>
+inline
+void matrix<X,M,N>::rankUpdate(
+  const cppmat::tiny::matrix<X,N,K> &B, const cppmat::tiny::matrix<X,N,K> &C, X alpha, X beta)
+{
+  cppmat::Private::spr2k(N, K, alpha, B.data(), C.data(), beta, mData);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N, size_t K>
+inline
+cppmat::tiny::matrix<X,M,K> matmul(const matrix<X,M,N> &A, const cppmat::tiny::matrix<X,N,K> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+cppmat::tiny::vector<X,M> matvec(const matrix<X,M,N> &A, const cppmat::tiny::vector<X,N> &b)
+{
+  return A.dot(b);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+X quadratic(const matrix<X,M,N> &A, const cppmat::tiny::vector<X,N> &b)
+{
+  return A.quadratic(b);
+}
+
 // =================================================================================================
 // print operator
 // =================================================================================================
@@ -17,16 +17,220 @@ namespace cppmat {
 
 // =================================================================================================
 
+// histogram of "data" in "bins" bins of equal width, spanning "[min(data), max(data)]"
+// - the entries are binned in parallel (with private counters per part of the data)
+// - optionally "weights" (one per entry): the count is the sum of the weights per bin
+// - the input can be any contiguous storage (e.g. "A.data(), A.size()" of an array or a view)
+
 template<typename X>
 std::tuple<std::vector<double>, std::vector<double>> histogram(
   const std::vector<X> &data, size_t bins=10, bool density=false, bool return_edges=false);
 
+template<typename X>
+std::tuple<std::vector<double>, std::vector<double>> histogram(
+  const X *data, size_t n, size_t bins=10, bool density=false, bool return_edges=false);
+
+template<typename X, typename W>
+std::tuple<std::vector<double>, std::vector<double>> histogram(
+  const std::vector<X> &data, const std::vector<W> &weights, size_t bins=10, bool density=false,
+  bool return_edges=false);
+
+template<typename X, typename W>
+std::tuple<std::vector<double>, std::vector<double>> histogram(
+  const X *data, const W *weights, size_t n, size_t bins=10, bool density=false,
+  bool return_edges=false);
+
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 std::tuple<std::vector<double>, std::vector<double>> histogram_uniform(
   const std::vector<X> &data, size_t bins=10, bool density=false, bool return_edges=false);
 
+// =================================================================================================
+// cppmat::histogram_accumulator - histogram to which data is added in chunks ("push"), whereby the
+// data never has to be in memory at once
+// - fixed range "[lower, upper]" : the same bins as "histogram" for "lower = min(data)" and
+//   "upper = max(data)"; data outside the range is only counted (see "underflow" and "overflow")
+// - adaptive range : the bins have a width "2^k" and an edge at "0", the smallest "k" is chosen
+//   such that all data fits in "bins" bins; the range is grown by merging neighbouring bins
+// - the result does not depend on how the data is split, whereby accumulators can be merged
+//   exactly (e.g. per thread or per file); only a sum of weights is subject to rounding
+// - contiguous data is binned in parallel
+// =================================================================================================
+
+class histogram_accumulator
+{
+private:
+
+  bool                mAdaptive=false; // range grows with the data
+  size_t              mBins=0;         // number of bins
+  std::vector<size_t> mCount;          // count per bin
+  size_t              mN=0;            // number of entries in the bins
+  size_t              mUnder=0;        // number of entries below the range (fixed range only)
+  size_t              mOver=0;         // number of entries above the range (fixed range only)
+  bool                mWeighted=false; // weights have been added
+  std::vector<double> mWeight;         // sum of the weights per bin (only if "mWeighted")
+  double              mMin;            // minimum of all data
+  double              mMax;            // maximum of all data
+
+  // fixed range: "[mLower, mUpper]" in bins of width "mH"
+  double              mLower=0.0;
+  double              mUpper=0.0;
+  double              mH=0.0;
+
+  // adaptive range: bin "i" is "[(mOffset+i) * 2^mExp, (mOffset+i+1) * 2^mExp)"
+  int                 mExp=0;
+  int64_t             mOffset=0;
+
+  // adaptive range: grow to contain "[min, max]" (rebins the current counts)
+  void grow(double min, double max);
+
+  // start to store weights (the weight of all current entries is one)
+  void weighted();
+
+  // add contiguous data (in parallel), "weights" may be "nullptr"
+  template<typename X, typename W>
+  void add(const X *data, const W *weights, size_t n);
+
+public:
+
+  // constructors
+  histogram_accumulator() = default;
+
+  // fixed range "[lower, upper]"
+  histogram_accumulator(size_t bins, double lower, double upper);
+
+  // adaptive range ("bins" must be at least two)
+  histogram_accumulator(size_t bins);
+
+  // add data
+  void push(double x);
+
+  template<class Iterator>
+  void push(Iterator first, Iterator last);
+
+  template<typename X>
+  void push(const std::vector<X> &data);
+
+  template<typename X>
+  void push(const X *data, size_t n);
+
+  // add weighted data (one weight per entry)
+  template<typename X, typename W>
+  void push(const std::vector<X> &data, const std::vector<W> &weights);
+
+  template<typename X, typename W>
+  void push(const X *data, const W *weights, size_t n);
+
+  // add the data of another accumulator (with the same fixed range, or also with an adaptive range)
+  void merge(const histogram_accumulator &other);
+
+  // information
+  bool   adaptive() const;  // adaptive range
+  size_t bins() const;      // number of bins
+  size_t size() const;      // number of entries in the bins
+  size_t underflow() const; // number of entries below the range (fixed range only)
+  size_t overflow() const;  // number of entries above the range (fixed range only)
+  double min() const;       // minimum of all data (also outside the range)
+  double max() const;       // maximum of all data (also outside the range)
+
+  // histogram: count, sum of the weights (equal to the count without weights), normalized sum of
+  // the weights, bin-edges, or bin-midpoints
+  std::vector<size_t> count() const;
+  std::vector<double> weight() const;
+  std::vector<double> density() const;
+  std::vector<double> edges() const;
+  std::vector<double> mid() const;
+
+  // histogram, using the output format of "histogram(...)"
+  std::tuple<std::vector<double>, std::vector<double>> get(
+    bool density=false, bool return_edges=false) const;
+
+};
+
+// =================================================================================================
+// cppmat::quantile_sketch - approximate quantiles of data that is added in chunks ("push"), with
+// bounded memory (a KLL sketch)
+// - the rank of a quantile has an error below "accuracy" (as fraction of the number of entries),
+//   with high probability; the memory is about "3 * k" entries, with "k" about "2.3 / accuracy",
+//   independent of the number of entries
+// - sketches can be merged (e.g. per thread or per file), with the same accuracy
+// - the random choices are made by a "cppmat::random::engine" with seed "seed", whereby the result
+//   is reproducible
+// =================================================================================================
+
+class quantile_sketch
+{
+private:
+
+  size_t                           mK;          // accuracy parameter: capacity of the top level
+  cppmat::random::engine           mRng;        // random choices during compaction
+  std::vector<std::vector<double>> mLevels;     // entries of level "h" represent "2^h" entries
+  size_t                           mStored=0;   // number of stored entries (of all levels)
+  size_t                           mCapacity=0; // maximum number of stored entries (of all levels)
+  size_t                           mN=0;        // number of entries
+  double                           mMin;        // minimum of all data
+  double                           mMax;        // maximum of all data
+
+  // capacity of level "h" (geometrically decreasing towards the lowest level)
+  size_t capacity(size_t h) const;
+
+  // add a level (updates "mCapacity")
+  void grow();
+
+  // compact levels until the stored entries fit the capacity
+  void compress();
+
+  // stored entries (sorted) and their weights
+  void sorted(std::vector<double> &value, std::vector<double> &weight) const;
+
+public:
+
+  // constructors
+  quantile_sketch(double accuracy=0.01, uint64_t seed=0);
+
+  // add data
+  void push(double x);
+
+  template<class Iterator>
+  void push(Iterator first, Iterator last);
+
+  template<typename X>
+  void push(const std::vector<X> &data);
+
+  template<typename X>
+  void push(const X *data, size_t n);
+
+  // add the data of another sketch (with any accuracy)
+  void merge(const quantile_sketch &other);
+
+  // information
+  size_t k() const;      // accuracy parameter
+  size_t size() const;   // number of entries
+  size_t stored() const; // number of stored entries (the memory)
+  double min() const;    // minimum of all data (exact)
+  double max() const;    // maximum of all data (exact)
+
+  // estimated fraction of the entries "<= x"
+  double rank(double x) const;
+
+  // estimated quantile "q" (in "[0, 1]"), "0" and "1" are the exact minimum and maximum
+  double quantile(double q) const;
+  std::vector<double> quantiles(const std::vector<double> &q) const;
+
+  // histogram with (approximately) the same number of entries in each bin: the output format of
+  // "histogram_uniform(...)"
+  std::tuple<std::vector<double>, std::vector<double>> get(
+    size_t bins=10, bool density=false, bool return_edges=false) const;
+
+};
+
+// -------------------------------------------------------------------------------------------------
+
+// approximate "histogram_uniform" of the data of a sketch
+std::tuple<std::vector<double>, std::vector<double>> histogram_uniform(
+  const quantile_sketch &sketch, size_t bins=10, bool density=false, bool return_edges=false);
+
 // =================================================================================================
 
 } // namespace ...
@@ -13,6 +13,257 @@
 
 // -------------------------------------------------------------------------------------------------
 
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// histogram_accumulator with an adaptive range: integer arithmetic on the bin-index
+// =================================================================================================
+
+// index "floor(x / 2^k)" of the bin of width "2^k" that contains "x" (exact)
+inline int64_t histogram_index(double x, int k)
+{
+  return static_cast<int64_t>( std::floor( std::ldexp(x, -k) ) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// index "floor(i / 2^d)" of the bin of width "2^(k+d)" that contains the bin "i" of width "2^k"
+inline int64_t histogram_coarsen(int64_t i, int d)
+{
+  if ( d == 0 ) return i;
+  if ( d >= 63 ) return ( i < 0 ) ? -1 : 0;
+
+  if ( i >= 0 ) return i / ( static_cast<int64_t>(1) << d );
+
+  return - ( ( -(i+1) ) / ( static_cast<int64_t>(1) << d ) ) - 1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// smallest "k" such that "[min, max]" fits in "bins" bins of width "2^k", whereby the bin-width is
+// at least the resolution of the data (such that all indices are exactly represented)
+inline int histogram_exponent(double min, double max, size_t bins)
+{
+  // resolution
+  // - largest magnitude
+  double m = std::max(std::abs(min), std::abs(max));
+  // - lower bound on the exponent
+  int k = std::numeric_limits<double>::min_exponent - std::numeric_limits<double>::digits;
+  // - width of "ulp(m)", such that "m / 2^k < 2^53"
+  if ( m > 0.0 )
+    k = std::max(k, std::ilogb(m) - std::numeric_limits<double>::digits + 1);
+
+  // estimate from the range: "2^k >= (max - min) / bins" (written to avoid overflow)
+  double r = max / static_cast<double>(bins) - min / static_cast<double>(bins);
+  // - apply
+  if ( r > 0.0 )
+    k = std::max(k, std::ilogb(r));
+
+  // coarsen until the data fits (typically at most two iterations)
+  while ( histogram_index(max, k) - histogram_index(min, k) > static_cast<int64_t>(bins) - 1 )
+    ++k;
+
+  return k;
+}
+
+// =================================================================================================
+// binning of contiguous data: the bin-indices of a batch of entries are computed in a loop without
+// dependencies (that is vectorized), after which the counters are incremented
+// =================================================================================================
+
+// minimum and maximum of "[data, data+n)" (in parallel), "n > 0"
+template<typename X>
+inline std::pair<double,double> histogram_minmax(const X *data, size_t n)
+{
+  typedef std::pair<double,double> P;
+
+  return cppmat::Private::parallel_reduce(n, P(static_cast<double>(data[0]), static_cast<double>(data[0])),
+    [data](size_t begin, size_t end) {
+      P out(static_cast<double>(data[begin]), static_cast<double>(data[begin]));
+      for ( size_t i = begin ; i < end ; ++i ) {
+        out.first  = std::min(out.first , static_cast<double>(data[i]));
+        out.second = std::max(out.second, static_cast<double>(data[i]));
+      }
+      return out;
+    },
+    [](P a, P b) { return P(std::min(a.first, b.first), std::max(a.second, b.second)); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// fixed range: bin "min((x-lower)/h, bins-1)" of "[lower, upper]", bin "bins" below the range, and
+// bin "bins+1" above the range
+// N.B. the division is kept (and vectorized): a multiplication with the reciprocal of "h" rounds
+//      differently for entries close to a bin-edge, and correcting for that costs more than the
+//      division itself (the counters are the bottleneck)
+class histogram_linear
+{
+private:
+
+  size_t mBins;
+  double mLower;
+  double mUpper;
+  double mH;
+
+public:
+
+  histogram_linear(size_t bins, double lower, double upper, double h) :
+    mBins(bins), mLower(lower), mUpper(upper), mH(h) {}
+
+  // number of counters
+  size_t slots() const { return mBins+2; }
+
+  // bin-index of "x[k]" for "k < n <= CPPMAT_BATCH" (stored as floating point number, which is
+  // converted when the counter is incremented)
+  template<typename X>
+  void index(const X *x, size_t n, double *idx) const
+  {
+    const double top   = static_cast<double>(mBins-1);
+    const double below = static_cast<double>(mBins);
+    const double above = static_cast<double>(mBins+1);
+
+    CPPMAT_SIMD
+    for ( size_t k = 0 ; k < n ; ++k )
+    {
+      double xk = static_cast<double>(x[k]);
+      double ik = std::min( ( xk - mLower ) / mH, top );
+
+      idx[k] = ( xk < mLower ) ? below : ( ( xk > mUpper ) ? above : ik );
+    }
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+// adaptive range: bin "floor(x / 2^k) - offset" (the range must contain all data)
+class histogram_dyadic
+{
+private:
+
+  size_t  mBins;
+  int     mExp;
+  int64_t mOffset;
+
+public:
+
+  histogram_dyadic(size_t bins, int k, int64_t offset) : mBins(bins), mExp(k), mOffset(offset) {}
+
+  // number of counters
+  size_t slots() const { return mBins; }
+
+  // bin-index of "x[k]" for "k < n <= CPPMAT_BATCH" (see "histogram_linear")
+  template<typename X>
+  void index(const X *x, size_t n, double *idx) const
+  {
+    // "2^-k" is not representable: compute each index using "ldexp"
+    if ( -mExp >= std::numeric_limits<double>::max_exponent )
+    {
+      for ( size_t k = 0 ; k < n ; ++k )
+        idx[k] = static_cast<double>( histogram_index(static_cast<double>(x[k]), mExp) - mOffset );
+      return;
+    }
+
+    // a multiplication with "2^-k" is exact, as is the subtraction of the offset ("< 2^53")
+    const double scale  = std::ldexp(1., -mExp);
+    const double offset = static_cast<double>(mOffset);
+
+    CPPMAT_SIMD
+    for ( size_t k = 0 ; k < n ; ++k )
+      idx[k] = std::floor( static_cast<double>(x[k]) * scale ) - offset;
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+// maximum number of parts with private counters, and maximum total number of private counters
+// (whereby their memory is bounded, also for many bins)
+static const size_t histogram_parts    = 64;
+static const size_t histogram_counters = 4194304;
+
+// -------------------------------------------------------------------------------------------------
+
+// add "n" entries to the counters "count" and the weights "weight" (may be "nullptr"):
+// - "index(i, m, idx)" computes the bin-indices "idx[k]" of the entries "i+k" for "k < m" (with
+//   "m <= CPPMAT_BATCH"), each in "[0, slots)"
+// - the weight of entry "i" is "weights[i*wstride]", or one if "weights" is "nullptr"
+// N.B. the data is split in parts that only depend on "n" and "slots", which are binned in parallel
+//      with private counters, and then combined in order: also a sum of weights does not depend on
+//      the number of threads
+template<class F, typename W>
+inline void histogram_fill(size_t slots, size_t n, F index, const W *weights, ptrdiff_t wstride,
+  size_t *count, double *weight)
+{
+  // number of parts
+  size_t bs = CPPMAT_PARALLEL_BLOCK;
+  size_t np = std::min((n + bs - 1) / bs, histogram_parts);
+  // - bound the memory
+  np = std::min(np, std::max(static_cast<size_t>(1), histogram_counters / slots));
+
+  // empty input : nothing to do
+  if ( np == 0 ) return;
+
+  // private counters
+  std::vector<size_t> pcount(np*slots, 0);
+  std::vector<double> pweight(weight ? np*slots : 0, 0.0);
+
+  // bin each part
+  cppmat::Private::parallel_for(np, n, [&](size_t begin, size_t end)
+  {
+    double idx[CPPMAT_BATCH];
+
+    for ( size_t p = begin ; p < end ; ++p )
+    {
+      size_t *c  = &pcount[p*slots];
+      double *w  = weight ? &pweight[p*slots] : nullptr;
+      size_t  i1 = ( n * (p+1) ) / np;
+
+      for ( size_t i = ( n * p ) / np ; i < i1 ; i += CPPMAT_BATCH )
+      {
+        size_t m = std::min(static_cast<size_t>(CPPMAT_BATCH), i1 - i);
+
+        index(i, m, idx);
+
+        for ( size_t k = 0 ; k < m ; ++k ) c[static_cast<size_t>(idx[k])]++;
+
+        if ( w and weights )
+          for ( size_t k = 0 ; k < m ; ++k )
+            w[static_cast<size_t>(idx[k])] += static_cast<double>(weights[static_cast<ptrdiff_t>(i+k)*wstride]);
+        else if ( w )
+          for ( size_t k = 0 ; k < m ; ++k ) w[static_cast<size_t>(idx[k])] += 1.0;
+      }
+    }
+  });
+
+  // combine, always in the same order
+  for ( size_t p = 0 ; p < np ; ++p )
+    for ( size_t j = 0 ; j < slots ; ++j )
+      count[j] += pcount[p*slots+j];
+
+  if ( weight )
+    for ( size_t p = 0 ; p < np ; ++p )
+      for ( size_t j = 0 ; j < slots ; ++j )
+        weight[j] += pweight[p*slots+j];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// add "[data, data+n)", using the bin-indices of "bin" (see "histogram_linear")
+template<class B, typename X, typename W>
+inline void histogram_fill(const B &bin, const X *data, const W *weights, size_t n,
+  size_t *count, double *weight)
+{
+  histogram_fill(bin.slots(), n, [&bin,data](size_t i, size_t m, double *idx) {
+    bin.index(data+i, m, idx);
+  }, weights, 1, count, weight);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
 namespace cppmat {
 
 // =================================================================================================
@@ -21,33 +272,61 @@ template<typename X>
 std::tuple<std::vector<double>, std::vector<double>> histogram(
   const std::vector<X> &data, size_t bins, bool density, bool return_edges)
 {
-  // alias
-  double Bins = static_cast<double>(bins);
-  double N    = static_cast<double>(data.size());
+  return histogram(data.data(), data.size(), bins, density, return_edges);
+}
 
-  // get domain, and discretization size
-  double min = *std::min_element(data.begin(),data.end());
-  double max = *std::max_element(data.begin(),data.end());
-  double h   = (max - min) / Bins;
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+std::tuple<std::vector<double>, std::vector<double>> histogram(
+  const X *data, size_t n, size_t bins, bool density, bool return_edges)
+{
+  Assert( n > 0 );
+
+  // get domain
+  auto minmax = cppmat::Private::histogram_minmax(data, n);
 
   // histogram
-  // - zero-initialize
-  std::vector<size_t> count(bins, 0);
+  // - allocate
+  histogram_accumulator out(bins, minmax.first, minmax.second);
   // - fill
-  for ( auto &i : data )
-    count[std::min(static_cast<size_t>((static_cast<double>(i)-min)/h),bins-1)]++;
+  out.push(data, n);
 
-  // type-cast
-  std::vector<double> countD(count.begin(), count.end());
+  // return output
+  return out.get(density, return_edges);
+}
 
-  // convert to density: set the integral to one
-  if ( density )
-    for ( auto &i : countD )
-      i /= ( h * N );
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+std::tuple<std::vector<double>, std::vector<double>> histogram(
+  const std::vector<X> &data, const std::vector<W> &weights, size_t bins, bool density,
+  bool return_edges)
+{
+  Assert( data.size() == weights.size() );
+
+  return histogram(data.data(), weights.data(), data.size(), bins, density, return_edges);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+std::tuple<std::vector<double>, std::vector<double>> histogram(
+  const X *data, const W *weights, size_t n, size_t bins, bool density, bool return_edges)
+{
+  Assert( n > 0 );
+
+  // get domain
+  auto minmax = cppmat::Private::histogram_minmax(data, n);
+
+  // histogram
+  // - allocate
+  histogram_accumulator out(bins, minmax.first, minmax.second);
+  // - fill
+  out.push(data, weights, n);
 
   // return output
-  if ( return_edges ) return std::make_tuple(countD, cppmat::linspace(min     , max     , bins+1));
-  else                return std::make_tuple(countD, cppmat::linspace(min+h/2., max-h/2., bins  ));
+  return out.get(density, return_edges);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -144,4 +423,843 @@ std::tuple<std::vector<double>, std::vector<double>> histogram_uniform(
 
 // -------------------------------------------------------------------------------------------------
 
+namespace cppmat {
+
+// =================================================================================================
+// histogram_accumulator : constructors
+// =================================================================================================
+
+inline
+histogram_accumulator::histogram_accumulator(size_t bins, double lower, double upper) :
+  mAdaptive(false), mBins(bins), mCount(bins, 0), mLower(lower), mUpper(upper)
+{
+  Assert( bins > 0 );
+  Assert( lower < upper );
+
+  mH = ( upper - lower ) / static_cast<double>(bins);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+histogram_accumulator::histogram_accumulator(size_t bins) :
+  mAdaptive(true), mBins(bins), mCount(bins, 0)
+{
+  Assert( bins >= 2 );
+}
+
+// =================================================================================================
+// histogram_accumulator : grow the adaptive range
+// =================================================================================================
+
+inline
+void histogram_accumulator::grow(double min, double max)
+{
+  // empty : initialize
+  if ( mN == 0 )
+  {
+    mMin    = min;
+    mMax    = max;
+    mExp    = cppmat::Private::histogram_exponent(min, max, mBins);
+    mOffset = cppmat::Private::histogram_index(min, mExp);
+    return;
+  }
+
+  // new range
+  mMin = std::min(mMin, min);
+  mMax = std::max(mMax, max);
+
+  // new bins (never finer than the current bins)
+  int     k      = std::max(mExp, cppmat::Private::histogram_exponent(mMin, mMax, mBins));
+  int64_t offset = cppmat::Private::histogram_index(mMin, k);
+
+  // bins unchanged : done
+  if ( k == mExp and offset == mOffset ) return;
+
+  // rebin : each current bin is contained in exactly one new bin
+  // - zero-initialize
+  std::vector<size_t> count(mBins, 0);
+  std::vector<double> weight(mWeighted ? mBins : 0, 0.0);
+  // - fill
+  for ( size_t i = 0 ; i < mBins ; ++i )
+  {
+    if ( mCount[i] == 0 ) continue;
+
+    size_t j = cppmat::Private::histogram_coarsen(mOffset + static_cast<int64_t>(i), k - mExp) - offset;
+
+    count[j] += mCount[i];
+
+    if ( mWeighted ) weight[j] += mWeight[i];
+  }
+
+  // store
+  mCount  = std::move(count);
+  mWeight = std::move(weight);
+  mExp    = k;
+  mOffset = offset;
+}
+
+// =================================================================================================
+// histogram_accumulator : start to store weights
+// =================================================================================================
+
+inline
+void histogram_accumulator::weighted()
+{
+  if ( mWeighted ) return;
+
+  mWeighted = true;
+  mWeight   = std::vector<double>(mCount.begin(), mCount.end());
+}
+
+// =================================================================================================
+// histogram_accumulator : add data
+// =================================================================================================
+
+template<typename X, typename W>
+inline
+void histogram_accumulator::add(const X *data, const W *weights, size_t n)
+{
+  // empty input : nothing to do
+  if ( n == 0 ) return;
+
+  // range of the new data
+  auto minmax = cppmat::Private::histogram_minmax(data, n);
+
+  // adaptive range
+  if ( mAdaptive )
+  {
+    // - grow the range once to contain all new data
+    grow(minmax.first, minmax.second);
+    // - add
+    cppmat::Private::histogram_fill(cppmat::Private::histogram_dyadic(mBins, mExp, mOffset),
+      data, weights, n, mCount.data(), mWeighted ? mWeight.data() : nullptr);
+    // - update size
+    mN += n;
+    return;
+  }
+
+  // fixed range
+  // - update range of the data
+  if ( mN + mUnder + mOver == 0 ) { mMin = minmax.first; mMax = minmax.second; }
+  else { mMin = std::min(mMin, minmax.first); mMax = std::max(mMax, minmax.second); }
+  // - bin, including the counters below and above the range
+  std::vector<size_t> count(mBins+2, 0);
+  std::vector<double> weight(mWeighted ? mBins+2 : 0, 0.0);
+  // - fill
+  cppmat::Private::histogram_fill(cppmat::Private::histogram_linear(mBins, mLower, mUpper, mH),
+    data, weights, n, count.data(), mWeighted ? weight.data() : nullptr);
+  // - add
+  for ( size_t j = 0 ; j < mBins ; ++j ) mCount[j] += count[j];
+  // - add
+  if ( mWeighted ) for ( size_t j = 0 ; j < mBins ; ++j ) mWeight[j] += weight[j];
+  // - update sizes
+  mUnder += count[mBins  ];
+  mOver  += count[mBins+1];
+  mN     += n - count[mBins] - count[mBins+1];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void histogram_accumulator::push(double x)
+{
+  // adaptive range
+  if ( mAdaptive )
+  {
+    // grow the range (if needed)
+    if ( mN == 0 or x < mMin or x > mMax ) grow(x, x);
+
+    // add
+    size_t j = cppmat::Private::histogram_index(x, mExp) - mOffset;
+    // - count
+    mCount[j]++;
+    mN++;
+    // - weight
+    if ( mWeighted ) mWeight[j] += 1.0;
+    return;
+  }
+
+  // fixed range
+  // - update range of the data
+  if ( mN + mUnder + mOver == 0 ) { mMin = x; mMax = x; }
+  else { mMin = std::min(mMin, x); mMax = std::max(mMax, x); }
+  // - add
+  if      ( x < mLower ) { mUnder++; }
+  else if ( x > mUpper ) { mOver++;  }
+  else
+  {
+    size_t j = std::min(static_cast<size_t>((x-mLower)/mH),mBins-1);
+
+    mCount[j]++;
+    mN++;
+
+    if ( mWeighted ) mWeight[j] += 1.0;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator>
+inline
+void histogram_accumulator::push(Iterator first, Iterator last)
+{
+  // empty input : nothing to do
+  if ( first == last ) return;
+
+  // fixed range
+  if ( !mAdaptive )
+  {
+    for ( auto it = first ; it != last ; ++it ) push(static_cast<double>(*it));
+    return;
+  }
+
+  // adaptive range
+  // - grow the range once to contain all new data
+  auto minmax = std::minmax_element(first, last);
+  // - apply
+  grow(static_cast<double>(*minmax.first), static_cast<double>(*minmax.second));
+  // - add
+  for ( auto it = first ; it != last ; ++it )
+  {
+    size_t j = cppmat::Private::histogram_index(static_cast<double>(*it), mExp) - mOffset;
+
+    mCount[j]++;
+
+    if ( mWeighted ) mWeight[j] += 1.0;
+  }
+  // - update size
+  mN += static_cast<size_t>(std::distance(first, last));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void histogram_accumulator::push(const std::vector<X> &data)
+{
+  push(data.data(), data.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void histogram_accumulator::push(const X *data, size_t n)
+{
+  add(data, static_cast<const double*>(nullptr), n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+inline
+void histogram_accumulator::push(const std::vector<X> &data, const std::vector<W> &weights)
+{
+  Assert( data.size() == weights.size() );
+
+  push(data.data(), weights.data(), data.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+inline
+void histogram_accumulator::push(const X *data, const W *weights, size_t n)
+{
+  weighted();
+
+  add(data, weights, n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void histogram_accumulator::merge(const histogram_accumulator &other)
+{
+  Assert( mAdaptive == other.mAdaptive );
+  Assert( mBins     == other.mBins     );
+
+  // other empty : nothing to do
+  if ( other.mN + other.mUnder + other.mOver == 0 ) return;
+
+  // store weights if the other accumulator does
+  if ( other.mWeighted ) weighted();
+
+  // weights of the other accumulator
+  std::vector<double> weight;
+  // - copy
+  if ( mWeighted ) weight = other.weight();
+
+  // fixed range
+  if ( !mAdaptive )
+  {
+    Assert( mLower == other.mLower );
+    Assert( mUpper == other.mUpper );
+
+    // - update range of the data
+    if ( mN + mUnder + mOver == 0 ) { mMin = other.mMin; mMax = other.mMax; }
+    else { mMin = std::min(mMin, other.mMin); mMax = std::max(mMax, other.mMax); }
+    // - add
+    for ( size_t i = 0 ; i < mBins ; ++i ) mCount[i] += other.mCount[i];
+    // - add
+    if ( mWeighted ) for ( size_t i = 0 ; i < mBins ; ++i ) mWeight[i] += weight[i];
+    // - update sizes
+    mN     += other.mN;
+    mUnder += other.mUnder;
+    mOver  += other.mOver;
+    return;
+  }
+
+  // adaptive range
+  // - grow the range such that it contains the other range (whereby the bins are at least as
+  //   coarse as the other bins, as the bin-width only depends on the range)
+  grow(other.mMin, other.mMax);
+  // - check
+  Assert( mExp >= other.mExp );
+  // - add
+  for ( size_t i = 0 ; i < mBins ; ++i )
+  {
+    if ( other.mCount[i] == 0 ) continue;
+
+    size_t j = cppmat::Private::histogram_coarsen(other.mOffset + static_cast<int64_t>(i), mExp - other.mExp) - mOffset;
+
+    mCount[j] += other.mCount[i];
+
+    if ( mWeighted ) mWeight[j] += weight[i];
+  }
+  // - update size
+  mN += other.mN;
+}
+
+// =================================================================================================
+// histogram_accumulator : information
+// =================================================================================================
+
+inline
+bool histogram_accumulator::adaptive() const
+{
+  return mAdaptive;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t histogram_accumulator::bins() const
+{
+  return mBins;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t histogram_accumulator::size() const
+{
+  return mN;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t histogram_accumulator::underflow() const
+{
+  return mUnder;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t histogram_accumulator::overflow() const
+{
+  return mOver;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double histogram_accumulator::min() const
+{
+  Assert( mN + mUnder + mOver > 0 );
+
+  return mMin;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double histogram_accumulator::max() const
+{
+  Assert( mN + mUnder + mOver > 0 );
+
+  return mMax;
+}
+
+// =================================================================================================
+// histogram_accumulator : histogram
+// =================================================================================================
+
+inline
+std::vector<size_t> histogram_accumulator::count() const
+{
+  return mCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_accumulator::weight() const
+{
+  if ( mWeighted ) return mWeight;
+
+  return std::vector<double>(mCount.begin(), mCount.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_accumulator::density() const
+{
+  Assert( mN > 0 );
+
+  // sum of the weights (or the count)
+  std::vector<double> out = weight();
+
+  // alias
+  double N = std::accumulate(out.begin(), out.end(), 0.0);
+  double h = mAdaptive ? std::ldexp(1.0, mExp) : mH;
+
+  // convert to density: set the integral to one
+  for ( auto &i : out )
+    i /= ( h * N );
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_accumulator::edges() const
+{
+  // fixed range
+  if ( !mAdaptive )
+    return cppmat::linspace(mLower, mUpper, mBins+1);
+
+  // adaptive range
+  // - allocate
+  std::vector<double> out(mBins+1);
+  // - compute
+  for ( size_t i = 0 ; i <= mBins ; ++i )
+    out[i] = std::ldexp(static_cast<double>(mOffset + static_cast<int64_t>(i)), mExp);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_accumulator::mid() const
+{
+  // fixed range
+  if ( !mAdaptive )
+    return cppmat::linspace(mLower+mH/2., mUpper-mH/2., mBins);
+
+  // adaptive range
+  // - allocate
+  std::vector<double> out(mBins);
+  // - compute
+  for ( size_t i = 0 ; i < mBins ; ++i )
+    out[i] = std::ldexp(static_cast<double>(mOffset + static_cast<int64_t>(i)) + 0.5, mExp);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::tuple<std::vector<double>, std::vector<double>> histogram_accumulator::get(
+  bool density, bool return_edges) const
+{
+  // count, or normalized count
+  std::vector<double> count;
+  // - fill
+  if ( density ) count = this->density();
+  else           count = weight();
+
+  // return output
+  if ( return_edges ) return std::make_tuple(count, edges());
+  else                return std::make_tuple(count, mid  ());
+}
+
+// =================================================================================================
+// quantile_sketch : constructors
+// =================================================================================================
+
+inline
+quantile_sketch::quantile_sketch(double accuracy, uint64_t seed) : mRng(seed)
+{
+  Assert( accuracy > 0.0 and accuracy < 1.0 );
+
+  // empirical relation between "k" and the (99% confidence) normalized rank error of a KLL sketch:
+  // "accuracy = 2.296 / k^0.9723"
+  mK = std::max(static_cast<size_t>(8), static_cast<size_t>(std::ceil(std::pow(2.296/accuracy, 1./0.9723))));
+
+  grow();
+}
+
+// =================================================================================================
+// quantile_sketch : levels
+// =================================================================================================
+
+inline
+size_t quantile_sketch::capacity(size_t h) const
+{
+  // depth below the top level
+  double depth = static_cast<double>(mLevels.size() - 1 - h);
+
+  return std::max(static_cast<size_t>(2),
+    static_cast<size_t>(std::ceil(static_cast<double>(mK) * std::pow(2./3., depth))));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void quantile_sketch::grow()
+{
+  mLevels.push_back(std::vector<double>());
+
+  mCapacity = 0;
+
+  for ( size_t h = 0 ; h < mLevels.size() ; ++h )
+    mCapacity += capacity(h);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void quantile_sketch::compress()
+{
+  while ( mStored > mCapacity )
+  {
+    for ( size_t h = 0 ; h < mLevels.size() ; ++h )
+    {
+      if ( mLevels[h].size() < capacity(h) ) continue;
+
+      // new top level
+      if ( h+1 == mLevels.size() ) grow();
+
+      // alias
+      std::vector<double> &level = mLevels[h];
+      std::vector<double> &up    = mLevels[h+1];
+
+      // sort
+      std::sort(level.begin(), level.end());
+
+      // an odd entry remains at this level
+      size_t n = level.size() - level.size() % 2;
+
+      // promote every other entry (of weight "2^h") as one entry of weight "2^(h+1)", starting at a
+      // random offset, whereby the estimated rank is unbiased
+      size_t offset = static_cast<size_t>(mRng() & 1);
+
+      for ( size_t i = offset ; i < n ; i += 2 )
+        up.push_back(level[i]);
+
+      // remove the compacted entries
+      level.erase(level.begin(), level.begin() + n);
+
+      // update size
+      mStored -= n / 2;
+
+      break;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void quantile_sketch::sorted(std::vector<double> &value, std::vector<double> &weight) const
+{
+  // entries, and their weights
+  std::vector<std::pair<double,double>> entries;
+  // - allocate
+  entries.reserve(mStored);
+  // - copy
+  for ( size_t h = 0 ; h < mLevels.size() ; ++h )
+    for ( auto &x : mLevels[h] )
+      entries.push_back(std::make_pair(x, std::ldexp(1.0, static_cast<int>(h))));
+
+  // sort by value
+  std::sort(entries.begin(), entries.end());
+
+  // split
+  value .resize(entries.size());
+  weight.resize(entries.size());
+
+  for ( size_t i = 0 ; i < entries.size() ; ++i ) {
+    value [i] = entries[i].first;
+    weight[i] = entries[i].second;
+  }
+}
+
+// =================================================================================================
+// quantile_sketch : add data
+// =================================================================================================
+
+inline
+void quantile_sketch::push(double x)
+{
+  // update range of the data
+  if ( mN == 0 ) { mMin = x; mMax = x; }
+  else { mMin = std::min(mMin, x); mMax = std::max(mMax, x); }
+
+  // add
+  mLevels[0].push_back(x);
+  mStored++;
+  mN++;
+
+  // compact if needed
+  if ( mStored > mCapacity ) compress();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator>
+inline
+void quantile_sketch::push(Iterator first, Iterator last)
+{
+  for ( auto it = first ; it != last ; ++it )
+    push(static_cast<double>(*it));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void quantile_sketch::push(const std::vector<X> &data)
+{
+  push(data.begin(), data.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void quantile_sketch::push(const X *data, size_t n)
+{
+  push(data, data+n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void quantile_sketch::merge(const quantile_sketch &other)
+{
+  // other empty : nothing to do
+  if ( other.mN == 0 ) return;
+
+  // update range of the data
+  if ( mN == 0 ) { mMin = other.mMin; mMax = other.mMax; }
+  else { mMin = std::min(mMin, other.mMin); mMax = std::max(mMax, other.mMax); }
+
+  // add levels if needed
+  while ( mLevels.size() < other.mLevels.size() ) grow();
+
+  // add the entries of each level
+  for ( size_t h = 0 ; h < other.mLevels.size() ; ++h )
+    mLevels[h].insert(mLevels[h].end(), other.mLevels[h].begin(), other.mLevels[h].end());
+
+  // update size
+  mStored += other.mStored;
+  mN      += other.mN;
+
+  // compact if needed
+  compress();
+}
+
+// =================================================================================================
+// quantile_sketch : information
+// =================================================================================================
+
+inline
+size_t quantile_sketch::k() const
+{
+  return mK;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t quantile_sketch::size() const
+{
+  return mN;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t quantile_sketch::stored() const
+{
+  return mStored;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double quantile_sketch::min() const
+{
+  Assert( mN > 0 );
+
+  return mMin;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double quantile_sketch::max() const
+{
+  Assert( mN > 0 );
+
+  return mMax;
+}
+
+// =================================================================================================
+// quantile_sketch : quantiles
+// =================================================================================================
+
+inline
+double quantile_sketch::rank(double x) const
+{
+  Assert( mN > 0 );
+
+  // total weight of the entries "<= x"
+  double out = 0.0;
+
+  for ( size_t h = 0 ; h < mLevels.size() ; ++h )
+    for ( auto &i : mLevels[h] )
+      if ( i <= x )
+        out += std::ldexp(1.0, static_cast<int>(h));
+
+  return out / static_cast<double>(mN);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double quantile_sketch::quantile(double q) const
+{
+  return quantiles(std::vector<double>(1, q))[0];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> quantile_sketch::quantiles(const std::vector<double> &q) const
+{
+  Assert( mN > 0 );
+
+  // stored entries, sorted, and their weights
+  std::vector<double> value, weight;
+  // - compute
+  sorted(value, weight);
+
+  // cumulative weight
+  std::partial_sum(weight.begin(), weight.end(), weight.begin());
+
+  // allocate output
+  std::vector<double> out(q.size());
+
+  // compute: the first entry whose cumulative weight reaches "q * N"
+  for ( size_t i = 0 ; i < q.size() ; ++i )
+  {
+    Assert( q[i] >= 0.0 and q[i] <= 1.0 );
+
+    if      ( q[i] <= 0.0 ) { out[i] = mMin; }
+    else if ( q[i] >= 1.0 ) { out[i] = mMax; }
+    else
+    {
+      double target = q[i] * static_cast<double>(mN);
+      size_t j      = std::lower_bound(weight.begin(), weight.end(), target) - weight.begin();
+
+      out[i] = value[std::min(j, value.size()-1)];
+    }
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::tuple<std::vector<double>, std::vector<double>> quantile_sketch::get(
+  size_t bins, bool density, bool return_edges) const
+{
+  Assert( bins > 0 );
+  Assert( mN > 0 );
+
+  // edges: quantiles at equal intervals
+  // - quantiles
+  std::vector<double> q = cppmat::linspace(0.0, 1.0, bins+1);
+  // - compute
+  std::vector<double> edges = quantiles(q);
+  // - the outer edges are exact
+  edges[0]    = mMin;
+  edges[bins] = mMax;
+
+  // estimated count: the weight of the stored entries in each bin (as "histogram_uniform": an
+  // entry on an edge is part of the bin that starts at it, the maximum is part of the last bin)
+  // - stored entries, sorted, and their weights
+  std::vector<double> value, weight;
+  // - compute
+  sorted(value, weight);
+  // - zero-initialize count
+  std::vector<double> count(bins, 0.0);
+  // - zero-initialize current bin
+  size_t ibin = 0;
+  // - loop over entries
+  for ( size_t i = 0 ; i < value.size() ; ++i )
+  {
+    // update bin-index
+    while ( value[i] >= edges[ibin+1] and ibin < bins-1 ) ibin++;
+    // update count
+    count[ibin] += weight[i];
+  }
+
+  // convert to density: set the integral to one
+  if ( density )
+  {
+    for ( size_t i = 0 ; i < bins ; ++i )
+      count[i] /= ( (edges[i+1]-edges[i]) * static_cast<double>(mN) );
+  }
+
+  // return edges
+  if ( return_edges ) return std::make_tuple(count, edges);
+
+  // return mid-points
+  // - allocate
+  std::vector<double> mid(bins);
+  // - compute
+  for ( size_t i = 0 ; i < bins ; ++i )
+    mid[i] = ( edges[i+1] + edges[i] ) / 2.;
+  // - return
+  return std::make_tuple(count, mid);
+}
+
+// =================================================================================================
+// approximate "histogram_uniform"
+// =================================================================================================
+
+inline
+std::tuple<std::vector<double>, std::vector<double>> histogram_uniform(
+  const quantile_sketch &sketch, size_t bins, bool density, bool return_edges)
+{
+  return sketch.get(bins, density, return_edges);
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
 #endif
@@ -0,0 +1,165 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_HISTOGRAM_ND_H
+#define CPPMAT_HISTOGRAM_ND_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// cppmat::histogram_axis - bins along one axis of a (multidimensional) histogram
+// - "Linear" : "bins" bins of equal width in "[lower, upper]" (as "histogram")
+// - "Log"    : "bins" bins of equal width in "[log(lower), log(upper)]"
+// - "Edges"  : custom bins, "edges" must be increasing
+// - a bin includes its lower edge, the last bin also includes its upper edge
+// =================================================================================================
+
+class histogram_axis
+{
+private:
+
+  int                 mType=0;    // 0: linear, 1: logarithmic, 2: custom edges
+  size_t              mBins=0;    // number of bins
+  double              mLower=0.0; // lower edge of the first bin
+  double              mUpper=0.0; // upper edge of the last bin
+  double              mOffset;    // linear/logarithmic: "lower" or "log(lower)"
+  double              mH;         // linear/logarithmic: bin-width (of "x" or "log(x)")
+  std::vector<double> mEdges;     // custom edges
+
+public:
+
+  // constructor: empty
+  histogram_axis() = default;
+
+  // named constructors
+  static histogram_axis Linear(size_t bins, double lower, double upper);
+  static histogram_axis Log   (size_t bins, double lower, double upper);
+  static histogram_axis Edges (const std::vector<double> &edges);
+
+  // number of bins, and the range of the axis
+  size_t bins() const;
+  double lower() const;
+  double upper() const;
+
+  // bin-edges ("bins+1"), bin-midpoints (geometric for "Log"), and bin-widths
+  std::vector<double> edges() const;
+  std::vector<double> mid() const;
+  std::vector<double> width() const;
+
+  // bin-index of "x[k*stride]" for "k < n <= CPPMAT_BATCH" (an integer, stored as floating point
+  // number), or "bins()" if it is outside the range
+  template<typename X>
+  void index(const X *x, ptrdiff_t stride, size_t n, double *idx) const;
+
+};
+
+// =================================================================================================
+// cppmat::histogram_nd - multidimensional histogram, to which data is added in chunks ("push")
+// - the data is read without copy: per axis a view of the same shape (e.g. two fields, or two
+//   columns of an array)
+// - optionally weights (of the same shape as the data): the weight is the sum of the weights in a
+//   bin; without weights the weight equals the count
+// - the data is binned in parallel (with private counters per part of the data)
+// - accumulators with the same axes can be merged (e.g. per thread or per file)
+// =================================================================================================
+
+class histogram_nd
+{
+private:
+
+  std::vector<histogram_axis> mAxes;           // bins along each axis
+  std::vector<size_t>         mShape;          // number of bins along each axis
+  size_t                      mSize=0;         // total number of bins
+  std::vector<size_t>         mCount;          // count per bin (row-major)
+  bool                        mWeighted=false; // weights have been added
+  std::vector<double>         mWeight;         // sum of the weights per bin (only if "mWeighted")
+  size_t                      mN=0;            // number of entries in the bins
+  size_t                      mOutside=0;      // number of entries outside the bins
+
+  // start to store weights (the weight of all current entries is one)
+  void weighted();
+
+  // add data, "weights" may be an empty view
+  template<typename X, typename W>
+  void add(
+    const std::vector<cppmat::view::strided<const X>> &data,
+    const cppmat::view::strided<const W> &weights);
+
+public:
+
+  // constructors
+  histogram_nd() = default;
+  histogram_nd(const std::vector<histogram_axis> &axes);
+
+  // add data: one view per axis (all of the same shape)
+  template<typename X>
+  void push(const std::vector<cppmat::view::strided<const X>> &data);
+
+  template<typename X, typename W>
+  void push(
+    const std::vector<cppmat::view::strided<const X>> &data,
+    const cppmat::view::strided<const W> &weights);
+
+  // add data: an array of shape "[n, rank()]" (one row per entry)
+  template<typename X>
+  void push(const cppmat::array<X> &data);
+
+  template<typename X, typename W>
+  void push(const cppmat::array<X> &data, const cppmat::array<W> &weights);
+
+  // add the data of another histogram (with the same axes)
+  void merge(const histogram_nd &other);
+
+  // information
+  size_t                rank() const;          // number of axes
+  std::vector<size_t>   shape() const;         // number of bins along each axis
+  const histogram_axis& axis(size_t i) const;  // bins along axis "i"
+  size_t                size() const;          // number of entries in the bins
+  size_t                outside() const;       // number of entries outside the bins
+
+  // histogram: count, sum of the weights, or normalized sum of the weights (the integral over the
+  // volume of the bins is one), all of shape "shape()"
+  cppmat::array<size_t> count() const;
+  cppmat::array<double> weight() const;
+  cppmat::array<double> density() const;
+
+  // bin-edges and bin-midpoints along each axis
+  std::vector<std::vector<double>> edges() const;
+  std::vector<std::vector<double>> mid() const;
+
+  // histogram, and the locations of the bins along each axis
+  std::tuple<cppmat::array<double>, std::vector<std::vector<double>>> get(
+    bool density=false, bool return_edges=false) const;
+
+};
+
+// =================================================================================================
+// multidimensional histogram of data (one view per axis), with optional weights
+// =================================================================================================
+
+template<typename X>
+std::tuple<cppmat::array<double>, std::vector<std::vector<double>>> histogramdd(
+  const std::vector<cppmat::view::strided<const X>> &data,
+  const std::vector<histogram_axis> &axes, bool density=false, bool return_edges=false);
+
+template<typename X, typename W>
+std::tuple<cppmat::array<double>, std::vector<std::vector<double>>> histogramdd(
+  const std::vector<cppmat::view::strided<const X>> &data, const cppmat::view::strided<const W> &weights,
+  const std::vector<histogram_axis> &axes, bool density=false, bool return_edges=false);
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,651 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_HISTOGRAM_ND_HPP
+#define CPPMAT_HISTOGRAM_ND_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "histogram_nd.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// support functions
+// =================================================================================================
+
+// constant stride "s" such that the "i"-th entry (in row-major order) of a view is "data()[i*s]"
+// (e.g. a contiguous view, or a column of an array), "false" if there is no such stride (e.g. a
+// sub-block of a matrix)
+template<typename X>
+inline bool histogram_stride(const cppmat::view::strided<X> &A, ptrdiff_t &stride)
+{
+  std::vector<size_t>    shape   = A.shape();
+  std::vector<ptrdiff_t> strides = A.strides();
+
+  // stride of the last axis with more than one entry, and the expected stride of each axis
+  ptrdiff_t out    = 0;
+  ptrdiff_t expect = 0;
+
+  for ( size_t i = shape.size() ; i-- > 0 ; )
+  {
+    if ( shape[i] == 1 ) continue;
+
+    if ( out == 0 ) { out = strides[i]; expect = out; }
+
+    if ( strides[i] != expect ) return false;
+
+    expect *= static_cast<ptrdiff_t>(shape[i]);
+  }
+
+  stride = ( out == 0 ) ? 1 : out;
+
+  return true;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// histogram_axis : named constructors
+// =================================================================================================
+
+inline
+histogram_axis histogram_axis::Linear(size_t bins, double lower, double upper)
+{
+  Assert( bins > 0 );
+  Assert( lower < upper );
+
+  histogram_axis out;
+
+  out.mType   = 0;
+  out.mBins   = bins;
+  out.mLower  = lower;
+  out.mUpper  = upper;
+  out.mOffset = lower;
+  out.mH      = ( upper - lower ) / static_cast<double>(bins);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+histogram_axis histogram_axis::Log(size_t bins, double lower, double upper)
+{
+  Assert( bins > 0 );
+  Assert( lower > 0.0 );
+  Assert( lower < upper );
+
+  histogram_axis out;
+
+  out.mType   = 1;
+  out.mBins   = bins;
+  out.mLower  = lower;
+  out.mUpper  = upper;
+  out.mOffset = std::log(lower);
+  out.mH      = ( std::log(upper) - std::log(lower) ) / static_cast<double>(bins);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+histogram_axis histogram_axis::Edges(const std::vector<double> &edges)
+{
+  Assert( edges.size() >= 2 );
+
+  for ( size_t i = 0 ; i < edges.size()-1 ; ++i )
+    Assert( edges[i] < edges[i+1] );
+
+  histogram_axis out;
+
+  out.mType  = 2;
+  out.mBins  = edges.size()-1;
+  out.mLower = edges.front();
+  out.mUpper = edges.back();
+  out.mEdges = edges;
+
+  return out;
+}
+
+// =================================================================================================
+// histogram_axis : information
+// =================================================================================================
+
+inline
+size_t histogram_axis::bins() const
+{
+  return mBins;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double histogram_axis::lower() const
+{
+  return mLower;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+double histogram_axis::upper() const
+{
+  return mUpper;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_axis::edges() const
+{
+  // custom edges
+  if ( mType == 2 ) return mEdges;
+
+  // linear
+  if ( mType == 0 ) return cppmat::linspace(mLower, mUpper, mBins+1);
+
+  // logarithmic
+  std::vector<double> out = cppmat::linspace(std::log(mLower), std::log(mUpper), mBins+1);
+  // - convert
+  for ( auto &i : out ) i = std::exp(i);
+  // - exact outer edges
+  out.front() = mLower;
+  out.back () = mUpper;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_axis::mid() const
+{
+  std::vector<double> edges = this->edges();
+  std::vector<double> out(mBins);
+
+  for ( size_t i = 0 ; i < mBins ; ++i )
+  {
+    if ( mType == 1 ) out[i] = std::sqrt( edges[i] * edges[i+1] );
+    else              out[i] = ( edges[i] + edges[i+1] ) / 2.;
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<double> histogram_axis::width() const
+{
+  std::vector<double> edges = this->edges();
+  std::vector<double> out(mBins);
+
+  for ( size_t i = 0 ; i < mBins ; ++i )
+    out[i] = edges[i+1] - edges[i];
+
+  return out;
+}
+
+// =================================================================================================
+// histogram_axis : bin-index
+// =================================================================================================
+
+template<typename X>
+inline
+void histogram_axis::index(const X *x, ptrdiff_t stride, size_t n, double *idx) const
+{
+  const double top     = static_cast<double>(mBins-1);
+  const double outside = static_cast<double>(mBins);
+
+  // custom edges: bisection
+  if ( mType == 2 )
+  {
+    for ( size_t k = 0 ; k < n ; ++k )
+    {
+      double xk = static_cast<double>(x[static_cast<ptrdiff_t>(k)*stride]);
+
+      if ( !( xk >= mLower and xk <= mUpper ) ) { idx[k] = outside; continue; }
+
+      size_t i = std::upper_bound(mEdges.begin(), mEdges.end(), xk) - mEdges.begin();
+
+      idx[k] = std::min(static_cast<double>(i) - 1., top);
+    }
+    return;
+  }
+
+  // linear: as "histogram" (also "NaN" is outside)
+  if ( mType == 0 )
+  {
+    CPPMAT_SIMD
+    for ( size_t k = 0 ; k < n ; ++k )
+    {
+      double xk = static_cast<double>(x[static_cast<ptrdiff_t>(k)*stride]);
+      double ik = std::min( std::floor( ( xk - mOffset ) / mH ), top );
+
+      idx[k] = ( xk >= mLower and xk <= mUpper ) ? ik : outside;
+    }
+    return;
+  }
+
+  // logarithmic
+  CPPMAT_SIMD
+  for ( size_t k = 0 ; k < n ; ++k )
+  {
+    double xk = static_cast<double>(x[static_cast<ptrdiff_t>(k)*stride]);
+    double ik = ( xk >= mLower and xk <= mUpper ) ? std::min( std::floor( ( std::log(xk) - mOffset ) / mH ), top ) : outside;
+
+    idx[k] = std::max(ik, 0.0);
+  }
+}
+
+// =================================================================================================
+// histogram_nd : constructors
+// =================================================================================================
+
+inline
+histogram_nd::histogram_nd(const std::vector<histogram_axis> &axes) : mAxes(axes)
+{
+  if ( axes.size() == 0 or axes.size() > 6 )
+    throw std::invalid_argument("cppmat::histogram_nd: the number of axes must be between 1 and 6");
+
+  mSize = 1;
+
+  for ( auto &axis : axes ) {
+    mShape.push_back(axis.bins());
+    mSize *= axis.bins();
+  }
+
+  mCount.resize(mSize, 0);
+}
+
+// =================================================================================================
+// histogram_nd : add data
+// =================================================================================================
+
+inline
+void histogram_nd::weighted()
+{
+  if ( mWeighted ) return;
+
+  mWeighted = true;
+  mWeight   = std::vector<double>(mCount.begin(), mCount.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+inline
+void histogram_nd::add(
+  const std::vector<cppmat::view::strided<const X>> &data,
+  const cppmat::view::strided<const W> &weights)
+{
+  Assert( data.size() == mAxes.size() );
+
+  // number of entries
+  size_t n = data[0].size();
+
+  // pointers and strides of each axis
+  // (a view without a constant stride, e.g. a sub-block of a matrix, is first copied)
+  std::vector<const X*>        ptr   (data.size());
+  std::vector<ptrdiff_t>       stride(data.size());
+  std::vector<cppmat::array<X>> copy (data.size());
+
+  for ( size_t d = 0 ; d < data.size() ; ++d )
+  {
+    Assert( data[d].shape() == data[0].shape() );
+
+    ptr[d] = data[d].data();
+
+    if ( cppmat::Private::histogram_stride(data[d], stride[d]) ) continue;
+
+    copy  [d] = data[d].copy();
+    ptr   [d] = copy[d].data();
+    stride[d] = 1;
+  }
+
+  // weights
+  const W          *wptr    = nullptr;
+  ptrdiff_t         wstride = 1;
+  cppmat::array<W>  wcopy;
+
+  if ( weights.size() > 0 )
+  {
+    Assert( weights.shape() == data[0].shape() );
+
+    wptr = weights.data();
+
+    if ( not cppmat::Private::histogram_stride(weights, wstride) )
+    {
+      wcopy   = weights.copy();
+      wptr    = wcopy.data();
+      wstride = 1;
+    }
+  }
+
+  // counters: all bins (row-major), and one counter for the entries outside the bins
+  std::vector<size_t> count(mSize+1, 0);
+  std::vector<double> weight(mWeighted ? mSize+1 : 0, 0.0);
+
+  // flat bin-index of a batch of entries
+  auto index = [this, &ptr, &stride](size_t i, size_t m, double *idx)
+  {
+    double tmp[CPPMAT_BATCH];
+    double out[CPPMAT_BATCH];
+
+    const double outside = static_cast<double>(mSize);
+
+    for ( size_t k = 0 ; k < m ; ++k ) { idx[k] = 0.0; out[k] = 0.0; }
+
+    for ( size_t d = 0 ; d < mAxes.size() ; ++d )
+    {
+      const double bins = static_cast<double>(mShape[d]);
+
+      mAxes[d].index(ptr[d] + static_cast<ptrdiff_t>(i)*stride[d], stride[d], m, tmp);
+
+      CPPMAT_SIMD
+      for ( size_t k = 0 ; k < m ; ++k )
+      {
+        out[k] = ( tmp[k] >= bins ) ? 1.0 : out[k];
+        idx[k] = idx[k] * bins + std::min(tmp[k], bins - 1.);
+      }
+    }
+
+    CPPMAT_SIMD
+    for ( size_t k = 0 ; k < m ; ++k )
+      idx[k] = ( out[k] > 0.0 ) ? outside : idx[k];
+  };
+
+  // bin (in parallel)
+  cppmat::Private::histogram_fill(mSize+1, n, index, wptr, wstride, count.data(),
+    mWeighted ? weight.data() : nullptr);
+
+  // add
+  for ( size_t j = 0 ; j < mSize ; ++j ) mCount[j] += count[j];
+  // - add
+  if ( mWeighted ) for ( size_t j = 0 ; j < mSize ; ++j ) mWeight[j] += weight[j];
+  // - update sizes
+  mOutside += count[mSize];
+  mN       += n - count[mSize];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void histogram_nd::push(const std::vector<cppmat::view::strided<const X>> &data)
+{
+  add(data, cppmat::view::strided<const double>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+inline
+void histogram_nd::push(
+  const std::vector<cppmat::view::strided<const X>> &data,
+  const cppmat::view::strided<const W> &weights)
+{
+  weighted();
+
+  add(data, weights);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void histogram_nd::push(const cppmat::array<X> &data)
+{
+  Assert( data.rank() == 2 );
+  Assert( data.shape(1) == mAxes.size() );
+
+  // columns of the array
+  std::vector<cppmat::view::strided<const X>> columns;
+
+  for ( size_t d = 0 ; d < mAxes.size() ; ++d )
+    columns.push_back(data.strided().select(1, static_cast<int>(d)));
+
+  push(columns);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+inline
+void histogram_nd::push(const cppmat::array<X> &data, const cppmat::array<W> &weights)
+{
+  Assert( data.rank() == 2 );
+  Assert( data.shape(1) == mAxes.size() );
+  Assert( weights.size() == data.shape(0) );
+
+  // columns of the array
+  std::vector<cppmat::view::strided<const X>> columns;
+
+  for ( size_t d = 0 ; d < mAxes.size() ; ++d )
+    columns.push_back(data.strided().select(1, static_cast<int>(d)));
+
+  // weights as one column
+  cppmat::view::strided<const W> w(weights.data(), {data.shape(0)});
+
+  push(columns, w);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void histogram_nd::merge(const histogram_nd &other)
+{
+  Assert( mShape == other.mShape );
+
+  for ( size_t d = 0 ; d < mAxes.size() ; ++d ) {
+    Assert( mAxes[d].edges() == other.mAxes[d].edges() );
+  }
+
+  // store weights if the other histogram does
+  if ( other.mWeighted ) weighted();
+
+  // add
+  for ( size_t j = 0 ; j < mSize ; ++j ) mCount[j] += other.mCount[j];
+
+  // add
+  if ( mWeighted )
+  {
+    cppmat::array<double> weight = other.weight();
+
+    for ( size_t j = 0 ; j < mSize ; ++j ) mWeight[j] += weight[j];
+  }
+
+  // update sizes
+  mN       += other.mN;
+  mOutside += other.mOutside;
+}
+
+// =================================================================================================
+// histogram_nd : information
+// =================================================================================================
+
+inline
+size_t histogram_nd::rank() const
+{
+  return mAxes.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<size_t> histogram_nd::shape() const
+{
+  return mShape;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+const histogram_axis& histogram_nd::axis(size_t i) const
+{
+  Assert( i < mAxes.size() );
+
+  return mAxes[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t histogram_nd::size() const
+{
+  return mN;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+size_t histogram_nd::outside() const
+{
+  return mOutside;
+}
+
+// =================================================================================================
+// histogram_nd : histogram
+// =================================================================================================
+
+inline
+cppmat::array<size_t> histogram_nd::count() const
+{
+  return cppmat::array<size_t>::Copy(mShape, mCount.begin(), mCount.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+cppmat::array<double> histogram_nd::weight() const
+{
+  if ( mWeighted ) return cppmat::array<double>::Copy(mShape, mWeight.begin(), mWeight.end());
+
+  return cppmat::array<double>::Copy(mShape, mCount.begin(), mCount.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+cppmat::array<double> histogram_nd::density() const
+{
+  Assert( mN > 0 );
+
+  // sum of the weights (or the count)
+  cppmat::array<double> out = weight();
+
+  // total weight
+  double N = std::accumulate(out.begin(), out.end(), 0.0);
+
+  // width of the bins along each axis
+  std::vector<std::vector<double>> width;
+
+  for ( auto &axis : mAxes )
+    width.push_back(axis.width());
+
+  // divide by the volume of each bin (the flat index is unravelled in row-major order)
+  for ( size_t j = 0 ; j < mSize ; ++j )
+  {
+    double V = 1.0;
+    size_t r = j;
+
+    for ( size_t d = mAxes.size() ; d-- > 0 ; ) {
+      V *= width[d][r % mShape[d]];
+      r /= mShape[d];
+    }
+
+    out[j] /= ( V * N );
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<std::vector<double>> histogram_nd::edges() const
+{
+  std::vector<std::vector<double>> out;
+
+  for ( auto &axis : mAxes )
+    out.push_back(axis.edges());
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::vector<std::vector<double>> histogram_nd::mid() const
+{
+  std::vector<std::vector<double>> out;
+
+  for ( auto &axis : mAxes )
+    out.push_back(axis.mid());
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+std::tuple<cppmat::array<double>, std::vector<std::vector<double>>> histogram_nd::get(
+  bool density, bool return_edges) const
+{
+  if ( return_edges ) return std::make_tuple(density ? this->density() : weight(), edges());
+  else                return std::make_tuple(density ? this->density() : weight(), mid  ());
+}
+
+// =================================================================================================
+// multidimensional histogram
+// =================================================================================================
+
+template<typename X>
+inline
+std::tuple<cppmat::array<double>, std::vector<std::vector<double>>> histogramdd(
+  const std::vector<cppmat::view::strided<const X>> &data,
+  const std::vector<histogram_axis> &axes, bool density, bool return_edges)
+{
+  histogram_nd out(axes);
+
+  out.push(data);
+
+  return out.get(density, return_edges);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename W>
+inline
+std::tuple<cppmat::array<double>, std::vector<std::vector<double>>> histogramdd(
+  const std::vector<cppmat::view::strided<const X>> &data, const cppmat::view::strided<const W> &weights,
+  const std::vector<histogram_axis> &axes, bool density, bool return_edges)
+{
+  histogram_nd out(axes);
+
+  out.push(data, weights);
+
+  return out.get(density, return_edges);
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
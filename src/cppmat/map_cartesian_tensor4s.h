@@ -0,0 +1,52 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_CARTESIAN_TENSOR4S_H
+#define CPPMAT_MAP_CARTESIAN_TENSOR4S_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace view {
+namespace cartesian {
+
+// =================================================================================================
+// cppmat::view::cartesian::tensor4s (see "cppmat::cartesian::tensor4s")
+// =================================================================================================
+
+template<typename X, size_t ND>
+class tensor4s : public cppmat::view::symmetric::matrix<X,ND*(ND+1)/2,ND*(ND+1)/2>
+{
+  static_assert( ND > 0, "Number of dimensions must positive" );
+
+public:
+
+  // constructor: allocate, don't initialize
+  tensor4s();
+
+  // constructor: map external pointer
+  tensor4s(const X *A);
+
+  // named constructor: map external pointer
+  static tensor4s<X,ND> Map(const X *D);
+
+  // get dimensions
+  size_t ndim() const;
+
+};
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,73 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_CARTESIAN_TENSOR4S_HPP
+#define CPPMAT_MAP_CARTESIAN_TENSOR4S_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace view {
+namespace cartesian {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND>::tensor4s() : cppmat::view::symmetric::matrix<X,ND*(ND+1)/2,ND*(ND+1)/2>()
+{
+}
+
+// =================================================================================================
+// constructors: map external pointer
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND>::tensor4s(const X *A) : cppmat::view::symmetric::matrix<X,ND*(ND+1)/2,ND*(ND+1)/2>(A)
+{
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+tensor4s<X,ND> tensor4s<X,ND>::Map(const X *D)
+{
+  tensor4s<X,ND> out;
+
+  out.setMap(D);
+
+  return out;
+}
+
+// =================================================================================================
+// dimensions
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+size_t tensor4s<X,ND>::ndim() const
+{
+  return ND;
+}
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -33,6 +33,11 @@ protected:
   const X            *mData;              // data container
   bool                mPeriodic=false;    // if true: disable bounds-check where possible
 
+  // convert array-index along an axis to a positive index (in the range [0, n)):
+  // - a negative index counts down from the last index
+  // - the periodic wrap (integer division) is only applied if periodicity is enabled
+  size_t wrap(int a, int n) const;
+
 public:
 
   // return size without constructing
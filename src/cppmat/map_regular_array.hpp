@@ -104,6 +104,19 @@ void array<X,RANK,I,J,K,L,M,N>::setPeriodic(bool periodic)
   mPeriodic = periodic;
 }
 
+// =================================================================================================
+// index operators : positive (periodic) index
+// =================================================================================================
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N>
+inline
+size_t array<X,RANK,I,J,K,L,M,N>::wrap(int a, int n) const
+{
+  if ( mPeriodic ) return static_cast<size_t>( (n+(a%n)) % n );
+
+  return static_cast<size_t>( a < 0 ? a+n : a );
+}
+
 // =================================================================================================
 // get dimensions
 // =================================================================================================
@@ -286,7 +299,7 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return mData[\
     A * mStrides[0]];
@@ -304,8 +317,8 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return mData[\
     A * mStrides[0] +\
@@ -326,9 +339,9 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return mData[\
     A * mStrides[0] +\
@@ -352,10 +365,10 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return mData[\
     A * mStrides[0] +\
@@ -382,11 +395,11 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d, int e
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return mData[\
     A * mStrides[0] +\
@@ -416,12 +429,12 @@ const X& array<X,RANK,I,J,K,L,M,N>::operator()(int a, int b, int c, int d, int e
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return mData[\
     A * mStrides[0] +\
@@ -587,7 +600,7 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return A * mStrides[0];
 }
@@ -604,8 +617,8 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return A * mStrides[0] +\
          B * mStrides[1];
@@ -625,9 +638,9 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -650,10 +663,10 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -679,11 +692,11 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c, int d, int e) co
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -712,12 +725,12 @@ size_t array<X,RANK,I,J,K,L,M,N>::compress(int a, int b, int c, int d, int e, in
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -950,7 +963,7 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return begin() +
     A * mStrides[0];
@@ -968,8 +981,8 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return begin() +
     A * mStrides[0] +\
@@ -990,9 +1003,9 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return begin() +
     A * mStrides[0] +\
@@ -1016,10 +1029,10 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return begin() +
     A * mStrides[0] +\
@@ -1046,11 +1059,11 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d, int e) const
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return begin() +
     A * mStrides[0] +\
@@ -1080,12 +1093,12 @@ auto array<X,RANK,I,J,K,L,M,N>::item(int a, int b, int c, int d, int e, int f) c
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return begin() +
     A * mStrides[0] +\
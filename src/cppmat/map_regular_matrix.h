@@ -34,8 +34,22 @@ public:
   // named constructor: map external pointer
   static matrix<X,M,N> Map(const X *D);
 
+  // matrix products (see "cppmat::tiny::matrix"), the result is a copy
+  template<size_t K> cppmat::tiny::matrix<X,M,K> dot(const matrix<X,N,K> &B) const;
+  cppmat::tiny::vector<X,M>                      dot(const vector<X,N>   &b) const;
+
 };
 
+// =================================================================================================
+// matrix products: the same as "A.dot(B)" and "A.dot(b)"
+// =================================================================================================
+
+template<typename X, size_t M, size_t N, size_t K>
+cppmat::tiny::matrix<X,M,K> matmul(const matrix<X,M,N> &A, const matrix<X,N,K> &B);
+
+template<typename X, size_t M, size_t N>
+cppmat::tiny::vector<X,M> matvec(const matrix<X,M,N> &A, const vector<X,N> &b);
+
 // =================================================================================================
 
 }} // namespace ...
@@ -51,6 +51,53 @@ matrix<X,M,N> matrix<X,M,N>::Map(const X *D)
   return out;
 }
 
+// =================================================================================================
+// matrix products
+// =================================================================================================
+
+template<typename X, size_t M, size_t N>
+template<size_t K>
+inline
+cppmat::tiny::matrix<X,M,K> matrix<X,M,N>::dot(const matrix<X,N,K> &B) const
+{
+  cppmat::tiny::matrix<X,M,K> C;
+
+  cppmat::Private::gemm<X,M,K,N>(this->data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+cppmat::tiny::vector<X,M> matrix<X,M,N>::dot(const vector<X,N> &b) const
+{
+  cppmat::tiny::vector<X,M> c;
+
+  cppmat::Private::gemv<X,M,N>(this->data(), b.data(), c.data());
+
+  return c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N, size_t K>
+inline
+cppmat::tiny::matrix<X,M,K> matmul(const matrix<X,M,N> &A, const matrix<X,N,K> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+cppmat::tiny::vector<X,M> matvec(const matrix<X,M,N> &A, const vector<X,N> &b)
+{
+  return A.dot(b);
+}
+
 // =================================================================================================
 
 }} // namespace ...
@@ -0,0 +1,159 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_STRIDED_ARRAY_H
+#define CPPMAT_MAP_STRIDED_ARRAY_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace view {
+
+// =================================================================================================
+// cppmat::view::strided - non-owning view of dynamic rank, with arbitrary strides
+// N.B. use "cppmat::view::strided<const X>" for a read-only view
+// =================================================================================================
+
+template<typename X>
+class strided
+{
+public:
+
+  typedef typename std::remove_const<X>::type value_type;
+
+protected:
+
+  static const size_t MAX_DIM=6;        // maximum number of dimensions
+  size_t    mSize=0;                    // total size == prod(shape)
+  size_t    mRank=0;                    // rank (number of axes)
+  size_t    mShape  [MAX_DIM];          // number of entries along each axis
+  ptrdiff_t mStrides[MAX_DIM];          // stride length for each index (in number of entries)
+  X        *mData=nullptr;              // pointer to the first entry
+
+  // allow access to the data of a view of different constness
+  template<typename U> friend class strided;
+
+  // loop over all entries in row-major order, simultaneously for another view of the same shape
+  template<typename U, class F> void forEach(const strided<U> &B, F func) const;
+
+  // loop over all entries in row-major order
+  template<class F> void forEach(F func) const;
+
+public:
+
+  // constructor: empty view
+  strided();
+
+  // constructor: map external pointer, contiguous storage in row-major order
+  strided(X *D, const std::vector<size_t> &shape);
+
+  // constructor: map external pointer, arbitrary strides (in number of entries)
+  strided(X *D, const std::vector<size_t> &shape, const std::vector<ptrdiff_t> &strides);
+
+  // constructor: convert a writable view to a read-only view
+  template<typename U, typename=typename std::enable_if<std::is_same<const U,X>::value>::type>
+  strided(const strided<U> &A);
+
+  // named constructor: map external pointer
+  static strided<X> Map(X *D, const std::vector<size_t> &shape);
+  static strided<X> Map(X *D, const std::vector<size_t> &shape, const std::vector<ptrdiff_t> &strides);
+
+  // get dimensions
+  size_t size() const;
+  size_t rank() const;
+  size_t shape(int    i) const;
+  size_t shape(size_t i) const;
+  std::vector<size_t> shape() const;
+  std::vector<ptrdiff_t> strides() const;
+
+  // check if the entries are stored contiguously in row-major order
+  bool isContiguous() const;
+
+  // pointer to the first entry
+  X* data() const;
+
+  // index operators: access using array-indices (no periodicity)
+  X& operator()(size_t a) const;
+  X& operator()(size_t a, size_t b) const;
+  X& operator()(size_t a, size_t b, size_t c) const;
+  X& operator()(size_t a, size_t b, size_t c, size_t d) const;
+  X& operator()(size_t a, size_t b, size_t c, size_t d, size_t e) const;
+  X& operator()(size_t a, size_t b, size_t c, size_t d, size_t e, size_t f) const;
+
+  // index operators: access using iterator
+  // N.B. the iterator points to list of array-indices (a,b,c,...)
+  template<class Iterator> X& at(Iterator first, Iterator last) const;
+
+  // view of part of the data (no copy):
+  // - along one axis, selecting "start:stop:step" (negative "start" and "stop" count from the end)
+  strided<X> slice(size_t axis, int start, int stop, size_t step=1) const;
+  // - along each axis, using a list "{start, stop, step}", "{start, stop}", or "{start}"
+  //   (an empty list implies that all entries along that axis are selected)
+  //   N.B. contrary to "cppmat::array::slice", which selects a list of indices along each axis
+  strided<X> range(
+    const std::vector<int> &a=std::vector<int>(), const std::vector<int> &b=std::vector<int>(),
+    const std::vector<int> &c=std::vector<int>(), const std::vector<int> &d=std::vector<int>(),
+    const std::vector<int> &e=std::vector<int>(), const std::vector<int> &f=std::vector<int>()
+  ) const;
+
+  // view with a fixed index along one axis: the rank is reduced by one (no copy)
+  strided<X> select(size_t axis, int index) const;
+
+  // view with reversed/permuted axes (no copy)
+  strided<X> transpose() const;
+  strided<X> permute(const std::vector<size_t> &axes) const;
+  strided<X> swapaxes(size_t axis1, size_t axis2) const;
+
+  // copy to a new array
+  cppmat::array<value_type> copy() const;
+
+  // copy to target (in row-major order)
+  template<typename Iterator> void copyTo(Iterator first) const;
+  template<typename Iterator> void copyTo(Iterator first, Iterator last) const;
+
+  // initialization: modify the mapped data
+  void setConstant(value_type D) const;
+  void setZero() const;
+  void setOnes() const;
+  template<typename Iterator> void setCopy(Iterator first) const;
+  template<typename Iterator> void setCopy(Iterator first, Iterator last) const;
+  void setCopy(const cppmat::array<value_type> &A) const;
+  template<typename U> void setCopy(const strided<U> &A) const;
+
+  // arithmetic operators: modify the mapped data
+  const strided<X>& operator*= (const cppmat::array<value_type> &B) const;
+  const strided<X>& operator/= (const cppmat::array<value_type> &B) const;
+  const strided<X>& operator+= (const cppmat::array<value_type> &B) const;
+  const strided<X>& operator-= (const cppmat::array<value_type> &B) const;
+  template<typename U> const strided<X>& operator*= (const strided<U> &B) const;
+  template<typename U> const strided<X>& operator/= (const strided<U> &B) const;
+  template<typename U> const strided<X>& operator+= (const strided<U> &B) const;
+  template<typename U> const strided<X>& operator-= (const strided<U> &B) const;
+  const strided<X>& operator*= (value_type B) const;
+  const strided<X>& operator/= (value_type B) const;
+  const strided<X>& operator+= (value_type B) const;
+  const strided<X>& operator-= (value_type B) const;
+
+  // sum
+  value_type sum() const;
+
+};
+
+// print operator
+template<typename X> std::ostream& operator<<(std::ostream& out, const strided<X>& src);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,941 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_STRIDED_ARRAY_HPP
+#define CPPMAT_MAP_STRIDED_ARRAY_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace view {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X>
+inline
+strided<X>::strided()
+{
+  std::fill(std::begin(mShape  ), std::end(mShape  ), 1);
+  std::fill(std::begin(mStrides), std::end(mStrides), 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X>::strided(X *D, const std::vector<size_t> &shape) : mData(D)
+{
+  Assert( shape.size() <= MAX_DIM );
+
+  mRank = shape.size();
+  mSize = 1;
+
+  std::fill(std::begin(mShape  ), std::end(mShape  ), 1);
+  std::fill(std::begin(mStrides), std::end(mStrides), 0);
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+  {
+    mShape[i] = shape[i];
+    mSize    *= shape[i];
+  }
+
+  ptrdiff_t stride = 1;
+
+  for ( size_t i = mRank ; i-- > 0 ; )
+  {
+    mStrides[i] = stride;
+    stride     *= static_cast<ptrdiff_t>(mShape[i]);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X>::strided(X *D, const std::vector<size_t> &shape, const std::vector<ptrdiff_t> &strides) :
+  mData(D)
+{
+  Assert( shape.size() <= MAX_DIM );
+  Assert( shape.size() == strides.size() );
+
+  mRank = shape.size();
+  mSize = 1;
+
+  std::fill(std::begin(mShape  ), std::end(mShape  ), 1);
+  std::fill(std::begin(mStrides), std::end(mStrides), 0);
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+  {
+    mShape  [i] = shape  [i];
+    mStrides[i] = strides[i];
+    mSize      *= shape  [i];
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U, typename V>
+inline
+strided<X>::strided(const strided<U> &A) : mSize(A.mSize), mRank(A.mRank), mData(A.mData)
+{
+  std::copy(std::begin(A.mShape  ), std::end(A.mShape  ), std::begin(mShape  ));
+  std::copy(std::begin(A.mStrides), std::end(A.mStrides), std::begin(mStrides));
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<typename X>
+inline
+strided<X> strided<X>::Map(X *D, const std::vector<size_t> &shape)
+{
+  return strided<X>(D, shape);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X> strided<X>::Map(X *D, const std::vector<size_t> &shape,
+  const std::vector<ptrdiff_t> &strides)
+{
+  return strided<X>(D, shape, strides);
+}
+
+// =================================================================================================
+// loop over all entries
+// =================================================================================================
+
+template<typename X>
+template<class F>
+inline
+void strided<X>::forEach(F func) const
+{
+  if ( mSize == 0 ) return;
+
+  // shape and strides, the innermost loop running over the last axis
+  size_t    n[MAX_DIM];
+  ptrdiff_t s[MAX_DIM];
+
+  for ( size_t i = 0 ; i < MAX_DIM ; ++i ) { n[i] = 1; s[i] = 0; }
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+  {
+    n[MAX_DIM-mRank+i] = mShape  [i];
+    s[MAX_DIM-mRank+i] = mStrides[i];
+  }
+
+  for ( size_t a = 0 ; a < n[0] ; ++a ) {
+    X *pa = mData + static_cast<ptrdiff_t>(a) * s[0];
+    for ( size_t b = 0 ; b < n[1] ; ++b ) {
+      X *pb = pa + static_cast<ptrdiff_t>(b) * s[1];
+      for ( size_t c = 0 ; c < n[2] ; ++c ) {
+        X *pc = pb + static_cast<ptrdiff_t>(c) * s[2];
+        for ( size_t d = 0 ; d < n[3] ; ++d ) {
+          X *pd = pc + static_cast<ptrdiff_t>(d) * s[3];
+          for ( size_t e = 0 ; e < n[4] ; ++e ) {
+            X *pe = pd + static_cast<ptrdiff_t>(e) * s[4];
+            for ( size_t f = 0 ; f < n[5] ; ++f )
+              func(pe[static_cast<ptrdiff_t>(f) * s[5]]);
+          }
+        }
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U, class F>
+inline
+void strided<X>::forEach(const strided<U> &B, F func) const
+{
+  Assert( shape() == B.shape() );
+
+  if ( mSize == 0 ) return;
+
+  // shape and strides, the innermost loop running over the last axis
+  size_t    n[MAX_DIM];
+  ptrdiff_t s[MAX_DIM];
+  ptrdiff_t t[MAX_DIM];
+
+  for ( size_t i = 0 ; i < MAX_DIM ; ++i ) { n[i] = 1; s[i] = 0; t[i] = 0; }
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+  {
+    n[MAX_DIM-mRank+i] = mShape    [i];
+    s[MAX_DIM-mRank+i] = mStrides  [i];
+    t[MAX_DIM-mRank+i] = B.mStrides[i];
+  }
+
+  for ( size_t a = 0 ; a < n[0] ; ++a ) {
+    X *pa = mData   + static_cast<ptrdiff_t>(a) * s[0];
+    U *qa = B.mData + static_cast<ptrdiff_t>(a) * t[0];
+    for ( size_t b = 0 ; b < n[1] ; ++b ) {
+      X *pb = pa + static_cast<ptrdiff_t>(b) * s[1];
+      U *qb = qa + static_cast<ptrdiff_t>(b) * t[1];
+      for ( size_t c = 0 ; c < n[2] ; ++c ) {
+        X *pc = pb + static_cast<ptrdiff_t>(c) * s[2];
+        U *qc = qb + static_cast<ptrdiff_t>(c) * t[2];
+        for ( size_t d = 0 ; d < n[3] ; ++d ) {
+          X *pd = pc + static_cast<ptrdiff_t>(d) * s[3];
+          U *qd = qc + static_cast<ptrdiff_t>(d) * t[3];
+          for ( size_t e = 0 ; e < n[4] ; ++e ) {
+            X *pe = pd + static_cast<ptrdiff_t>(e) * s[4];
+            U *qe = qd + static_cast<ptrdiff_t>(e) * t[4];
+            for ( size_t f = 0 ; f < n[5] ; ++f )
+              func(pe[static_cast<ptrdiff_t>(f) * s[5]], qe[static_cast<ptrdiff_t>(f) * t[5]]);
+          }
+        }
+      }
+    }
+  }
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+template<typename X>
+inline
+size_t strided<X>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t strided<X>::rank() const
+{
+  return mRank;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t strided<X>::shape(int i) const
+{
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  Assert( i  <      static_cast<int>(mRank) );
+  Assert( i >= -1 * static_cast<int>(mRank) );
+
+  // get number of dimensions as integer
+  int n = static_cast<int>(mRank);
+
+  // correct periodic index
+  i = ( n + (i%n) ) % n;
+
+  // return shape
+  return mShape[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t strided<X>::shape(size_t i) const
+{
+  Assert( i < mRank );
+
+  return mShape[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+std::vector<size_t> strided<X>::shape() const
+{
+  std::vector<size_t> out(mRank);
+
+  std::copy(std::begin(mShape), std::begin(mShape)+mRank, out.begin());
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+std::vector<ptrdiff_t> strided<X>::strides() const
+{
+  std::vector<ptrdiff_t> out(mRank);
+
+  std::copy(std::begin(mStrides), std::begin(mStrides)+mRank, out.begin());
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool strided<X>::isContiguous() const
+{
+  ptrdiff_t stride = 1;
+
+  for ( size_t i = mRank ; i-- > 0 ; )
+  {
+    if ( mShape[i] != 1 and mStrides[i] != stride ) return false;
+
+    stride *= static_cast<ptrdiff_t>(mShape[i]);
+  }
+
+  return true;
+}
+
+// =================================================================================================
+// pointer to data
+// =================================================================================================
+
+template<typename X>
+inline
+X* strided<X>::data() const
+{
+  return mData;
+}
+
+// =================================================================================================
+// index operators
+// =================================================================================================
+
+template<typename X>
+inline
+X& strided<X>::operator()(size_t a) const
+{
+  Assert( mRank >= 1 );
+  Assert( a < mShape[0] );
+
+  return mData[static_cast<ptrdiff_t>(a)*mStrides[0]];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& strided<X>::operator()(size_t a, size_t b) const
+{
+  Assert( mRank >= 2 );
+  Assert( a < mShape[0] );
+  Assert( b < mShape[1] );
+
+  return mData[
+    static_cast<ptrdiff_t>(a)*mStrides[0] +
+    static_cast<ptrdiff_t>(b)*mStrides[1]
+  ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& strided<X>::operator()(size_t a, size_t b, size_t c) const
+{
+  Assert( mRank >= 3 );
+  Assert( a < mShape[0] );
+  Assert( b < mShape[1] );
+  Assert( c < mShape[2] );
+
+  return mData[
+    static_cast<ptrdiff_t>(a)*mStrides[0] +
+    static_cast<ptrdiff_t>(b)*mStrides[1] +
+    static_cast<ptrdiff_t>(c)*mStrides[2]
+  ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& strided<X>::operator()(size_t a, size_t b, size_t c, size_t d) const
+{
+  Assert( mRank >= 4 );
+  Assert( a < mShape[0] );
+  Assert( b < mShape[1] );
+  Assert( c < mShape[2] );
+  Assert( d < mShape[3] );
+
+  return mData[
+    static_cast<ptrdiff_t>(a)*mStrides[0] +
+    static_cast<ptrdiff_t>(b)*mStrides[1] +
+    static_cast<ptrdiff_t>(c)*mStrides[2] +
+    static_cast<ptrdiff_t>(d)*mStrides[3]
+  ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& strided<X>::operator()(size_t a, size_t b, size_t c, size_t d, size_t e) const
+{
+  Assert( mRank >= 5 );
+  Assert( a < mShape[0] );
+  Assert( b < mShape[1] );
+  Assert( c < mShape[2] );
+  Assert( d < mShape[3] );
+  Assert( e < mShape[4] );
+
+  return mData[
+    static_cast<ptrdiff_t>(a)*mStrides[0] +
+    static_cast<ptrdiff_t>(b)*mStrides[1] +
+    static_cast<ptrdiff_t>(c)*mStrides[2] +
+    static_cast<ptrdiff_t>(d)*mStrides[3] +
+    static_cast<ptrdiff_t>(e)*mStrides[4]
+  ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X& strided<X>::operator()(size_t a, size_t b, size_t c, size_t d, size_t e, size_t f) const
+{
+  Assert( mRank >= 6 );
+  Assert( a < mShape[0] );
+  Assert( b < mShape[1] );
+  Assert( c < mShape[2] );
+  Assert( d < mShape[3] );
+  Assert( e < mShape[4] );
+  Assert( f < mShape[5] );
+
+  return mData[
+    static_cast<ptrdiff_t>(a)*mStrides[0] +
+    static_cast<ptrdiff_t>(b)*mStrides[1] +
+    static_cast<ptrdiff_t>(c)*mStrides[2] +
+    static_cast<ptrdiff_t>(d)*mStrides[3] +
+    static_cast<ptrdiff_t>(e)*mStrides[4] +
+    static_cast<ptrdiff_t>(f)*mStrides[5]
+  ];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<class Iterator>
+inline
+X& strided<X>::at(Iterator first, Iterator last) const
+{
+  // check input
+  Assert( static_cast<size_t>(last-first)  > 0     );
+  Assert( static_cast<size_t>(last-first) <= mRank );
+
+  // index
+  ptrdiff_t idx = 0;
+
+  // convert array-index to plain storage
+  for ( auto it = first ; it != last ; ++it )
+  {
+    Assert( static_cast<size_t>(*it) < mShape[it-first] );
+
+    idx += static_cast<ptrdiff_t>(*it) * mStrides[it-first];
+  }
+
+  return mData[idx];
+}
+
+// =================================================================================================
+// views of part of the data
+// =================================================================================================
+
+template<typename X>
+inline
+strided<X> strided<X>::slice(size_t axis, int start, int stop, size_t step) const
+{
+  Assert( axis < mRank );
+  Assert( step > 0 );
+
+  // shape along the axis (as integer)
+  int n = static_cast<int>(mShape[axis]);
+
+  // negative index: count from the end
+  if ( start < 0 ) start += n;
+  if ( stop  < 0 ) stop  += n;
+
+  // check bounds
+  Assert( start >= 0 and start <= n );
+  Assert( stop  >= 0 and stop  <= n );
+
+  // number of selected entries
+  size_t m = 0;
+
+  if ( stop > start ) m = ( static_cast<size_t>(stop-start) + step - 1 ) / step;
+
+  // create view: start at the first selected entry, skip entries along the axis
+  strided<X> out(*this);
+
+  out.mData          += static_cast<ptrdiff_t>(start) * mStrides[axis];
+  out.mShape  [axis]  = m;
+  out.mStrides[axis] *= static_cast<ptrdiff_t>(step);
+  out.mSize           = 1;
+
+  for ( size_t i = 0 ; i < mRank ; ++i ) out.mSize *= out.mShape[i];
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X> strided<X>::range(
+  const std::vector<int> &a, const std::vector<int> &b, const std::vector<int> &c,
+  const std::vector<int> &d, const std::vector<int> &e, const std::vector<int> &f
+) const
+{
+  // collect input
+  std::vector<const std::vector<int>*> list = {&a, &b, &c, &d, &e, &f};
+
+  // create view
+  strided<X> out(*this);
+
+  // restrict the view along each axis
+  for ( size_t i = 0 ; i < MAX_DIM ; ++i )
+  {
+    const std::vector<int> &l = *list[i];
+
+    if ( l.size() == 0 ) continue;
+
+    Assert( i < mRank );
+    Assert( l.size() <= 3 );
+
+    int    start = l[0];
+    int    stop  = l.size() > 1 ? l[1] : static_cast<int>(mShape[i]);
+    size_t step  = l.size() > 2 ? static_cast<size_t>(l[2]) : 1;
+
+    out = out.slice(i, start, stop, step);
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X> strided<X>::select(size_t axis, int index) const
+{
+  Assert( axis < mRank );
+  Assert( mRank > 1 );
+
+  // shape along the axis (as integer)
+  int n = static_cast<int>(mShape[axis]);
+
+  // negative index: count from the end
+  if ( index < 0 ) index += n;
+
+  // check bounds
+  Assert( index >= 0 and index < n );
+
+  // create view: start at the selected entry, remove the axis
+  strided<X> out(*this);
+
+  out.mData += static_cast<ptrdiff_t>(index) * mStrides[axis];
+  out.mRank -= 1;
+  out.mSize /= mShape[axis];
+
+  for ( size_t i = axis ; i < MAX_DIM-1 ; ++i )
+  {
+    out.mShape  [i] = mShape  [i+1];
+    out.mStrides[i] = mStrides[i+1];
+  }
+
+  out.mShape  [MAX_DIM-1] = 1;
+  out.mStrides[MAX_DIM-1] = 0;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X> strided<X>::transpose() const
+{
+  strided<X> out(*this);
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+  {
+    out.mShape  [i] = mShape  [mRank-i-1];
+    out.mStrides[i] = mStrides[mRank-i-1];
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X> strided<X>::permute(const std::vector<size_t> &axes) const
+{
+  Assert( axes.size() == mRank );
+
+  #ifndef NDEBUG
+    std::vector<size_t> tmp = axes;
+    std::sort(tmp.begin(), tmp.end());
+    for ( size_t i = 0 ; i < mRank ; ++i ) Assert( tmp[i] == i );
+  #endif
+
+  strided<X> out(*this);
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+  {
+    out.mShape  [i] = mShape  [axes[i]];
+    out.mStrides[i] = mStrides[axes[i]];
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+strided<X> strided<X>::swapaxes(size_t axis1, size_t axis2) const
+{
+  Assert( axis1 < mRank );
+  Assert( axis2 < mRank );
+
+  strided<X> out(*this);
+
+  std::swap(out.mShape  [axis1], out.mShape  [axis2]);
+  std::swap(out.mStrides[axis1], out.mStrides[axis2]);
+
+  return out;
+}
+
+// =================================================================================================
+// copy
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::array<typename strided<X>::value_type> strided<X>::copy() const
+{
+  cppmat::array<value_type> out(shape());
+
+  copyTo(out.begin());
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<class Iterator>
+inline
+void strided<X>::copyTo(Iterator first) const
+{
+  forEach([&](const X &x) { *first = x; ++first; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<class Iterator>
+inline
+void strided<X>::copyTo(Iterator first, Iterator last) const
+{
+  Assert( mSize == static_cast<size_t>(last-first) );
+
+  UNUSED(last);
+
+  copyTo(first);
+}
+
+// =================================================================================================
+// initialization
+// =================================================================================================
+
+template<typename X>
+inline
+void strided<X>::setConstant(value_type D) const
+{
+  forEach([&](X &x) { x = D; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void strided<X>::setZero() const
+{
+  setConstant(static_cast<value_type>(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void strided<X>::setOnes() const
+{
+  setConstant(static_cast<value_type>(1));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<class Iterator>
+inline
+void strided<X>::setCopy(Iterator first) const
+{
+  forEach([&](X &x) { x = *first; ++first; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<class Iterator>
+inline
+void strided<X>::setCopy(Iterator first, Iterator last) const
+{
+  Assert( mSize == static_cast<size_t>(last-first) );
+
+  UNUSED(last);
+
+  setCopy(first);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void strided<X>::setCopy(const cppmat::array<value_type> &A) const
+{
+  forEach(strided<const value_type>(A.data(), A.shape()), [](X &x, const value_type &a) { x = a; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U>
+inline
+void strided<X>::setCopy(const strided<U> &A) const
+{
+  forEach(A, [](X &x, const U &a) { x = a; });
+}
+
+// =================================================================================================
+// arithmetic operators
+// =================================================================================================
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator*= (const cppmat::array<value_type> &B) const
+{
+  forEach(strided<const value_type>(B.data(), B.shape()), [](X &x, const value_type &b) { x *= b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator/= (const cppmat::array<value_type> &B) const
+{
+  forEach(strided<const value_type>(B.data(), B.shape()), [](X &x, const value_type &b) { x /= b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator+= (const cppmat::array<value_type> &B) const
+{
+  forEach(strided<const value_type>(B.data(), B.shape()), [](X &x, const value_type &b) { x += b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator-= (const cppmat::array<value_type> &B) const
+{
+  forEach(strided<const value_type>(B.data(), B.shape()), [](X &x, const value_type &b) { x -= b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U>
+inline
+const strided<X>& strided<X>::operator*= (const strided<U> &B) const
+{
+  forEach(B, [](X &x, const U &b) { x *= b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U>
+inline
+const strided<X>& strided<X>::operator/= (const strided<U> &B) const
+{
+  forEach(B, [](X &x, const U &b) { x /= b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U>
+inline
+const strided<X>& strided<X>::operator+= (const strided<U> &B) const
+{
+  forEach(B, [](X &x, const U &b) { x += b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<typename U>
+inline
+const strided<X>& strided<X>::operator-= (const strided<U> &B) const
+{
+  forEach(B, [](X &x, const U &b) { x -= b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator*= (value_type B) const
+{
+  forEach([&](X &x) { x *= B; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator/= (value_type B) const
+{
+  forEach([&](X &x) { x /= B; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator+= (value_type B) const
+{
+  forEach([&](X &x) { x += B; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+const strided<X>& strided<X>::operator-= (value_type B) const
+{
+  forEach([&](X &x) { x -= B; });
+
+  return *this;
+}
+
+// =================================================================================================
+// sum
+// =================================================================================================
+
+template<typename X>
+inline
+typename strided<X>::value_type strided<X>::sum() const
+{
+  value_type out = static_cast<value_type>(0);
+
+  forEach([&](const X &x) { out += x; });
+
+  return out;
+}
+
+// =================================================================================================
+// print operator
+// =================================================================================================
+
+template<typename X>
+inline
+std::ostream& operator<<(std::ostream& out, const strided<X>& src)
+{
+  if ( src.size() == 0 ) return out;
+
+  auto w = out.width();
+  auto p = out.precision();
+
+  if ( src.rank() == 1 )
+  {
+    for ( size_t j = 0 ; j < src.shape(0) ; ++j ) {
+      out << std::setw(w) << std::setprecision(p) << src(j);
+      if ( j != src.shape(0)-1 ) out << ", ";
+    }
+
+    return out;
+  }
+
+  if ( src.rank() == 2 )
+  {
+    for ( size_t i = 0 ; i < src.shape(0) ; ++i ) {
+      for ( size_t j = 0 ; j < src.shape(1) ; ++j ) {
+        out << std::setw(w) << std::setprecision(p) << src(i,j);
+        if      ( j != src.shape(1)-1 ) out << ", ";
+        else if ( i != src.shape(0)-1 ) out << ";" << std::endl;
+        else                            out << ";";
+      }
+    }
+
+    return out;
+  }
+
+  out << "cppmat::view::strided[";
+
+  for ( size_t i = 0 ; i < src.rank()-1 ; ++i )
+    out << src.shape(i) << ",";
+
+  out << src.shape(src.rank()-1) << "]";
+
+  return out;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -150,8 +150,28 @@ public:
   size_t              where(int    index) const;
   size_t              where(size_t index) const;
 
+  // products (see "cppmat::tiny::symmetric::matrix"), the result is a copy
+  template<size_t K> cppmat::tiny::matrix<X,M,K> dot(const cppmat::view::matrix<X,N,K> &B) const;
+  cppmat::tiny::vector<X,M>                      dot(const cppmat::view::vector<X,N>   &b) const;
+
+  // quadratic form: b_i * A_ij * b_j
+  X quadratic(const cppmat::view::vector<X,N> &b) const;
+
 };
 
+// =================================================================================================
+// products: the same as "A.dot(B)", "A.dot(b)", and "A.quadratic(b)"
+// =================================================================================================
+
+template<typename X, size_t M, size_t N, size_t K>
+cppmat::tiny::matrix<X,M,K> matmul(const matrix<X,M,N> &A, const cppmat::view::matrix<X,N,K> &B);
+
+template<typename X, size_t M, size_t N>
+cppmat::tiny::vector<X,M> matvec(const matrix<X,M,N> &A, const cppmat::view::vector<X,N> &b);
+
+template<typename X, size_t M, size_t N>
+X quadratic(const matrix<X,M,N> &A, const cppmat::view::vector<X,N> &b);
+
 // =================================================================================================
 // equality operators
 // =================================================================================================
@@ -721,6 +721,71 @@ size_t matrix<X,M,N>::where(int index) const
   throw std::runtime_error("Out-of-bounds");
 }
 
+// =================================================================================================
+// products
+// =================================================================================================
+
+template<typename X, size_t M, size_t N>
+template<size_t K>
+inline
+cppmat::tiny::matrix<X,M,K> matrix<X,M,N>::dot(const cppmat::view::matrix<X,N,K> &B) const
+{
+  cppmat::tiny::matrix<X,M,K> C;
+
+  cppmat::Private::spmm(N, K, mData, B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+cppmat::tiny::vector<X,M> matrix<X,M,N>::dot(const cppmat::view::vector<X,N> &b) const
+{
+  cppmat::tiny::vector<X,M> c;
+
+  cppmat::Private::spmv<X,N>(mData, b.data(), c.data());
+
+  return c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+X matrix<X,M,N>::quadratic(const cppmat::view::vector<X,N> &b) const
+{
+  return cppmat::Private::spquad<X,N>(mData, b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N, size_t K>
+inline
+cppmat::tiny::matrix<X,M,K> matmul(const matrix<X,M,N> &A, const cppmat::view::matrix<X,N,K> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+cppmat::tiny::vector<X,M> matvec(const matrix<X,M,N> &A, const cppmat::view::vector<X,N> &b)
+{
+  return A.dot(b);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+X quadratic(const matrix<X,M,N> &A, const cppmat::view::vector<X,N> &b)
+{
+  return A.quadratic(b);
+}
+
 // =================================================================================================
 // print operator
 // =================================================================================================
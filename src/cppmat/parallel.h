@@ -0,0 +1,64 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_PARALLEL_H
+#define CPPMAT_PARALLEL_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace parallel {
+
+// =================================================================================================
+// run-time settings (only effective if compiled with "-fopenmp -DCPPMAT_PARALLEL")
+// =================================================================================================
+
+// number of threads ("0": as many as OpenMP provides, i.e. "OMP_NUM_THREADS" or the number of cores)
+void   setNumThreads(size_t n=0);
+size_t numThreads();
+
+// minimal number of entries for which an operation is run in parallel
+void   setThreshold(size_t n=CPPMAT_PARALLEL_THRESHOLD);
+size_t threshold();
+
+// check if an operation on "n" entries runs in parallel
+bool   isParallel(size_t n);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// parallel kernels
+// =================================================================================================
+
+// call "func(begin, end)" for a number of contiguous ranges that together span "[0, n)"
+// - "work": number of entries that is processed, compared to the threshold (default: "n")
+template<class F> void parallel_for(size_t n, F func);
+template<class F> void parallel_for(size_t n, size_t work, F func);
+
+// reduce "[0, n)": "func(begin, end)" reduces one range, "op(a, b)" combines the results
+// N.B. the ranges are fixed blocks of "CPPMAT_PARALLEL_BLOCK" entries that are combined in order,
+//      whereby the result does not depend on the number of threads
+template<typename X, class F, class Op> X parallel_reduce(size_t n, X init, F func, Op op);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
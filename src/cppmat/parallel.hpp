@@ -0,0 +1,185 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_PARALLEL_HPP
+#define CPPMAT_PARALLEL_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "parallel.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// storage of the run-time settings (one instance for the entire program)
+// =================================================================================================
+
+inline size_t& parallel_num_threads()
+{
+  static size_t n = 0;
+
+  return n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline size_t& parallel_threshold()
+{
+  static size_t n = CPPMAT_PARALLEL_THRESHOLD;
+
+  return n;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace parallel {
+
+// =================================================================================================
+// run-time settings
+// =================================================================================================
+
+inline void setNumThreads(size_t n)
+{
+  cppmat::Private::parallel_num_threads() = n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline size_t numThreads()
+{
+#ifdef CPPMAT_PARALLEL
+  size_t n = cppmat::Private::parallel_num_threads();
+
+  if ( n > 0 ) return n;
+
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline void setThreshold(size_t n)
+{
+  cppmat::Private::parallel_threshold() = n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline size_t threshold()
+{
+  return cppmat::Private::parallel_threshold();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline bool isParallel(size_t n)
+{
+#ifdef CPPMAT_PARALLEL
+  // no nested parallelism: the calling thread is already part of a team
+  if ( omp_in_parallel() ) return false;
+
+  return n >= threshold() and numThreads() > 1;
+#else
+  UNUSED(n);
+
+  return false;
+#endif
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// parallel kernels
+// =================================================================================================
+
+template<class F>
+inline
+void parallel_for(size_t n, F func)
+{
+  parallel_for(n, n, func);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class F>
+inline
+void parallel_for(size_t n, size_t work, F func)
+{
+#ifdef CPPMAT_PARALLEL
+  if ( cppmat::parallel::isParallel(work) and n > 1 )
+  {
+    int nthreads = static_cast<int>(std::min(n, cppmat::parallel::numThreads()));
+
+    #pragma omp parallel num_threads(nthreads)
+    {
+      size_t nt = static_cast<size_t>(omp_get_num_threads());
+      size_t t  = static_cast<size_t>(omp_get_thread_num());
+
+      func((n*t)/nt, (n*(t+1))/nt);
+    }
+
+    return;
+  }
+#else
+  UNUSED(work);
+#endif
+
+  func(0, n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class F, class Op>
+inline
+X parallel_reduce(size_t n, X init, F func, Op op)
+{
+  size_t bs = CPPMAT_PARALLEL_BLOCK;
+  size_t nb = (n + bs - 1) / bs;
+
+  if ( nb <= 1 ) return op(std::move(init), func(0, n));
+
+  // reduce each block
+  std::unique_ptr<X[]> part(new X[nb]);
+
+  parallel_for(nb, n, [&](size_t begin, size_t end) {
+    for ( size_t b = begin ; b < end ; ++b )
+      part[b] = func(b*bs, std::min(n, (b+1)*bs));
+  });
+
+  // combine the blocks, always in the same order
+  X out = std::move(init);
+
+  for ( size_t b = 0 ; b < nb ; ++b )
+    out = op(std::move(out), std::move(part[b]));
+
+  return out;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -24,6 +24,148 @@ template<typename X> std::vector<X> sort_axes(const std::vector<X> &A, X n, bool
 
 bool equal(double a, double b);
 
+// -------------------------------------------------------------------------------------------------
+
+// element-wise kernels on plain storage of "n" entries, annotated for vectorization ("CPPMAT_SIMD")
+// - in-place: a[i] = op(a[i], b[i]), or a[i] = op(a[i], b)
+template<typename X, class Op> void inplace(X *a, const X *b, size_t n, Op op);
+template<typename X, class Op> void inplace(X *a,       X  b, size_t n, Op op);
+// - to output: out[i] = op(a[i]), or out[i] = op(a[i], b[i])
+template<typename X, typename Y, class Op>
+void transform(Y *out, const X *a, size_t n, Op op);
+
+template<typename X, typename Y, class Op>
+void transform(Y *out, const X *a, const X *b, size_t n, Op op);
+
+// reductions of plain storage of "n" entries (in parallel for large "n", with a deterministic result)
+template<typename X> X sum (const X *a, size_t n);
+template<typename X> X norm(const X *a, size_t n);
+template<typename X> X min (const X *a, size_t n);
+template<typename X> X max (const X *a, size_t n);
+
+// check that all entries of plain storage of "n" entries are equal: "a[i] == b[i]"
+template<typename X> bool all_equal(const X *a, const X *b, size_t n);
+
+// indices of the non-zero entries of plain storage of "n" entries
+template<typename X> std::vector<size_t> where(const X *a, size_t n);
+
+// products of matrices in plain (row-major) storage, cache-blocked with a vectorized innermost loop
+// (the matrix-matrix product uses a register-blocked kernel on packed blocks of the operands); the
+// overloads with the sizes as template parameters unroll small products at compile time
+// - C (m x n) = A (m x k) * B (k x n)
+template<typename X> void gemm(size_t m, size_t n, size_t k, const X *A, const X *B, X *C);
+template<typename X, size_t M, size_t N, size_t K> void gemm(const X *A, const X *B, X *C);
+// - c (m) = A (m x n) * b (n)
+template<typename X> void gemv(size_t m, size_t n, const X *A, const X *b, X *c);
+template<typename X, size_t M, size_t N> void gemv(const X *A, const X *b, X *c);
+// - c (n) = a (m) * B (m x n)
+template<typename X> void gevm(size_t m, size_t n, const X *a, const X *B, X *c);
+// - C (m x n) = a (m) * b (n)
+template<typename X> void outer(size_t m, size_t n, const X *a, const X *b, X *C);
+
+// products with a symmetric matrix "A" (n x n) of which the upper triangle is stored row-by-row
+// ("packed", see "cppmat::symmetric::matrix"), without unpacking it to a dense matrix
+// - c (n) = A * b
+template<typename X> void spmv(size_t n, const X *A, const X *b, X *c);
+template<typename X, size_t N> void spmv(const X *A, const X *b, X *c);
+// - C (n x k) = A * B (n x k)
+template<typename X> void spmm(size_t n, size_t k, const X *A, const X *B, X *C);
+// - b^T * A * b
+template<typename X> X spquad(size_t n, const X *A, const X *b);
+template<typename X, size_t N> X spquad(const X *A, const X *b);
+// - A += alpha * b * b^T
+template<typename X> void spr(size_t n, X alpha, const X *b, X *A);
+// - A = alpha * B * B^T + beta * A, with B (n x k) ("A" is not read if "beta == 0")
+template<typename X> void sprk(size_t n, size_t k, X alpha, const X *B, X beta, X *A);
+// - A = alpha * ( B * C^T + C * B^T ) + beta * A, with B and C (n x k)
+template<typename X> void spr2k(size_t n, size_t k, X alpha, const X *B, const X *C, X beta, X *A);
+
+// factorizations of a symmetric matrix "A" (n x n) in packed storage, in place (returns "false" if
+// the factorization does not exist), blocked such that most operations are a rank-k update
+// - Cholesky: A = U^T * U, with "U" upper triangular
+template<typename X> bool cholesky(size_t n, X *A);
+template<typename X, size_t N> bool cholesky(X *A);
+// - LDLT (without pivoting): A = U^T * D * U, with "U" unit upper triangular, "D" on the diagonal
+template<typename X> bool ldlt(size_t n, X *A);
+template<typename X, size_t N> bool ldlt(X *A);
+
+// solve A * X = B, in place of "B" (n x k), using a factorization (see above)
+template<typename X> void cholesky_solve(size_t n, size_t k, const X *U, X *B);
+template<typename X, size_t N> void cholesky_solve(const X *U, X *b);
+template<typename X> void ldlt_solve(size_t n, size_t k, const X *U, X *B);
+template<typename X, size_t N> void ldlt_solve(const X *U, X *b);
+
+// determinant and inverse of a general matrix "A" (n x n, row-major), by Gauss-Jordan elimination
+// with partial pivoting; "A" is overwritten (a singular matrix gives a zero determinant, and an
+// inverse that is not finite)
+template<typename X> X    gauss_det(size_t n, X *A);
+template<typename X> void gauss_inv(size_t n, X *A, X *C);
+
+// eigen-decomposition of a symmetric matrix "A" (n x n) in packed storage: "A = V * diag(val) * V^T",
+// with the eigenvalues "val" in ascending order, and the (orthonormal) eigenvectors the columns of "V"
+// ("n x n", row-major); the eigenvectors are not computed if "vec == nullptr"
+// - n == 2: closed-form (a single Jacobi rotation)
+// - n == 3: closed-form eigenvalues, the eigenvector of the most separated eigenvalue from a cross
+//           product, the other two from a Jacobi rotation in the plane normal to it
+// - n >  3: cyclic Jacobi method
+template<typename X> void eig_sym(size_t n, const X *A, X *val, X *vec);
+
+// isotropic function of a symmetric matrix "A" (n x n) in packed storage:
+// "F = V * diag(f(val)) * V^T" (in packed storage), and, if "dFdA != nullptr", its derivative
+// (n x n x n x n, row-major):
+//   dF_ij / dA_kl = sum_ab theta_ab * V_ia * V_jb * ( V_ka * V_lb + V_kb * V_la ) / 2
+// with "theta_aa = f'(val_a)", and "theta_ab = ( f(val_a) - f(val_b) ) / ( val_a - val_b )"
+// returns "false" (without output) if an eigenvalue is outside the domain of "func"
+template<typename X, class F> bool isotropic(size_t n, const X *A, X *out, X *dFdA, const F &func);
+
+// functions for "isotropic": the domain "valid", value "f", derivative "df", and the divided
+// difference "dd" (with "fa = f(a)", "fb = f(b)", also for "a == b")
+template<typename X>
+struct isotropic_log
+{
+  bool valid(X x) const;
+  X    f    (X x) const;
+  X    df   (X x) const;
+  X    dd   (X a, X b, X fa, X fb) const;
+};
+
+template<typename X>
+struct isotropic_exp
+{
+  bool valid(X x) const;
+  X    f    (X x) const;
+  X    df   (X x) const;
+  X    dd   (X a, X b, X fa, X fb) const;
+};
+
+template<typename X>
+struct isotropic_sqrt
+{
+  bool valid(X x) const;
+  X    f    (X x) const;
+  X    df   (X x) const;
+  X    dd   (X a, X b, X fa, X fb) const;
+};
+
+// "f(x) = x^p"
+template<typename X>
+struct isotropic_pow
+{
+  X p;
+
+  bool valid(X x) const;
+  X    f    (X x) const;
+  X    df   (X x) const;
+  X    dd   (X a, X b, X fa, X fb) const;
+};
+
+// "isotropic" for "m" tensors (in parallel), stored as "array of structures" ("soa == false") or as
+// "structure of arrays" ("soa == true"), see "cppmat::cartesian::field"; "A" and "out" have
+// "ND*(ND+1)/2" components per tensor, "dFdA" (skipped if "nullptr") "ND^4"
+// returns "false" if an eigenvalue of any of the tensors is outside the domain of "func"
+template<typename X, size_t ND, class F>
+bool isotropic_field(size_t m, bool soa, const X *A, X *out, X *dFdA, const F &func);
+
 // =================================================================================================
 
 }} // namespace ...
@@ -44,6 +44,1867 @@ inline bool equal(double a, double b)
   return std::fabs(a - b) <= std::numeric_limits<double>::epsilon();
 }
 
+// =================================================================================================
+// element-wise kernels (in parallel for large "n", see "parallel.h")
+// =================================================================================================
+
+template<typename X, class Op>
+inline
+void inplace(X *a, const X *b, size_t n, Op op)
+{
+  parallel_for(n, [=](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      a[i] = op(a[i], b[i]);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class Op>
+inline
+void inplace(X *a, X b, size_t n, Op op)
+{
+  parallel_for(n, [=](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      a[i] = op(a[i], b);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename Y, class Op>
+inline
+void transform(Y *out, const X *a, size_t n, Op op)
+{
+  parallel_for(n, [=](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      out[i] = op(a[i]);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, typename Y, class Op>
+inline
+void transform(Y *out, const X *a, const X *b, size_t n, Op op)
+{
+  parallel_for(n, [=](size_t begin, size_t end) {
+    CPPMAT_SIMD
+    for ( size_t i = begin ; i < end ; ++i )
+      out[i] = op(a[i], b[i]);
+  });
+}
+
+// =================================================================================================
+// reductions
+// =================================================================================================
+
+template<typename X>
+inline
+X sum(const X *a, size_t n)
+{
+  return parallel_reduce(n, static_cast<X>(0),
+    [a](size_t begin, size_t end) {
+      X out = static_cast<X>(0);
+      for ( size_t i = begin ; i < end ; ++i )
+        out += a[i];
+      return out;
+    },
+    [](X x, X y) { return x + y; }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X norm(const X *a, size_t n)
+{
+  return parallel_reduce(n, static_cast<X>(0),
+    [a](size_t begin, size_t end) {
+      X out = static_cast<X>(0);
+      for ( size_t i = begin ; i < end ; ++i )
+        out += std::abs(a[i]);
+      return out;
+    },
+    [](X x, X y) { return x + y; }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X min(const X *a, size_t n)
+{
+  Assert( n > 0 );
+
+  return parallel_reduce(n, a[0],
+    [a](size_t begin, size_t end) { return *std::min_element(a+begin, a+end); },
+    [](X x, X y) { return std::min(x, y); }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X max(const X *a, size_t n)
+{
+  Assert( n > 0 );
+
+  return parallel_reduce(n, a[0],
+    [a](size_t begin, size_t end) { return *std::max_element(a+begin, a+end); },
+    [](X x, X y) { return std::max(x, y); }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool all_equal(const X *a, const X *b, size_t n)
+{
+  return parallel_reduce(n, true,
+    [a,b](size_t begin, size_t end) { return std::equal(a+begin, a+end, b+begin); },
+    [](bool x, bool y) { return x and y; }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+std::vector<size_t> where(const X *a, size_t n)
+{
+  return parallel_reduce(n, std::vector<size_t>(),
+    [a](size_t begin, size_t end) {
+      std::vector<size_t> out;
+      for ( size_t i = begin ; i < end ; ++i )
+        if ( a[i] )
+          out.push_back(i);
+      return out;
+    },
+    [](std::vector<size_t> x, std::vector<size_t> y) {
+      x.insert(x.end(), y.begin(), y.end());
+      return x;
+    }
+  );
+}
+
+// =================================================================================================
+// matrix products (in parallel over the rows of the result for large products)
+// =================================================================================================
+
+// kernel: C (R x W, with row-stride "ldc") += A * B, with "A" (R x k) stored column-by-column and
+// "B" (k x W) stored row-by-row (i.e. both are read contiguously); the "R x W" entries of the result
+// are accumulated in registers
+// - plain loops (any type, any compiler)
+template<typename X, size_t R, size_t W>
+inline
+void gemm_kernel(size_t k, const X *A, const X *B, X *C, size_t ldc, std::false_type)
+{
+  X c[R*W] = {};
+
+  for ( size_t p = 0 ; p < k ; ++p ) {
+    const X *a = A + p*R;
+    const X *b = B + p*W;
+    for ( size_t q = 0 ; q < R ; ++q ) {
+      const X f = a[q];
+      CPPMAT_SIMD
+      for ( size_t t = 0 ; t < W ; ++t )
+        c[q*W+t] += f * b[t];
+    }
+  }
+
+  for ( size_t q = 0 ; q < R ; ++q )
+    for ( size_t t = 0 ; t < W ; ++t )
+      C[q*ldc+t] += c[q*W+t];
+}
+
+// - vector extension of GCC/Clang ("float" and "double"): the accumulators are SIMD registers,
+//   each row of the result is "W / L" registers of "L" entries
+#if defined(__GNUC__)
+template<typename X, size_t R, size_t W>
+inline
+void gemm_kernel(size_t k, const X *A, const X *B, X *C, size_t ldc, std::true_type)
+{
+  typedef X V __attribute__((vector_size(CPPMAT_SIMD_BYTES)));
+
+  const size_t L = CPPMAT_SIMD_BYTES / sizeof(X);
+  const size_t U = W / L;
+
+  static_assert( U * L == W, "Kernel width must be a multiple of the SIMD width" );
+
+  V c[R][U];
+
+  for ( size_t q = 0 ; q < R ; ++q )
+    for ( size_t u = 0 ; u < U ; ++u )
+      c[q][u] = V{};
+
+  for ( size_t p = 0 ; p < k ; ++p ) {
+    const X *a = A + p*R;
+    V b[U];
+    for ( size_t u = 0 ; u < U ; ++u )
+      std::memcpy(&b[u], B + p*W + u*L, sizeof(V));
+    for ( size_t q = 0 ; q < R ; ++q ) {
+      const X f = a[q];
+      for ( size_t u = 0 ; u < U ; ++u )
+        c[q][u] += f * b[u];
+    }
+  }
+
+  for ( size_t q = 0 ; q < R ; ++q ) {
+    for ( size_t u = 0 ; u < U ; ++u ) {
+      V t;
+      std::memcpy(&t, C + q*ldc + u*L, sizeof(V));
+      t += c[q][u];
+      std::memcpy(C + q*ldc + u*L, &t, sizeof(V));
+    }
+  }
+}
+#endif
+
+// - selection of the kernel
+template<typename X>
+struct gemm_simd : std::integral_constant<bool,
+#if defined(__GNUC__)
+  std::is_same<X,float>::value || std::is_same<X,double>::value
+#else
+  false
+#endif
+> {};
+
+// -------------------------------------------------------------------------------------------------
+
+// - "a(i,p)" returns the entry "A_ip", whereby "A" need not be stored as a dense matrix, and "ldb" is
+//   the row-stride of "B" (e.g. to use a block of columns of a larger matrix)
+template<typename X, class F>
+inline
+void gemm_blocked(size_t m, size_t n, size_t k, F a, const X *B, size_t ldb, X *C)
+{
+  // size of the kernel: rows x columns of "C" (two SIMD registers per row)
+  const size_t R = 6;
+  const size_t W = std::max(size_t(1), 2 * CPPMAT_SIMD_BYTES / sizeof(X));
+
+  // blocks of "B" that are packed at once: (bk x bn) entries, that remain in the L2 cache, while the
+  // packed rows of "A" (R x bk) remain in the L1 cache
+  const size_t bk = 256;
+  const size_t bn = 512;
+
+  std::fill(C, C+m*n, static_cast<X>(0));
+
+  // small: row-by-row, packing does not pay off
+  if ( m * n * k <= 32768 ) {
+    for ( size_t i = 0 ; i < m ; ++i ) {
+      X *c = C + i*n;
+      for ( size_t p = 0 ; p < k ; ++p ) {
+        const X *b = B + p*ldb;
+        const X  f = a(i,p);
+        CPPMAT_SIMD
+        for ( size_t j = 0 ; j < n ; ++j )
+          c[j] += f * b[j];
+      }
+    }
+    return;
+  }
+
+  // packed block of "B" (only the panels of "W" columns, i.e. empty for narrow products)
+  std::vector<X> Bp(std::min(k, bk) * ( std::min(n, bn) / W * W ));
+
+  for ( size_t jj = 0 ; jj < n ; jj += bn ) {
+
+    size_t nn = std::min(n, jj+bn) - jj;
+    size_t nw = nn / W;
+
+    for ( size_t kk = 0 ; kk < k ; kk += bk ) {
+
+      size_t nk = std::min(k, kk+bk) - kk;
+
+      // pack "B": panels of "W" columns, each stored row-by-row
+      for ( size_t jw = 0 ; jw < nw ; ++jw )
+        for ( size_t p = 0 ; p < nk ; ++p )
+          std::copy(B+(kk+p)*ldb+jj+jw*W, B+(kk+p)*ldb+jj+(jw+1)*W, Bp.begin()+(jw*nk+p)*W);
+
+      const X *bp = Bp.data();
+
+      parallel_for(m, m*nn*nk, [=](size_t begin, size_t end) {
+
+        X ap[R*bk];
+
+        size_t nr = ( end - begin ) / R;
+
+        for ( size_t ir = 0 ; ir < nr ; ++ir ) {
+
+          size_t i = begin + ir * R;
+
+          // pack "A": "R" rows, stored column-by-column
+          for ( size_t p = 0 ; p < nk ; ++p )
+            for ( size_t q = 0 ; q < R ; ++q )
+              ap[p*R+q] = a(i+q,kk+p);
+
+          for ( size_t jw = 0 ; jw < nw ; ++jw )
+            gemm_kernel<X,R,W>(nk, ap, bp+jw*nk*W, C+i*n+jj+jw*W, n, gemm_simd<X>());
+
+          // remaining columns
+          for ( size_t q = 0 ; q < R ; ++q ) {
+            for ( size_t p = 0 ; p < nk ; ++p ) {
+              const X  f = ap[p*R+q];
+              const X *b = B + (kk+p)*ldb;
+              for ( size_t j = jj+nw*W ; j < jj+nn ; ++j )
+                C[(i+q)*n+j] += f * b[j];
+            }
+          }
+        }
+
+        // remaining rows
+        for ( size_t i = begin + nr * R ; i < end ; ++i ) {
+          X *c = C + i*n;
+          for ( size_t p = kk ; p < kk+nk ; ++p ) {
+            const X *b = B + p*ldb;
+            const X  f = a(i,p);
+            CPPMAT_SIMD
+            for ( size_t j = jj ; j < jj+nn ; ++j )
+              c[j] += f * b[j];
+          }
+        }
+      });
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void gemm(size_t m, size_t n, size_t k, const X *A, const X *B, X *C)
+{
+  gemm_blocked(m, n, k, [A,k](size_t i, size_t p) { return A[i*k+p]; }, B, n, C);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N, size_t K>
+inline
+void gemm(const X *A, const X *B, X *C)
+{
+  // large: cache-blocked product
+  if ( M * N * K > 32768 ) return gemm(M, N, K, A, B, C);
+
+  // small: fixed loops, that the compiler unrolls
+  for ( size_t i = 0 ; i < M ; ++i ) {
+    X c[N] = {};
+    for ( size_t p = 0 ; p < K ; ++p ) {
+      const X  f = A[i*K+p];
+      const X *b = B + p*N;
+      CPPMAT_SIMD
+      for ( size_t j = 0 ; j < N ; ++j )
+        c[j] += f * b[j];
+    }
+    std::copy(c, c+N, C+i*N);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void gemv(size_t m, size_t n, const X *A, const X *b, X *c)
+{
+  // number of rows that share the loads of "b", and number of partial sums per row (the partial
+  // sums make the inner loop vectorizable, the order of summation is fixed)
+  const size_t R = 4;
+  const size_t L = std::max(size_t(1), 2 * CPPMAT_SIMD_BYTES / sizeof(X));
+
+  parallel_for(m, m*n, [=](size_t begin, size_t end) {
+
+    size_t nl = n / L * L;
+    size_t i  = begin;
+
+    for ( ; i + R <= end ; i += R ) {
+      X s[R][L] = {};
+      for ( size_t j = 0 ; j < nl ; j += L ) {
+        for ( size_t q = 0 ; q < R ; ++q ) {
+          const X *a = A + (i+q)*n + j;
+          CPPMAT_SIMD
+          for ( size_t t = 0 ; t < L ; ++t )
+            s[q][t] += a[t] * b[j+t];
+        }
+      }
+      for ( size_t q = 0 ; q < R ; ++q ) {
+        const X *a   = A + (i+q)*n;
+        X        out = static_cast<X>(0);
+        for ( size_t t = 0 ; t < L ; ++t )
+          out += s[q][t];
+        for ( size_t j = nl ; j < n ; ++j )
+          out += a[j] * b[j];
+        c[i+q] = out;
+      }
+    }
+
+    for ( ; i < end ; ++i ) {
+      const X *a   = A + i*n;
+      X        out = static_cast<X>(0);
+      for ( size_t j = 0 ; j < n ; ++j )
+        out += a[j] * b[j];
+      c[i] = out;
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t M, size_t N>
+inline
+void gemv(const X *A, const X *b, X *c)
+{
+  // large: see above
+  if ( M * N > 4096 ) return gemv(M, N, A, b, c);
+
+  // small: fixed loops, that the compiler unrolls
+  for ( size_t i = 0 ; i < M ; ++i ) {
+    X out = static_cast<X>(0);
+    for ( size_t j = 0 ; j < N ; ++j )
+      out += A[i*N+j] * b[j];
+    c[i] = out;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void gevm(size_t m, size_t n, const X *a, const X *B, X *c)
+{
+  parallel_for(n, m*n, [=](size_t begin, size_t end) {
+    std::fill(c+begin, c+end, static_cast<X>(0));
+    for ( size_t i = 0 ; i < m ; ++i ) {
+      const X *b = B + i*n;
+      const X  f = a[i];
+      CPPMAT_SIMD
+      for ( size_t j = begin ; j < end ; ++j )
+        c[j] += f * b[j];
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void outer(size_t m, size_t n, const X *a, const X *b, X *C)
+{
+  parallel_for(m, m*n, [=](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i ) {
+      X       *c = C + i*n;
+      const X  f = a[i];
+      CPPMAT_SIMD
+      for ( size_t j = 0 ; j < n ; ++j )
+        c[j] = f * b[j];
+    }
+  });
+}
+
+// =================================================================================================
+// products with a symmetric matrix in packed storage
+// =================================================================================================
+
+// index of "A_ab" (a <= b) in the packed storage (see "cppmat::symmetric::matrix::compress")
+inline size_t packed(size_t n, size_t a, size_t b)
+{
+  return a*n - (a-1)*a/2 + b - a;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// inner product of "n" entries, with "L" partial sums (vectorizable, the order of summation is fixed)
+template<typename X>
+inline
+X dot(const X *a, const X *b, size_t n)
+{
+  const size_t L = std::max(size_t(1), 2 * CPPMAT_SIMD_BYTES / sizeof(X));
+
+  size_t nl = n / L * L;
+  X      s[L] = {};
+
+  for ( size_t j = 0 ; j < nl ; j += L ) {
+    CPPMAT_SIMD
+    for ( size_t t = 0 ; t < L ; ++t )
+      s[t] += a[j+t] * b[j+t];
+  }
+
+  X out = static_cast<X>(0);
+
+  for ( size_t t = 0 ; t < L ; ++t )
+    out += s[t];
+
+  for ( size_t j = nl ; j < n ; ++j )
+    out += a[j] * b[j];
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void spmv(size_t n, const X *A, const X *b, X *c)
+{
+  // parallel: two passes over "A", without conflicting writes
+  // - by rows   : c_a  = A_ab * b_b, for b >= a
+  // - by columns: c_b += A_ab * b_a, for a <  b
+  if ( cppmat::parallel::isParallel(n*(n+1)/2) )
+  {
+    parallel_for(n, [=](size_t begin, size_t end) {
+      for ( size_t a = begin ; a < end ; ++a )
+        c[a] = dot(A+packed(n,a,a), b+a, n-a);
+    });
+
+    parallel_for(n, [=](size_t begin, size_t end) {
+      for ( size_t a = 0 ; a < end ; ++a ) {
+        const X *r = A + packed(n,a,0);
+        const X  f = b[a];
+        CPPMAT_SIMD
+        for ( size_t j = std::max(a+1, begin) ; j < end ; ++j )
+          c[j] += r[j] * f;
+      }
+    });
+
+    return;
+  }
+
+  // serial: one pass, each entry of the strictly upper triangle is used for both "c_a" and "c_b"
+  const size_t L = std::max(size_t(1), CPPMAT_SIMD_BYTES / sizeof(X));
+
+  std::fill(c, c+n, static_cast<X>(0));
+
+  for ( size_t a = 0 ; a < n ; ++a ) {
+
+    // strictly upper part of row "a", and the corresponding entries of "b" and "c"
+    const X *r  = A + packed(n,a,a) + 1;
+    const X *bu = b + a + 1;
+    X       *cu = c + a + 1;
+    const X  f  = b[a];
+    size_t   m  = n - a - 1;
+    size_t   ml = m / L * L;
+    X        s[L] = {};
+
+    for ( size_t j = 0 ; j < ml ; j += L ) {
+      CPPMAT_SIMD
+      for ( size_t t = 0 ; t < L ; ++t ) {
+        s [t]   += r[j+t] * bu[j+t];
+        cu[j+t] += r[j+t] * f;
+      }
+    }
+
+    X out = r[-1] * f;
+
+    for ( size_t t = 0 ; t < L ; ++t )
+      out += s[t];
+
+    for ( size_t j = ml ; j < m ; ++j ) {
+      out   += r[j] * bu[j];
+      cu[j] += r[j] * f;
+    }
+
+    c[a] += out;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+void spmv(const X *A, const X *b, X *c)
+{
+  // large: see above
+  if ( N * N > 4096 ) return spmv(N, A, b, c);
+
+  // small: fixed loops, that the compiler unrolls
+  std::fill(c, c+N, static_cast<X>(0));
+
+  for ( size_t a = 0, i = 0 ; a < N ; ++a ) {
+    c[a] += A[i++] * b[a];
+    for ( size_t j = a+1 ; j < N ; ++j, ++i ) {
+      c[a] += A[i] * b[j];
+      c[j] += A[i] * b[a];
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void spmm(size_t n, size_t k, const X *A, const X *B, X *C)
+{
+  // the blocks of "A" are unpacked while they are packed for the register-blocked kernel
+  gemm_blocked(n, k, n, [A,n](size_t i, size_t p) {
+    return i <= p ? A[packed(n,i,p)] : A[packed(n,p,i)];
+  }, B, k, C);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X spquad(size_t n, const X *A, const X *b)
+{
+  return parallel_reduce(n, static_cast<X>(0),
+    [=](size_t begin, size_t end) {
+      X out = static_cast<X>(0);
+      for ( size_t a = begin ; a < end ; ++a ) {
+        const X *r = A + packed(n,a,a);
+        out += b[a] * ( r[0] * b[a] + static_cast<X>(2) * dot(r+1, b+a+1, n-a-1) );
+      }
+      return out;
+    },
+    [](X x, X y) { return x + y; }
+  );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+X spquad(const X *A, const X *b)
+{
+  // large: see above
+  if ( N * N > 4096 ) return spquad(N, A, b);
+
+  // small: fixed loops, that the compiler unrolls
+  X out = static_cast<X>(0);
+
+  for ( size_t a = 0, i = 0 ; a < N ; ++a ) {
+    X s = A[i++] * b[a];
+    for ( size_t j = a+1 ; j < N ; ++j, ++i )
+      s += static_cast<X>(2) * A[i] * b[j];
+    out += b[a] * s;
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void spr(size_t n, X alpha, const X *b, X *A)
+{
+  parallel_for(n, n*(n+1)/2, [=](size_t begin, size_t end) {
+    for ( size_t a = begin ; a < end ; ++a ) {
+      X       *r = A + packed(n,a,0);
+      const X  f = alpha * b[a];
+      CPPMAT_SIMD
+      for ( size_t j = a ; j < n ; ++j )
+        r[j] += f * b[j];
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// A = alpha * L * R^T + beta * A, where "L * R^T" is symmetric and "l(i,p)" and "r(i,p)" return the
+// entries of "L" and "R" (n x k)
+// - blocks of "nb" rows of the result are computed by the register-blocked kernel, from the diagonal
+//   onwards (only the lower half of the diagonal block is superfluous)
+template<typename X, class Fl, class Fr>
+inline
+void sprk_blocked(size_t n, size_t k, X alpha, Fl l, Fr r, X beta, X *A)
+{
+  const size_t nb = 96;
+
+  // small: entry-by-entry
+  if ( n * n * k <= 32768 ) {
+    for ( size_t a = 0 ; a < n ; ++a ) {
+      X *row = A + packed(n,a,0);
+      for ( size_t b = a ; b < n ; ++b ) {
+        X s = static_cast<X>(0);
+        for ( size_t p = 0 ; p < k ; ++p )
+          s += l(a,p) * r(b,p);
+        row[b] = ( beta == static_cast<X>(0) ) ? alpha * s : alpha * s + beta * row[b];
+      }
+    }
+    return;
+  }
+
+  // "R^T" (k x n), the block of rows "i0, ..., i0+nb" of the result uses its columns "i0, ..., n"
+  std::vector<X> Rt(k*n);
+  std::vector<X> T;
+
+  // (in blocks of rows of "R", to avoid a large stride of the writes)
+  for ( size_t jj = 0 ; jj < n ; jj += 16 )
+    for ( size_t p = 0 ; p < k ; ++p )
+      for ( size_t j = jj ; j < std::min(n, jj+16) ; ++j )
+        Rt[p*n+j] = r(j,p);
+
+  for ( size_t i0 = 0 ; i0 < n ; i0 += nb ) {
+
+    size_t m = std::min(n, i0+nb) - i0;
+    size_t w = n - i0;
+
+    T.resize(m*w);
+
+    gemm_blocked(m, w, k, [=](size_t i, size_t p) { return l(i0+i,p); }, Rt.data()+i0, n, T.data());
+
+    // upper triangle of the block: accumulate in the packed storage
+    for ( size_t a = 0 ; a < m ; ++a ) {
+      X       *row = A + packed(n,i0+a,i0+a);
+      const X *t   = T.data() + a*w + a;
+      if ( beta == static_cast<X>(0) ) {
+        CPPMAT_SIMD
+        for ( size_t j = 0 ; j < w-a ; ++j )
+          row[j] = alpha * t[j];
+      }
+      else {
+        CPPMAT_SIMD
+        for ( size_t j = 0 ; j < w-a ; ++j )
+          row[j] = alpha * t[j] + beta * row[j];
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void sprk(size_t n, size_t k, X alpha, const X *B, X beta, X *A)
+{
+  auto b = [B,k](size_t i, size_t p) { return B[i*k+p]; };
+
+  sprk_blocked(n, k, alpha, b, b, beta, A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void spr2k(size_t n, size_t k, X alpha, const X *B, const X *C, X beta, X *A)
+{
+  // B * C^T + C * B^T = [B, C] * [C, B]^T
+  auto l = [B,C,k](size_t i, size_t p) { return p < k ? B[i*k+p] : C[i*k+p-k]; };
+  auto r = [B,C,k](size_t i, size_t p) { return p < k ? C[i*k+p] : B[i*k+p-k]; };
+
+  sprk_blocked(n, 2*k, alpha, l, r, beta, A);
+}
+
+// =================================================================================================
+// factorizations of a symmetric matrix in packed storage (in place)
+// =================================================================================================
+
+// rows "a0, ..., a1" of the factorization: the rows are factorized one-by-one, whereby only the rows
+// of the block are updated (the remaining rows are updated at once, see below)
+// - Cholesky: the row of "U" is the row of "A" divided by the square-root of the (updated) pivot
+template<typename X>
+inline
+bool cholesky_rows(size_t n, size_t a0, size_t a1, X *A)
+{
+  for ( size_t a = a0 ; a < a1 ; ++a ) {
+
+    // row "a", indexed by column
+    X *ra = A + packed(n,a,0);
+
+    // not positive definite (or not a number)
+    if ( not ( ra[a] > static_cast<X>(0) ) ) return false;
+
+    ra[a] = std::sqrt(ra[a]);
+
+    const X inv = static_cast<X>(1) / ra[a];
+
+    CPPMAT_SIMD
+    for ( size_t j = a+1 ; j < n ; ++j )
+      ra[j] *= inv;
+
+    for ( size_t b = a+1 ; b < a1 ; ++b ) {
+      X       *rb = A + packed(n,b,0);
+      const X  f  = ra[b];
+      CPPMAT_SIMD
+      for ( size_t j = b ; j < n ; ++j )
+        rb[j] -= f * ra[j];
+    }
+  }
+
+  return true;
+}
+
+// - LDLT: the row of "U" is the row of "A" divided by the (updated) pivot, that is kept as "D"
+template<typename X>
+inline
+bool ldlt_rows(size_t n, size_t a0, size_t a1, X *A)
+{
+  for ( size_t a = a0 ; a < a1 ; ++a ) {
+
+    // row "a", indexed by column
+    X *ra = A + packed(n,a,0);
+
+    // singular (or not a number)
+    if ( not ( std::abs(ra[a]) > static_cast<X>(0) ) ) return false;
+
+    const X inv = static_cast<X>(1) / ra[a];
+
+    for ( size_t b = a+1 ; b < a1 ; ++b ) {
+      X       *rb = A + packed(n,b,0);
+      const X  f  = ra[b] * inv;
+      CPPMAT_SIMD
+      for ( size_t j = b ; j < n ; ++j )
+        rb[j] -= f * ra[j];
+    }
+
+    CPPMAT_SIMD
+    for ( size_t j = a+1 ; j < n ; ++j )
+      ra[j] *= inv;
+  }
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// blocks of "nb" rows: after a block is factorized, the remaining rows (which in the packed storage
+// are a packed symmetric matrix by themselves) are updated by a single rank-"nb" update
+template<typename X>
+inline
+bool cholesky(size_t n, X *A)
+{
+  const size_t nb = 64;
+
+  for ( size_t a0 = 0 ; a0 < n ; a0 += nb ) {
+
+    size_t a1 = std::min(n, a0+nb);
+
+    if ( not cholesky_rows(n, a0, a1, A) ) return false;
+
+    if ( a1 == n ) break;
+
+    // A_22 -= U_12^T * U_12
+    auto u = [A,n,a0,a1](size_t i, size_t p) { return A[packed(n,a0+p,a1+i)]; };
+
+    sprk_blocked(n-a1, a1-a0, static_cast<X>(-1), u, u, static_cast<X>(1), A+packed(n,a1,a1));
+  }
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool ldlt(size_t n, X *A)
+{
+  const size_t nb = 64;
+
+  for ( size_t a0 = 0 ; a0 < n ; a0 += nb ) {
+
+    size_t a1 = std::min(n, a0+nb);
+
+    if ( not ldlt_rows(n, a0, a1, A) ) return false;
+
+    if ( a1 == n ) break;
+
+    // A_22 -= U_12^T * D_1 * U_12
+    auto u  = [A,n,a0,a1](size_t i, size_t p) { return A[packed(n,a0+p,a1+i)]; };
+    auto du = [A,n,a0,a1](size_t i, size_t p) { return A[packed(n,a0+p,a0+p)] * A[packed(n,a0+p,a1+i)]; };
+
+    sprk_blocked(n-a1, a1-a0, static_cast<X>(-1), du, u, static_cast<X>(1), A+packed(n,a1,a1));
+  }
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// fixed size: plain loops, that the compiler unrolls
+template<typename X, size_t N>
+inline
+bool cholesky(X *A)
+{
+  if ( N > 16 ) return cholesky(N, A);
+
+  for ( size_t a = 0 ; a < N ; ++a ) {
+    X *ra = A + packed(N,a,0);
+    if ( not ( ra[a] > static_cast<X>(0) ) ) return false;
+    const X inv = std::sqrt(ra[a]) * ( static_cast<X>(1) / ra[a] ); // sqrt and division in parallel
+    ra[a] = std::sqrt(ra[a]);
+    for ( size_t j = a+1 ; j < N ; ++j )
+      ra[j] *= inv;
+    for ( size_t b = a+1 ; b < N ; ++b ) {
+      X *rb = A + packed(N,b,0);
+      for ( size_t j = b ; j < N ; ++j )
+        rb[j] -= ra[b] * ra[j];
+    }
+  }
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+bool ldlt(X *A)
+{
+  if ( N > 16 ) return ldlt(N, A);
+
+  for ( size_t a = 0 ; a < N ; ++a ) {
+    X *ra = A + packed(N,a,0);
+    if ( not ( std::abs(ra[a]) > static_cast<X>(0) ) ) return false;
+    const X inv = static_cast<X>(1) / ra[a];
+    for ( size_t b = a+1 ; b < N ; ++b ) {
+      X *rb = A + packed(N,b,0);
+      for ( size_t j = b ; j < N ; ++j )
+        rb[j] -= ra[b] * inv * ra[j];
+    }
+    for ( size_t j = a+1 ; j < N ; ++j )
+      ra[j] *= inv;
+  }
+
+  return true;
+}
+
+// =================================================================================================
+// solves using a factorization in packed storage, for "k" right-hand-sides (in place)
+// =================================================================================================
+
+// "B" (n x k): forward and backward substitution, blocked such that most operations are a product
+// - "unit == false": A = U^T * U, both substitutions divide by "U_aa"
+// - "unit == true" : A = U^T * D * U, with "D" stored on the diagonal, that is divided out in between
+template<typename X>
+inline
+void factor_solve(size_t n, size_t k, const X *U, X *B, bool unit)
+{
+  // single right-hand-side: contiguous rows of "U"
+  if ( k == 1 )
+  {
+    for ( size_t a = 0 ; a < n ; ++a ) {
+      const X *r = U + packed(n,a,0);
+      if ( not unit ) B[a] /= r[a];
+      const X f = B[a];
+      CPPMAT_SIMD
+      for ( size_t j = a+1 ; j < n ; ++j )
+        B[j] -= r[j] * f;
+    }
+
+    if ( unit )
+      for ( size_t a = 0 ; a < n ; ++a )
+        B[a] /= U[packed(n,a,a)];
+
+    for ( size_t a = n ; a-- > 0 ; ) {
+      const X *r = U + packed(n,a,0);
+      B[a] -= dot(r+a+1, B+a+1, n-a-1);
+      if ( not unit ) B[a] /= r[a];
+    }
+
+    return;
+  }
+
+  // several right-hand-sides: per panel of "kc" columns of "B", per block of "nb" rows
+  // - within a block: substitution along the rows of the panel (vectorized along the columns)
+  // - the coupling with the remaining rows is a single product (with the blocked "gemm")
+  const size_t nb = 64;
+  const size_t kc = 512;
+
+  std::vector<X> T(std::min(k, kc) * ( n > nb ? std::max(n-nb, nb) : 0 ));
+
+  for ( size_t c0 = 0 ; c0 < k ; c0 += kc ) {
+
+    size_t w = std::min(k, c0+kc) - c0;
+    X     *P = B + c0;
+
+    // row "a" of the panel
+    auto row = [P,k](size_t a) { return P + a*k; };
+
+    // Y_2 -= T, with "T" (m x w) stored densely
+    auto subtract = [&T,row,w](size_t a, size_t m) {
+      const X *t = T.data();
+      parallel_for(m, m*w, [=](size_t begin, size_t end) {
+        for ( size_t i = begin ; i < end ; ++i ) {
+          X *y = row(a+i);
+          CPPMAT_SIMD
+          for ( size_t c = 0 ; c < w ; ++c )
+            y[c] -= t[i*w+c];
+        }
+      });
+    };
+
+    // forward substitution: U^T * Y = B
+    for ( size_t a0 = 0 ; a0 < n ; a0 += nb ) {
+
+      size_t a1 = std::min(n, a0+nb);
+
+      for ( size_t a = a0 ; a < a1 ; ++a ) {
+        const X *r  = U + packed(n,a,0);
+        X       *ya = row(a);
+        if ( not unit ) {
+          const X inv = static_cast<X>(1) / r[a];
+          CPPMAT_SIMD
+          for ( size_t c = 0 ; c < w ; ++c )
+            ya[c] *= inv;
+        }
+        for ( size_t j = a+1 ; j < a1 ; ++j ) {
+          X       *yj = row(j);
+          const X  f  = r[j];
+          CPPMAT_SIMD
+          for ( size_t c = 0 ; c < w ; ++c )
+            yj[c] -= f * ya[c];
+        }
+      }
+
+      if ( a1 == n ) break;
+
+      // Y_2 -= U_12^T * Y_1
+      auto u = [U,n,a0,a1](size_t i, size_t p) { return U[packed(n,a0+p,a1+i)]; };
+
+      gemm_blocked(n-a1, w, a1-a0, u, row(a0), k, T.data());
+
+      subtract(a1, n-a1);
+    }
+
+    // diagonal
+    if ( unit ) {
+      for ( size_t a = 0 ; a < n ; ++a ) {
+        X       *ya  = row(a);
+        const X  inv = static_cast<X>(1) / U[packed(n,a,a)];
+        CPPMAT_SIMD
+        for ( size_t c = 0 ; c < w ; ++c )
+          ya[c] *= inv;
+      }
+    }
+
+    // backward substitution: U * X = Y
+    for ( size_t a1 = n ; a1 > 0 ; ) {
+
+      size_t a0 = a1 - std::min(a1, nb);
+
+      // Y_1 -= U_12 * X_2
+      if ( a1 < n ) {
+        auto u = [U,n,a0,a1](size_t i, size_t p) { return U[packed(n,a0+i,a1+p)]; };
+
+        gemm_blocked(a1-a0, w, n-a1, u, row(a1), k, T.data());
+
+        subtract(a0, a1-a0);
+      }
+
+      for ( size_t a = a1 ; a-- > a0 ; ) {
+        const X *r  = U + packed(n,a,0);
+        X       *ya = row(a);
+        for ( size_t j = a+1 ; j < a1 ; ++j ) {
+          const X *yj = row(j);
+          const X  f  = r[j];
+          CPPMAT_SIMD
+          for ( size_t c = 0 ; c < w ; ++c )
+            ya[c] -= f * yj[c];
+        }
+        if ( not unit ) {
+          const X inv = static_cast<X>(1) / r[a];
+          CPPMAT_SIMD
+          for ( size_t c = 0 ; c < w ; ++c )
+            ya[c] *= inv;
+        }
+      }
+
+      a1 = a0;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void cholesky_solve(size_t n, size_t k, const X *U, X *B)
+{
+  factor_solve(n, k, U, B, false);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ldlt_solve(size_t n, size_t k, const X *U, X *B)
+{
+  factor_solve(n, k, U, B, true);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// fixed size, single right-hand-side: plain loops, that the compiler unrolls (the reciprocals of the
+// diagonal are independent, which keeps the divisions out of the chain of dependent operations)
+template<typename X, size_t N>
+inline
+void cholesky_solve(const X *U, X *b)
+{
+  X inv[N];
+
+  for ( size_t a = 0 ; a < N ; ++a )
+    inv[a] = static_cast<X>(1) / U[packed(N,a,a)];
+
+  for ( size_t a = 0 ; a < N ; ++a ) {
+    const X *r = U + packed(N,a,0);
+    b[a] *= inv[a];
+    for ( size_t j = a+1 ; j < N ; ++j )
+      b[j] -= r[j] * b[a];
+  }
+
+  for ( size_t a = N ; a-- > 0 ; ) {
+    const X *r = U + packed(N,a,0);
+    for ( size_t j = a+1 ; j < N ; ++j )
+      b[a] -= r[j] * b[j];
+    b[a] *= inv[a];
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N>
+inline
+void ldlt_solve(const X *U, X *b)
+{
+  for ( size_t a = 0 ; a < N ; ++a ) {
+    const X *r = U + packed(N,a,0);
+    for ( size_t j = a+1 ; j < N ; ++j )
+      b[j] -= r[j] * b[a];
+  }
+
+  for ( size_t a = 0 ; a < N ; ++a )
+    b[a] *= static_cast<X>(1) / U[packed(N,a,a)];
+
+  for ( size_t a = N ; a-- > 0 ; ) {
+    const X *r = U + packed(N,a,0);
+    for ( size_t j = a+1 ; j < N ; ++j )
+      b[a] -= r[j] * b[j];
+  }
+}
+
+// =================================================================================================
+// determinant and inverse of a general matrix (Gauss-Jordan elimination with partial pivoting)
+// =================================================================================================
+
+// row with the largest entry in column "a" (from row "a" onward)
+template<typename X>
+inline
+size_t gauss_pivot(size_t n, size_t a, const X *A)
+{
+  size_t p = a;
+
+  for ( size_t i = a+1 ; i < n ; ++i )
+    if ( std::abs(A[i*n+a]) > std::abs(A[p*n+a]) )
+      p = i;
+
+  return p;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X gauss_det(size_t n, X *A)
+{
+  X out = static_cast<X>(1);
+
+  for ( size_t a = 0 ; a < n ; ++a ) {
+
+    size_t p = gauss_pivot(n, a, A);
+
+    if ( A[p*n+a] == static_cast<X>(0) ) return static_cast<X>(0);
+
+    // swap rows: change of sign
+    if ( p != a ) {
+      std::swap_ranges(A+a*n, A+(a+1)*n, A+p*n);
+      out = -out;
+    }
+
+    out *= A[a*n+a];
+
+    const X inv = static_cast<X>(1) / A[a*n+a];
+
+    for ( size_t i = a+1 ; i < n ; ++i ) {
+      const X f = A[i*n+a] * inv;
+      CPPMAT_SIMD
+      for ( size_t j = a+1 ; j < n ; ++j )
+        A[i*n+j] -= f * A[a*n+j];
+    }
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// "[A | I]" is reduced to "[I | C]"
+template<typename X>
+inline
+void gauss_inv(size_t n, X *A, X *C)
+{
+  std::fill(C, C+n*n, static_cast<X>(0));
+
+  for ( size_t a = 0 ; a < n ; ++a )
+    C[a*n+a] = static_cast<X>(1);
+
+  for ( size_t a = 0 ; a < n ; ++a ) {
+
+    size_t p = gauss_pivot(n, a, A);
+
+    if ( p != a ) {
+      std::swap_ranges(A+a*n, A+(a+1)*n, A+p*n);
+      std::swap_ranges(C+a*n, C+(a+1)*n, C+p*n);
+    }
+
+    const X inv = static_cast<X>(1) / A[a*n+a];
+
+    CPPMAT_SIMD
+    for ( size_t j = 0 ; j < n ; ++j ) {
+      A[a*n+j] *= inv;
+      C[a*n+j] *= inv;
+    }
+
+    for ( size_t i = 0 ; i < n ; ++i ) {
+      if ( i == a ) continue;
+      const X f = A[i*n+a];
+      CPPMAT_SIMD
+      for ( size_t j = 0 ; j < n ; ++j ) {
+        A[i*n+j] -= f * A[a*n+j];
+        C[i*n+j] -= f * C[a*n+j];
+      }
+    }
+  }
+}
+
+// =================================================================================================
+// eigen-decomposition of a symmetric matrix in packed storage
+// =================================================================================================
+
+// Jacobi rotation that diagonalizes the 2x2 matrix "[a, b; b, d]": the eigenvalues are "a - t * b"
+// and "d + t * b", with eigenvectors "(c, -s)" and "(s, c)" (whereby "t = s / c", "|t| <= 1")
+template<typename X>
+inline
+void jacobi_rotation(X a, X b, X d, X &c, X &s, X &t)
+{
+  if ( b == static_cast<X>(0) ) {
+    c = static_cast<X>(1);
+    s = static_cast<X>(0);
+    t = static_cast<X>(0);
+    return;
+  }
+
+  // N.B. for large "tau" the result correctly tends to zero (also if "tau * tau" overflows)
+  X tau = ( d - a ) / ( static_cast<X>(2) * b );
+
+  t = ( tau >= static_cast<X>(0) ? static_cast<X>(1) : static_cast<X>(-1) ) /
+      ( std::abs(tau) + std::sqrt(static_cast<X>(1) + tau * tau) );
+  c = static_cast<X>(1) / std::sqrt(static_cast<X>(1) + t * t);
+  s = t * c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// sort "n" eigenvalues in ascending order, with the columns of "vec" ("nullptr" to skip)
+template<typename X>
+inline
+void eig_sort(size_t n, X *val, X *vec)
+{
+  for ( size_t i = 1 ; i < n ; ++i ) {
+    for ( size_t j = i ; j > 0 and val[j] < val[j-1] ; --j ) {
+      std::swap(val[j], val[j-1]);
+      if ( vec )
+        for ( size_t k = 0 ; k < n ; ++k )
+          std::swap(vec[k*n+j], vec[k*n+j-1]);
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// 2-D: "A = [a, b; b, d]"
+template<typename X>
+inline
+void eig_sym2(const X *A, X *val, X *vec)
+{
+  X c, s, t;
+
+  jacobi_rotation(A[0], A[1], A[2], c, s, t);
+
+  val[0] = A[0] - t * A[1];
+  val[1] = A[2] + t * A[1];
+
+  if ( vec ) {
+    vec[0] =  c; vec[1] = s;
+    vec[2] = -s; vec[3] = c;
+  }
+
+  eig_sort(2, val, vec);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// 3-D
+template<typename X>
+inline
+void eig_sym3(const X *A, X *val, X *vec)
+{
+  const X one = static_cast<X>(1);
+  const X two = static_cast<X>(2);
+
+  // scale to avoid over- and underflow
+  X scale = std::abs(A[0]);
+
+  for ( size_t i = 1 ; i < 6 ; ++i )
+    scale = std::max(scale, std::abs(A[i]));
+
+  if ( scale == static_cast<X>(0) ) {
+    std::fill(val, val+3, static_cast<X>(0));
+    if ( vec ) { std::fill(vec, vec+9, static_cast<X>(0)); vec[0] = vec[4] = vec[8] = one; }
+    return;
+  }
+
+  X m[6];
+  X inv = one / scale;
+
+  for ( size_t i = 0 ; i < 6 ; ++i )
+    m[i] = A[i] * inv;
+
+  // eigenvalues of "m = q * I + p * B", with "B" a deviatoric tensor with "B : B = 6" such that its
+  // eigenvalues are "2 * cos(phi + 2 * k * pi / 3)" with "cos(3 * phi) = det(B) / 2"
+  X q  = ( m[0] + m[3] + m[5] ) / static_cast<X>(3);
+  X b0 = m[0] - q;
+  X b3 = m[3] - q;
+  X b5 = m[5] - q;
+  X p  = std::sqrt(( b0*b0 + b3*b3 + b5*b5 + two * ( m[1]*m[1] + m[2]*m[2] + m[4]*m[4] ) ) / 6);
+
+  // isotropic
+  if ( p == static_cast<X>(0) ) {
+    std::fill(val, val+3, A[0]);
+    if ( vec ) { std::fill(vec, vec+9, static_cast<X>(0)); vec[0] = vec[4] = vec[8] = one; }
+    return;
+  }
+
+  X ip = one / p;
+
+  b0 *= ip; b3 *= ip; b5 *= ip;
+
+  X b1 = m[1] * ip;
+  X b2 = m[2] * ip;
+  X b4 = m[4] * ip;
+  X r  = ( b0 * b3 * b5 + two * b1 * b2 * b4 - b4 * b4 * b0 - b2 * b2 * b3 - b1 * b1 * b5 ) / two;
+  X phi = std::acos(std::min(one, std::max(-one, r))) / static_cast<X>(3);
+
+  // N.B. "cos(phi + 2 pi / 3) = - ( cos(phi) + sqrt(3) * sin(phi) ) / 2", with "0 <= phi <= pi / 3"
+  X cphi = std::cos(phi);
+  X sphi = std::sqrt(std::max(static_cast<X>(0), one - cphi * cphi));
+  X lmax = q + two * p * cphi;
+  X lmin = q - p * ( cphi + static_cast<X>(1.73205080756887729352744634151) * sphi );
+  X lmid = static_cast<X>(3) * q - lmax - lmin;
+
+  // well separated eigenvalues are accurate, but (nearly) repeated eigenvalues are not ("acos" is
+  // ill-conditioned close to "r = -1, 1"): they are computed below
+  X tmp[9];
+
+  if ( not vec ) {
+    if ( std::min(lmax - lmid, lmid - lmin) > static_cast<X>(1.e-3) * p ) {
+      val[0] = lmin * scale;
+      val[1] = lmid * scale;
+      val[2] = lmax * scale;
+      return;
+    }
+    vec = &tmp[0];
+  }
+
+  // the eigenvalue that is most separated from the others, its eigenvector is normal to the rows
+  // of "m - l * I": the largest cross product of two of the rows is the most accurate
+  X l = ( lmax - lmid >= lmid - lmin ) ? lmax : lmin;
+
+  X r0[3] = { m[0] - l, m[1]    , m[2]     };
+  X r1[3] = { m[1]    , m[3] - l, m[4]     };
+  X r2[3] = { m[2]    , m[4]    , m[5] - l };
+
+  auto cross = [](const X *x, const X *y, X *z) {
+    z[0] = x[1] * y[2] - x[2] * y[1];
+    z[1] = x[2] * y[0] - x[0] * y[2];
+    z[2] = x[0] * y[1] - x[1] * y[0];
+  };
+
+  auto norm2 = [](const X *x) { return x[0] * x[0] + x[1] * x[1] + x[2] * x[2]; };
+
+  X v0[3], x[3], nv, nx;
+
+  cross(r0, r1, v0); nv = norm2(v0);
+  cross(r0, r2, x ); nx = norm2(x ); if ( nx > nv ) { std::copy(x, x+3, v0); nv = nx; }
+  cross(r1, r2, x ); nx = norm2(x ); if ( nx > nv ) { std::copy(x, x+3, v0); nv = nx; }
+
+  if ( nv > static_cast<X>(0) ) {
+    nv = one / std::sqrt(nv);
+    v0[0] *= nv; v0[1] *= nv; v0[2] *= nv;
+  }
+  else {
+    v0[0] = one; v0[1] = static_cast<X>(0); v0[2] = static_cast<X>(0);
+  }
+
+  // orthonormal basis "u1, u2" of the plane normal to "v0"
+  X u1[3], u2[3];
+
+  if ( std::abs(v0[0]) > std::abs(v0[1]) ) {
+    X n = one / std::sqrt(v0[0] * v0[0] + v0[2] * v0[2]);
+    u1[0] = -v0[2] * n; u1[1] = static_cast<X>(0); u1[2] = v0[0] * n;
+  }
+  else {
+    X n = one / std::sqrt(v0[1] * v0[1] + v0[2] * v0[2]);
+    u1[0] = static_cast<X>(0); u1[1] = v0[2] * n; u1[2] = -v0[1] * n;
+  }
+
+  cross(v0, u1, u2);
+
+  // the remaining eigenvalues and -vectors: diagonalize "m" in the plane
+  auto quad = [&m](const X *x, const X *y) {
+    return m[0] * x[0] * y[0] + m[3] * x[1] * y[1] + m[5] * x[2] * y[2] +
+           m[1] * ( x[0] * y[1] + x[1] * y[0] ) +
+           m[2] * ( x[0] * y[2] + x[2] * y[0] ) +
+           m[4] * ( x[1] * y[2] + x[2] * y[1] );
+  };
+
+  X a = quad(u1, u1);
+  X b = quad(u1, u2);
+  X d = quad(u2, u2);
+  X c, s, t;
+
+  jacobi_rotation(a, b, d, c, s, t);
+
+  val[0] = quad(v0, v0) * scale;
+  val[1] = ( a - t * b ) * scale;
+  val[2] = ( d + t * b ) * scale;
+
+  for ( size_t i = 0 ; i < 3 ; ++i ) {
+    vec[i*3+0] = v0[i];
+    vec[i*3+1] = c * u1[i] - s * u2[i];
+    vec[i*3+2] = s * u1[i] + c * u2[i];
+  }
+
+  eig_sort(3, val, vec);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// n-D: cyclic Jacobi method on a dense copy, until the off-diagonal is negligible
+template<typename X>
+inline
+void eig_jacobi(size_t n, const X *A, X *val, X *vec)
+{
+  if ( vec ) {
+    std::fill(vec, vec+n*n, static_cast<X>(0));
+    for ( size_t i = 0 ; i < n ; ++i )
+      vec[i*n+i] = static_cast<X>(1);
+  }
+
+  // scale to avoid over- and underflow
+  X scale = static_cast<X>(0);
+
+  for ( size_t i = 0 ; i < n*(n+1)/2 ; ++i )
+    scale = std::max(scale, std::abs(A[i]));
+
+  if ( scale == static_cast<X>(0) ) {
+    std::fill(val, val+n, static_cast<X>(0));
+    return;
+  }
+
+  std::vector<X> a(n*n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    for ( size_t j = i ; j < n ; ++j )
+      a[i*n+j] = a[j*n+i] = A[packed(n,i,j)] / scale;
+
+  X norm = static_cast<X>(0);
+
+  for ( auto &i : a )
+    norm += i * i;
+
+  const X tol = std::numeric_limits<X>::epsilon() * std::numeric_limits<X>::epsilon() * norm;
+
+  for ( size_t sweep = 0 ; sweep < 100 ; ++sweep ) {
+
+    X off = static_cast<X>(0);
+
+    for ( size_t p = 0 ; p < n ; ++p )
+      for ( size_t q = p+1 ; q < n ; ++q )
+        off += a[p*n+q] * a[p*n+q];
+
+    if ( off <= tol ) break;
+
+    for ( size_t p = 0 ; p < n ; ++p ) {
+      for ( size_t q = p+1 ; q < n ; ++q ) {
+
+        X c, s, t;
+
+        jacobi_rotation(a[p*n+p], a[p*n+q], a[q*n+q], c, s, t);
+
+        if ( s == static_cast<X>(0) ) continue;
+
+        // A = J^T * A * J
+        for ( size_t k = 0 ; k < n ; ++k ) {
+          X akp = a[k*n+p], akq = a[k*n+q];
+          a[k*n+p] = c * akp - s * akq;
+          a[k*n+q] = s * akp + c * akq;
+        }
+        for ( size_t k = 0 ; k < n ; ++k ) {
+          X apk = a[p*n+k], aqk = a[q*n+k];
+          a[p*n+k] = c * apk - s * aqk;
+          a[q*n+k] = s * apk + c * aqk;
+        }
+
+        // V = V * J
+        if ( vec ) {
+          for ( size_t k = 0 ; k < n ; ++k ) {
+            X vkp = vec[k*n+p], vkq = vec[k*n+q];
+            vec[k*n+p] = c * vkp - s * vkq;
+            vec[k*n+q] = s * vkp + c * vkq;
+          }
+        }
+      }
+    }
+  }
+
+  for ( size_t i = 0 ; i < n ; ++i )
+    val[i] = a[i*n+i] * scale;
+
+  eig_sort(n, val, vec);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void eig_sym(size_t n, const X *A, X *val, X *vec)
+{
+  if ( n == 1 ) {
+    val[0] = A[0];
+    if ( vec ) vec[0] = static_cast<X>(1);
+    return;
+  }
+
+  if ( n == 2 ) return eig_sym2(A, val, vec);
+  if ( n == 3 ) return eig_sym3(A, val, vec);
+
+  eig_jacobi(n, A, val, vec);
+}
+
+// =================================================================================================
+// isotropic functions of a symmetric matrix in packed storage
+// =================================================================================================
+
+// derivative of an isotropic function from the eigen-decomposition (see "isotropic"):
+//   dF/dA = sum_(a <= b) c_ab * S_ab (x) S_ab, with "S_ab = ( v_a (x) v_b + v_b (x) v_a ) / 2",
+// "c_aa = theta_aa", and "c_ab = 2 * theta_ab" (the terms "ab" and "ba" of the sum are combined)
+// N.B. the result has minor and major symmetry: it is accumulated on the independent components
+//      only, i.e. on "S_ab" in packed storage (workspace "S", na), and on the upper triangle of "P"
+//      (workspace, na x na), and expanded at the end
+// N.B. for "N > 0" the number of dimensions is known at compile time (and "n" is ignored)
+template<size_t N, typename X, class F>
+inline
+void isotropic_tangent(
+  size_t n, const X *val, const X *fv, const X *vec, X *S, X *P, X *dFdA, const F &func)
+{
+  if ( N > 0 ) n = N;
+
+  const size_t na = n * (n+1) / 2;
+  const size_t n2 = n * n;
+
+  std::fill(P, P+na*na, static_cast<X>(0));
+
+  for ( size_t a = 0 ; a < n ; ++a ) {
+    for ( size_t b = a ; b < n ; ++b ) {
+
+      X c;
+
+      if ( a == b ) c = func.df(val[a]);
+      else          c = static_cast<X>(2) * func.dd(val[a], val[b], fv[a], fv[b]);
+
+      for ( size_t k = 0, r = 0 ; k < n ; ++k )
+        for ( size_t l = k ; l < n ; ++l, ++r )
+          S[r] = ( vec[k*n+a] * vec[l*n+b] + vec[k*n+b] * vec[l*n+a] ) / static_cast<X>(2);
+
+      for ( size_t r = 0 ; r < na ; ++r ) {
+        const X cS = c * S[r];
+        for ( size_t q = r ; q < na ; ++q )
+          P[r*na+q] += cS * S[q];
+      }
+    }
+  }
+
+  for ( size_t r = 0 ; r < na ; ++r )
+    for ( size_t q = r+1 ; q < na ; ++q )
+      P[q*na+r] = P[r*na+q];
+
+  // expand: "dFdA_ijkl = P_rq", with "r = (i,j)" and "q = (k,l)"
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    for ( size_t j = 0 ; j < n ; ++j ) {
+      const X *Pr = P + packed(n, std::min(i,j), std::max(i,j)) * na;
+      X *C = dFdA + (i*n+j)*n2;
+      for ( size_t k = 0 ; k < n ; ++k ) {
+        C[k*n+k] = Pr[packed(n,k,k)];
+        for ( size_t l = k+1 ; l < n ; ++l )
+          C[k*n+l] = C[l*n+k] = Pr[packed(n,k,l)];
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, class F>
+inline
+bool isotropic(size_t n, const X *A, X *out, X *dFdA, const F &func)
+{
+  const size_t na = n * (n+1) / 2;
+
+  // workspace: eigenvalues, function values, eigenvectors, and for "isotropic_tangent"
+  X local[3+3+3*3+6+6*6];
+  std::vector<X> heap;
+  X *work = local;
+
+  if ( n > 3 ) {
+    heap.resize(2*n+n*n+na+na*na);
+    work = heap.data();
+  }
+
+  X *val = work;
+  X *fv  = work + n;
+  X *vec = work + 2*n;
+  X *S   = work + 2*n + n*n;
+  X *P   = work + 2*n + n*n + na;
+
+  eig_sym(n, A, val, vec);
+
+  for ( size_t a = 0 ; a < n ; ++a )
+    if ( not func.valid(val[a]) )
+      return false;
+
+  for ( size_t a = 0 ; a < n ; ++a )
+    fv[a] = func.f(val[a]);
+
+  // F = V * diag(f) * V^T
+  for ( size_t i = 0 ; i < n ; ++i ) {
+    for ( size_t j = i ; j < n ; ++j ) {
+      X Fij = static_cast<X>(0);
+      for ( size_t a = 0 ; a < n ; ++a )
+        Fij += vec[i*n+a] * fv[a] * vec[j*n+a];
+      out[packed(n,i,j)] = Fij;
+    }
+  }
+
+  if ( not dFdA ) return true;
+
+  if      ( n == 2 ) isotropic_tangent<2>(n, val, fv, vec, S, P, dFdA, func);
+  else if ( n == 3 ) isotropic_tangent<3>(n, val, fv, vec, S, P, dFdA, func);
+  else               isotropic_tangent<0>(n, val, fv, vec, S, P, dFdA, func);
+
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// N.B. the divided differences "dd" are evaluated such that they are accurate for close "a" and "b"
+
+template<typename X>
+inline
+bool isotropic_log<X>::valid(X x) const
+{
+  return x > static_cast<X>(0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_log<X>::f(X x) const
+{
+  return std::log(x);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_log<X>::df(X x) const
+{
+  return static_cast<X>(1) / x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_log<X>::dd(X a, X b, X, X) const
+{
+  if ( a == b ) return static_cast<X>(1) / a;
+
+  // ( log(a) - log(b) ) / ( a - b ) = log(1 + (a - b) / b) / ( a - b )
+  return std::log1p( ( a - b ) / b ) / ( a - b );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool isotropic_exp<X>::valid(X) const
+{
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_exp<X>::f(X x) const
+{
+  return std::exp(x);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_exp<X>::df(X x) const
+{
+  return std::exp(x);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_exp<X>::dd(X a, X b, X fa, X fb) const
+{
+  if ( a == b ) return fa;
+
+  // ( exp(a) - exp(b) ) / ( a - b ) = exp(a) * ( 1 - exp(b - a) ) / ( a - b ), with "a > b"
+  if ( a < b ) {
+    std::swap(a, b);
+    std::swap(fa, fb);
+  }
+
+  return - fa * std::expm1( b - a ) / ( a - b );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool isotropic_sqrt<X>::valid(X x) const
+{
+  return x >= static_cast<X>(0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_sqrt<X>::f(X x) const
+{
+  return std::sqrt(x);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_sqrt<X>::df(X x) const
+{
+  return static_cast<X>(1) / ( static_cast<X>(2) * std::sqrt(x) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_sqrt<X>::dd(X, X, X fa, X fb) const
+{
+  // ( sqrt(a) - sqrt(b) ) / ( a - b ) = 1 / ( sqrt(a) + sqrt(b) )
+  return static_cast<X>(1) / ( fa + fb );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+bool isotropic_pow<X>::valid(X x) const
+{
+  return x > static_cast<X>(0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_pow<X>::f(X x) const
+{
+  return std::pow(x, p);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_pow<X>::df(X x) const
+{
+  return p * std::pow(x, p) / x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X isotropic_pow<X>::dd(X a, X b, X fa, X fb) const
+{
+  if ( a == b ) return p * fa / a;
+
+  // ( a^p - b^p ) / ( a - b ) = b^p * ( exp(p * log(1 + (a - b) / b)) - 1 ) / ( a - b )
+  return fb * std::expm1( p * std::log1p( ( a - b ) / b ) ) / ( a - b );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// "AoS": directly on the storage, "SoA": on a local copy of each tensor
+template<typename X, size_t ND, class F>
+inline
+bool isotropic_field(size_t m, bool soa, const X *A, X *out, X *dFdA, const F &func)
+{
+  const size_t NA = ND * (ND+1) / 2;
+  const size_t N4 = ND * ND * ND * ND;
+
+  std::atomic<bool> ok(true);
+
+  parallel_for(m, m*ND*ND*ND*( dFdA ? ND : 1 ), [&](size_t begin, size_t end) {
+
+    if ( not soa ) {
+      for ( size_t i = begin ; i < end ; ++i )
+        if ( not isotropic(ND, A+i*NA, out+i*NA, dFdA ? dFdA+i*N4 : nullptr, func) )
+          ok = false;
+      return;
+    }
+
+    X a[NA], f[NA];
+    std::vector<X> d( dFdA ? N4 : 0 );
+
+    for ( size_t i = begin ; i < end ; ++i ) {
+
+      for ( size_t c = 0 ; c < NA ; ++c ) a[c] = A[c*m+i];
+
+      if ( not isotropic(ND, a, f, dFdA ? d.data() : nullptr, func) ) {
+        ok = false;
+        continue;
+      }
+
+      for ( size_t c = 0 ; c < NA ; ++c ) out[c*m+i] = f[c];
+
+      if ( dFdA )
+        for ( size_t c = 0 ; c < N4 ; ++c ) dFdA[c*m+i] = d[c];
+    }
+  });
+
+  return ok;
+}
+
 // =================================================================================================
 
 }} // namespace ...
@@ -51,4 +1912,3 @@ inline bool equal(double a, double b)
 // -------------------------------------------------------------------------------------------------
 
 #endif
-
@@ -13,6 +13,8 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
+#include "pybind11_private.hpp"
+
 #include "pybind11_var_regular_array.hpp"
 #include "pybind11_var_regular_matrix.hpp"
 #include "pybind11_var_regular_vector.hpp"
@@ -35,4 +37,14 @@
 #include "pybind11_fix_cartesian_tensor2d.hpp"
 #include "pybind11_fix_cartesian_vector.hpp"
 
+#include "pybind11_map_regular_array.hpp"
+#include "pybind11_map_regular_matrix.hpp"
+#include "pybind11_map_regular_vector.hpp"
+#include "pybind11_map_cartesian_tensor4.hpp"
+#include "pybind11_map_cartesian_tensor2.hpp"
+#include "pybind11_map_cartesian_vector.hpp"
+#include "pybind11_map_strided_array.hpp"
+
+#include "pybind11_cartesian.hpp"
+
 #endif
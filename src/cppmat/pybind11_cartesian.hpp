@@ -0,0 +1,547 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_CARTESIAN_PYBIND11_HPP
+#define CPPMAT_CARTESIAN_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// tensors stored in a NumPy-array of shape "(..., ND, ..., ND)": a number of leading (batch) axes,
+// followed by "rank" axes of length "ND"
+// =================================================================================================
+
+struct numpy_tensors
+{
+  std::vector<size_t> shape; // shape of the batch axes
+  size_t              n;     // number of tensors == prod(shape)
+  size_t              nd;    // number of dimensions
+  size_t              size;  // number of components of each tensor == ND^rank
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+numpy_tensors numpy_tensors_read(const py::array_t<X, py::array::c_style | py::array::forcecast> &A,
+  size_t rank)
+{
+  numpy_tensors out;
+
+  size_t ndim = static_cast<size_t>(A.ndim());
+
+  if ( ndim < rank )
+    throw py::value_error("cppmat: expected an array of shape (..., ND) with "+
+      std::to_string(rank)+" axes of length ND");
+
+  out.nd   = static_cast<size_t>(A.shape(ndim-1));
+  out.n    = 1;
+  out.size = 1;
+
+  for ( size_t i = ndim-rank ; i < ndim ; ++i )
+  {
+    if ( static_cast<size_t>(A.shape(i)) != out.nd )
+      throw py::value_error("cppmat: the last "+std::to_string(rank)+" axes must have equal length");
+
+    out.size *= out.nd;
+  }
+
+  for ( size_t i = 0 ; i < ndim-rank ; ++i )
+  {
+    out.shape.push_back(static_cast<size_t>(A.shape(i)));
+    out.n *= out.shape.back();
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// batch shape of a binary operation: equal batch shapes, or one single tensor (without batch axes)
+// that is combined with each tensor of the other argument
+inline
+std::vector<size_t> numpy_tensors_shape(const numpy_tensors &A, const numpy_tensors &B)
+{
+  if ( A.nd != B.nd )
+    throw py::value_error("cppmat: the number of dimensions of the tensors must be equal");
+
+  if ( A.shape == B.shape ) return A.shape;
+  if ( A.shape.size() == 0 ) return B.shape;
+  if ( B.shape.size() == 0 ) return A.shape;
+
+  throw py::value_error("cppmat: the batch shapes must be equal (or one argument must be a tensor)");
+}
+
+// =================================================================================================
+// operation on one tensor: read "a" (and "b"), write the result to "c"
+// =================================================================================================
+
+template<typename X, size_t ND>
+struct numpy_ddot44
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor4<X,ND> T4;
+
+    T4 A = T4::Copy(a, a+T4::Size());
+    T4 B = T4::Copy(b, b+T4::Size());
+    T4 C = A.ddot(B);
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_ddot42
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor4<X,ND> T4;
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T4 A = T4::Copy(a, a+T4::Size());
+    T2 B = T2::Copy(b, b+T2::Size());
+    T2 C = A.ddot(B);
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_ddot24
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor4<X,ND> T4;
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+    T4 B = T4::Copy(b, b+T4::Size());
+    T2 C = A.ddot(B);
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_ddot22
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+    T2 B = T2::Copy(b, b+T2::Size());
+
+    *c = A.ddot(B);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_dot22
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+    T2 B = T2::Copy(b, b+T2::Size());
+    T2 C = A.dot(B);
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_dot21
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+    typedef cppmat::tiny::cartesian::vector <X,ND> V;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+    V  B = V ::Copy(b, b+V ::Size());
+    V  C = A.dot(B);
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_dyadic22
+{
+  static void run(const X *a, const X *b, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor4<X,ND> T4;
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+    T2 B = T2::Copy(b, b+T2::Size());
+    T4 C = A.dyadic(B);
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_inv
+{
+  static void run(const X *a, const X *, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+    T2 C = A.inv();
+
+    std::copy(C.begin(), C.end(), c);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_det
+{
+  static void run(const X *a, const X *, X *c)
+  {
+    typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+    T2 A = T2::Copy(a, a+T2::Size());
+
+    *c = A.det();
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_trace
+{
+  static void run(const X *a, const X *, X *c)
+  {
+    X out = static_cast<X>(0);
+
+    for ( size_t i = 0 ; i < ND ; ++i )
+      out += a[i*ND+i];
+
+    *c = out;
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_hyd
+{
+  static void run(const X *a, const X *, X *c)
+  {
+    numpy_trace<X,ND>::run(a, nullptr, c);
+
+    *c /= static_cast<X>(ND);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+struct numpy_dev
+{
+  static void run(const X *a, const X *, X *c)
+  {
+    X m;
+
+    numpy_hyd<X,ND>::run(a, nullptr, &m);
+
+    std::copy(a, a+ND*ND, c);
+
+    for ( size_t i = 0 ; i < ND ; ++i )
+      c[i*ND+i] -= m;
+  }
+};
+
+// =================================================================================================
+// apply an operation to "n" tensors, in parallel and without the GIL
+// - "sa", "sb", "sc": the number of entries between two tensors ("0" to reuse one tensor)
+// =================================================================================================
+
+template<class Op, typename X>
+inline
+void numpy_tensors_run(size_t n, const X *a, size_t sa, const X *b, size_t sb, X *c, size_t sc)
+{
+  py::gil_scoped_release release;
+
+  parallel_for(n, n*(sa+sb+sc), [=](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      Op::run(a+i*sa, b+i*sb, c+i*sc);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// select the implementation for the number of dimensions (only in 2-D and 3-D)
+template<template<typename, size_t> class Op, typename X>
+inline
+void numpy_tensors_dispatch(size_t nd,
+  size_t n, const X *a, size_t sa, const X *b, size_t sb, X *c, size_t sc)
+{
+  switch ( nd )
+  {
+    case 2: numpy_tensors_run<Op<X,2>>(n, a, sa, b, sb, c, sc); return;
+    case 3: numpy_tensors_run<Op<X,3>>(n, a, sa, b, sb, c, sc); return;
+    default: throw py::value_error("cppmat: only implemented in 2-D and 3-D");
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// number of components of a tensor: ND^rank
+inline
+size_t numpy_tensors_size(size_t nd, size_t rank)
+{
+  size_t out = 1;
+
+  for ( size_t i = 0 ; i < rank ; ++i )
+    out *= nd;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// output of shape "(..., ND, ..., ND)", with "rank" axes of length "ND" (a scalar for "rank == 0")
+template<typename X>
+inline
+py::array_t<X> numpy_tensors_allocate(std::vector<size_t> shape, size_t nd, size_t rank)
+{
+  for ( size_t i = 0 ; i < rank ; ++i )
+    shape.push_back(nd);
+
+  return py::array_t<X>(shape);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<template<typename, size_t> class Op, typename X>
+inline
+py::array_t<X> numpy_unary(
+  const py::array_t<X, py::array::c_style | py::array::forcecast> &A, size_t ra, size_t rc)
+{
+  numpy_tensors a = numpy_tensors_read(A, ra);
+
+  py::array_t<X> C = numpy_tensors_allocate<X>(a.shape, a.nd, rc);
+
+  size_t sc = numpy_tensors_size(a.nd, rc);
+
+  numpy_tensors_dispatch<Op>(a.nd, a.n, A.data(), a.size, A.data(), 0, C.mutable_data(), sc);
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<template<typename, size_t> class Op, typename X>
+inline
+py::array_t<X> numpy_binary(
+  const py::array_t<X, py::array::c_style | py::array::forcecast> &A, size_t ra,
+  const py::array_t<X, py::array::c_style | py::array::forcecast> &B, size_t rb, size_t rc)
+{
+  numpy_tensors a = numpy_tensors_read(A, ra);
+  numpy_tensors b = numpy_tensors_read(B, rb);
+
+  std::vector<size_t> shape = numpy_tensors_shape(a, b);
+
+  size_t n = std::max(a.n, b.n);
+
+  // - a tensor without batch axes is reused for each tensor of the other argument
+  size_t sa = ( a.shape.size() == 0 and b.shape.size() > 0 ) ? 0 : a.size;
+  size_t sb = ( b.shape.size() == 0 and a.shape.size() > 0 ) ? 0 : b.size;
+
+  py::array_t<X> C = numpy_tensors_allocate<X>(shape, a.nd, rc);
+
+  size_t sc = numpy_tensors_size(a.nd, rc);
+
+  numpy_tensors_dispatch<Op>(a.nd, n, A.data(), sa, B.data(), sb, C.mutable_data(), sc);
+
+  return C;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace python {
+namespace cartesian {
+
+// =================================================================================================
+// operations on each tensor of NumPy-arrays of shape "(..., ND, ..., ND)" (only in 2-D and 3-D)
+// - the leading (batch) axes of both arguments must be equal, or one argument is a single tensor
+// - the digits give the rank of the arguments, e.g. "ddot42": C_ij = A_ijkl * B_lk
+// - the GIL is released, and the tensors are processed in parallel (if enabled, see "parallel.h")
+// =================================================================================================
+
+template<typename X>
+using ndarray = py::array_t<X, py::array::c_style | py::array::forcecast>;
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> ddot44(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_ddot44>(A, 4, B, 4, 4);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> ddot42(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_ddot42>(A, 4, B, 2, 2);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> ddot24(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_ddot24>(A, 2, B, 4, 2);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> ddot22(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_ddot22>(A, 2, B, 2, 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> dot22(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_dot22>(A, 2, B, 2, 2);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> dot21(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_dot21>(A, 2, B, 1, 1);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> dyadic22(const ndarray<X> &A, const ndarray<X> &B)
+{
+  return cppmat::Private::numpy_binary<cppmat::Private::numpy_dyadic22>(A, 2, B, 2, 4);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> inv(const ndarray<X> &A)
+{
+  return cppmat::Private::numpy_unary<cppmat::Private::numpy_inv>(A, 2, 2);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> det(const ndarray<X> &A)
+{
+  return cppmat::Private::numpy_unary<cppmat::Private::numpy_det>(A, 2, 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> trace(const ndarray<X> &A)
+{
+  return cppmat::Private::numpy_unary<cppmat::Private::numpy_trace>(A, 2, 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> hyd(const ndarray<X> &A)
+{
+  return cppmat::Private::numpy_unary<cppmat::Private::numpy_hyd>(A, 2, 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+py::array_t<X> dev(const ndarray<X> &A)
+{
+  return cppmat::Private::numpy_unary<cppmat::Private::numpy_dev>(A, 2, 2);
+}
+
+// =================================================================================================
+// add all functions to a module, e.g. "cppmat::python::cartesian::bind<double>(m)"
+// =================================================================================================
+
+template<typename X>
+inline
+void bind(py::module &m)
+{
+  m.def("ddot44"  , &ddot44  <X>, "C_ijmn = A_ijkl * B_lkmn (for each tensor)", py::arg("A"), py::arg("B"));
+  m.def("ddot42"  , &ddot42  <X>, "C_ij = A_ijkl * B_lk (for each tensor)"    , py::arg("A"), py::arg("B"));
+  m.def("ddot24"  , &ddot24  <X>, "C_kl = A_ij * B_jikl (for each tensor)"    , py::arg("A"), py::arg("B"));
+  m.def("ddot22"  , &ddot22  <X>, "C = A_ij * B_ji (for each tensor)"         , py::arg("A"), py::arg("B"));
+  m.def("dot22"   , &dot22   <X>, "C_ik = A_ij * B_jk (for each tensor)"      , py::arg("A"), py::arg("B"));
+  m.def("dot21"   , &dot21   <X>, "C_i = A_ij * B_j (for each tensor)"        , py::arg("A"), py::arg("B"));
+  m.def("dyadic22", &dyadic22<X>, "C_ijkl = A_ij * B_kl (for each tensor)"    , py::arg("A"), py::arg("B"));
+  m.def("inv"     , &inv     <X>, "Inverse (for each tensor)"                 , py::arg("A"));
+  m.def("det"     , &det     <X>, "Determinant (for each tensor)"             , py::arg("A"));
+  m.def("trace"   , &trace   <X>, "Trace: A_ii (for each tensor)"             , py::arg("A"));
+  m.def("hyd"     , &hyd     <X>, "Hydrostatic part: A_ii / ND (for each tensor)", py::arg("A"));
+  m.def("dev"     , &dev     <X>, "Deviatoric part: A - A_ii / ND * I (for each tensor)", py::arg("A"));
+}
+
+// =================================================================================================
+
+}}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
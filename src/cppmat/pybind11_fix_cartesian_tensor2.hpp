@@ -59,14 +59,11 @@ public:
   // C++ -> Python
   // -------------
 
+  // - copy, or no copy for "py::return_value_policy::reference(_internal)"
   static py::handle cast(const cppmat::tiny::cartesian::tensor2<X,ND>& src,
-    py::return_value_policy, py::handle)
+    py::return_value_policy policy, py::handle parent)
   {
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(src.shape()), std::move(src.strides(true)), src.data());
-
-    // - release variable to Python
-    return a.release();
+    return cppmat::Private::numpy_view(src, policy, parent);
   }
 };
 
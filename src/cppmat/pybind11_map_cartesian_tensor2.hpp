@@ -0,0 +1,87 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_CARTESIAN_TENSOR2_PYBIND11_HPP
+#define CPPMAT_MAP_CARTESIAN_TENSOR2_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace pybind11 {
+namespace detail {
+
+// =================================================================================================
+// type caster: cppmat::view::cartesian::tensor2 <-> NumPy-array
+// - Python -> C++ : no copy, the view maps the data of the NumPy-array (a converted copy is made
+//   only if the data-type or the storage order does not match); the view is valid during the call
+// - C++ -> Python : copy, or no copy for "py::return_value_policy::reference(_internal)"
+// =================================================================================================
+
+template<typename X, size_t ND> struct type_caster<cppmat::view::cartesian::tensor2<X,ND>>
+{
+public:
+
+  using Arr = cppmat::view::cartesian::tensor2<X,ND>;
+
+  PYBIND11_TYPE_CASTER(Arr, _("cppmat::view::cartesian::tensor2<X,ND>"));
+
+private:
+
+  // NumPy-array that is mapped: the input itself, or a converted copy that is kept alive here
+  py::object mBuf;
+
+public:
+
+  // Python -> C++
+  // -------------
+
+  bool load(py::handle src, bool convert)
+  {
+    // - basic pybind11 check (without conversion the data-type and the storage order must match)
+    if ( !convert && !py::array_t<X, py::array::c_style>::check_(src) ) return false;
+
+    // - storage requirements : contiguous and row-major storage from NumPy
+    //   (no copy if the input satisfies the requirements)
+    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
+    // - check
+    if ( !buf ) return false;
+
+    // - rank of the input array (number of indices)
+    auto rank = buf.ndim();
+    // - check
+    if ( rank != 2 ) return false;
+
+    // - check shape in each direction
+    for ( ssize_t i = 0 ; i < rank ; ++i )
+      if ( static_cast<size_t>(buf.shape()[i]) != ND )
+        return false;
+
+    // - all checks passed : map the data
+    value = cppmat::view::cartesian::tensor2<X,ND>::Map(buf.data());
+    mBuf  = buf;
+
+    // - signal successful variable creation
+    return true;
+  }
+
+  // C++ -> Python
+  // -------------
+
+  static py::handle cast(const cppmat::view::cartesian::tensor2<X,ND>& src,
+    py::return_value_policy policy, py::handle parent)
+  {
+    return cppmat::Private::numpy_view(src, policy, parent);
+  }
+};
+
+// =================================================================================================
+
+}} // namespace pybind11::detail
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
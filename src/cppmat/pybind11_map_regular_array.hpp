@@ -0,0 +1,88 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_REGULAR_ARRAY_PYBIND11_HPP
+#define CPPMAT_MAP_REGULAR_ARRAY_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace pybind11 {
+namespace detail {
+
+// =================================================================================================
+// type caster: cppmat::view::array <-> NumPy-array
+// - Python -> C++ : no copy, the view maps the data of the NumPy-array (a converted copy is made
+//   only if the data-type or the storage order does not match); the view is valid during the call
+// - C++ -> Python : copy, or no copy for "py::return_value_policy::reference(_internal)"
+// =================================================================================================
+
+template<typename X, size_t RANK, size_t I, size_t J, size_t K, size_t L, size_t M, size_t N> struct type_caster<cppmat::view::array<X,RANK,I,J,K,L,M,N>>
+{
+public:
+
+  using Arr = cppmat::view::array<X,RANK,I,J,K,L,M,N>;
+
+  PYBIND11_TYPE_CASTER(Arr, _("cppmat::view::array<X,RANK,I,J,K,L,M,N>"));
+
+private:
+
+  // NumPy-array that is mapped: the input itself, or a converted copy that is kept alive here
+  py::object mBuf;
+
+public:
+
+  // Python -> C++
+  // -------------
+
+  bool load(py::handle src, bool convert)
+  {
+    // - basic pybind11 check (without conversion the data-type and the storage order must match)
+    if ( !convert && !py::array_t<X, py::array::c_style>::check_(src) ) return false;
+
+    // - storage requirements : contiguous and row-major storage from NumPy
+    //   (no copy if the input satisfies the requirements)
+    auto buf = py::array_t<X, py::array::c_style | py::array::forcecast>::ensure(src);
+    // - check
+    if ( !buf ) return false;
+
+    // - check rank of the input array (number of indices)
+    if ( static_cast<size_t>(buf.ndim()) != RANK ) return false;
+
+    // - check shape in each direction
+    if ( RANK > 0 and static_cast<size_t>(buf.shape()[0]) != I ) return false;
+    if ( RANK > 1 and static_cast<size_t>(buf.shape()[1]) != J ) return false;
+    if ( RANK > 2 and static_cast<size_t>(buf.shape()[2]) != K ) return false;
+    if ( RANK > 3 and static_cast<size_t>(buf.shape()[3]) != L ) return false;
+    if ( RANK > 4 and static_cast<size_t>(buf.shape()[4]) != M ) return false;
+    if ( RANK > 5 and static_cast<size_t>(buf.shape()[5]) != N ) return false;
+
+    // - all checks passed : map the data
+    value = cppmat::view::array<X,RANK,I,J,K,L,M,N>::Map(buf.data());
+    mBuf  = buf;
+
+    // - signal successful variable creation
+    return true;
+  }
+
+  // C++ -> Python
+  // -------------
+
+  static py::handle cast(const cppmat::view::array<X,RANK,I,J,K,L,M,N>& src,
+    py::return_value_policy policy, py::handle parent)
+  {
+    return cppmat::Private::numpy_view(src, policy, parent);
+  }
+};
+
+// =================================================================================================
+
+}} // namespace pybind11::detail
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
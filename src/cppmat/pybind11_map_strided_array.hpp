@@ -0,0 +1,118 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_MAP_STRIDED_ARRAY_PYBIND11_HPP
+#define CPPMAT_MAP_STRIDED_ARRAY_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace pybind11 {
+namespace detail {
+
+// =================================================================================================
+// type caster: cppmat::view::strided <-> NumPy-array
+// - Python -> C++ : no copy, the view maps the data of the NumPy-array with its strides (also for
+//   a slice, a transpose, ...); the view is valid during the call
+//   * "cppmat::view::strided<X>"       : the data-type must match and the array must be writeable
+//   * "cppmat::view::strided<const X>" : a converted copy is made if the data-type does not match
+// - C++ -> Python : copy, or no copy for "py::return_value_policy::reference(_internal)"
+// =================================================================================================
+
+template<typename X> struct type_caster<cppmat::view::strided<X>>
+{
+public:
+
+  using Arr = cppmat::view::strided<X>;
+
+  PYBIND11_TYPE_CASTER(Arr, _("cppmat::view::strided<X>"));
+
+private:
+
+  typedef typename std::remove_const<X>::type V;
+
+  // NumPy-array that is mapped: the input itself, or a converted copy that is kept alive here
+  py::object mBuf;
+
+  // map the data of a NumPy-array (false if the rank or the strides are not supported)
+  template<class A>
+  bool map(const A &buf)
+  {
+    // - rank of the input array (number of indices), see "cppmat::view::strided::MAX_DIM"
+    auto rank = buf.ndim();
+    // - check
+    if ( rank < 1 or rank > 6 ) return false;
+
+    // - writing to a read-only NumPy-array is not allowed
+    if ( !std::is_const<X>::value and !buf.writeable() ) return false;
+
+    // - shape and strides (in number of entries) of the input array
+    std::vector<size_t>    shape  (rank);
+    std::vector<ptrdiff_t> strides(rank);
+    // - copy
+    for ( ssize_t i = 0 ; i < rank ; ++i )
+    {
+      // - the strides must be a multiple of the item-size (not for e.g. a field of a record-array)
+      if ( buf.strides()[i] % static_cast<ssize_t>(sizeof(V)) != 0 ) return false;
+
+      shape  [i] = static_cast<size_t>(buf.shape()[i]);
+      strides[i] = static_cast<ptrdiff_t>(buf.strides()[i] / static_cast<ssize_t>(sizeof(V)));
+    }
+
+    // - all checks passed : map the data
+    value = Arr::Map(const_cast<V*>(buf.data()), shape, strides);
+    mBuf  = buf;
+
+    // - signal successful variable creation
+    return true;
+  }
+
+public:
+
+  // Python -> C++
+  // -------------
+
+  bool load(py::handle src, bool convert)
+  {
+    // - no copy : the data-type matches (arbitrary strides)
+    if ( py::array_t<V>::check_(src) )
+      if ( map(py::reinterpret_borrow<py::array_t<V>>(src)) )
+        return true;
+
+    // - copy : only for a read-only view (modifications of a copy would be lost without notice)
+    if ( !convert or !std::is_const<X>::value ) return false;
+
+    // - storage requirements : contiguous and row-major storage from NumPy
+    auto buf = py::array_t<V, py::array::c_style | py::array::forcecast>::ensure(src);
+    // - check
+    if ( !buf ) return false;
+
+    return map(buf);
+  }
+
+  // C++ -> Python
+  // -------------
+
+  static py::handle cast(const cppmat::view::strided<X>& src,
+    py::return_value_policy policy, py::handle parent)
+  {
+    // - strides in bytes
+    std::vector<ptrdiff_t> strides = src.strides();
+    // - convert
+    for ( auto &i : strides ) i *= static_cast<ptrdiff_t>(sizeof(V));
+
+    return cppmat::Private::numpy_view(src.shape(), strides, src.data(), policy, parent);
+  }
+};
+
+// =================================================================================================
+
+}} // namespace pybind11::detail
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,83 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_PRIVATE_PYBIND11_HPP
+#define CPPMAT_PRIVATE_PYBIND11_HPP
+
+#include "pybind11.h"
+
+namespace py = pybind11;
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// ownership of the data of a NumPy-array that is returned from C++ (see "docs/python.rst"):
+// - temporary (e.g. returned by value) : moved to the heap and owned by the NumPy-array
+// - "reference_internal"               : view, kept alive by the parent (e.g. a member of a class)
+// - "reference"                        : view, the lifetime is the responsibility of the C++ side
+// - otherwise                          : copy
+// =================================================================================================
+
+// no copy: the object is moved to the heap, it is deleted by the capsule that is the base of the
+// NumPy-array (i.e. when the NumPy-array is garbage collected)
+template<class C>
+inline
+py::handle numpy_capsule(C src)
+{
+  C *ptr = new C(std::move(src));
+
+  py::capsule base(ptr, [](void *p) { delete reinterpret_cast<C*>(p); });
+
+  py::array a(ptr->shape(), ptr->strides(true), ptr->data(), base);
+
+  return a.release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// no copy only for "reference" and "reference_internal", copy otherwise
+// N.B. "strides" in bytes
+template<class X, class Shape, class Strides>
+inline
+py::handle numpy_view(const Shape &shape, const Strides &strides, const X *data,
+  py::return_value_policy policy, py::handle parent)
+{
+  // - view, the parent keeps the data alive
+  if ( policy == py::return_value_policy::reference_internal )
+  {
+    py::array a(shape, strides, data, parent);
+    return a.release();
+  }
+
+  // - view without owner ("None" as base: a null-handle would make pybind11 copy)
+  if ( policy == py::return_value_policy::reference )
+  {
+    py::array a(shape, strides, data, py::none());
+    return a.release();
+  }
+
+  // - copy
+  py::array a(shape, strides, data);
+  return a.release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class C>
+inline
+py::handle numpy_view(const C &src, py::return_value_policy policy, py::handle parent)
+{
+  return numpy_view(src.shape(), src.strides(true), src.data(), policy, parent);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
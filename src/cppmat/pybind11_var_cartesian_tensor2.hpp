@@ -59,14 +59,18 @@ public:
   // C++ -> Python
   // -------------
 
-  static py::handle cast(const cppmat::cartesian::tensor2<X>& src,
+  // - temporary (e.g. returned by value) : no copy, the NumPy-array takes ownership of the data
+  static py::handle cast(cppmat::cartesian::tensor2<X>&& src,
     py::return_value_policy, py::handle)
   {
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(src.shape()), std::move(src.strides(true)), src.data());
+    return cppmat::Private::numpy_capsule(std::move(src));
+  }
 
-    // - release variable to Python
-    return a.release();
+  // - reference : copy, or no copy for "py::return_value_policy::reference(_internal)"
+  static py::handle cast(const cppmat::cartesian::tensor2<X>& src,
+    py::return_value_policy policy, py::handle parent)
+  {
+    return cppmat::Private::numpy_view(src, policy, parent);
   }
 };
 
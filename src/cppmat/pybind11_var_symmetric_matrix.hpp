@@ -62,11 +62,8 @@ public:
     // - convert to dense matrix
     cppmat::matrix<X> tmp = src;
 
-    // - create Python variable (all variables are copied)
-    py::array a(std::move(tmp.shape()), std::move(tmp.strides(true)), tmp.data());
-
-    // - release variable to Python
-    return a.release();
+    // - the NumPy-array takes ownership of the dense copy (no second copy)
+    return cppmat::Private::numpy_capsule(std::move(tmp));
   }
 };
 
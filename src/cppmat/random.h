@@ -0,0 +1,115 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_RANDOM_H
+#define CPPMAT_RANDOM_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace random {
+
+// =================================================================================================
+// cppmat::random::engine - counter-based random number generator
+// - the "i"-th number of a stream is a function of only "(seed, stream, i)" (a SplitMix64-style
+//   hash of the counter), whereby any part of a stream can be generated directly
+// - an array is filled in parallel: entry "j" uses counter "counter()+j", the result therefore does
+//   not depend on the number of threads
+// - it satisfies the requirements of a "UniformRandomBitGenerator", i.e. it can also be used with
+//   the distributions of the standard library (whose output is implementation defined)
+// =================================================================================================
+
+class engine
+{
+public:
+
+  typedef uint64_t result_type;
+
+private:
+
+  uint64_t mKey;       // key derived from the seed
+  uint64_t mStream;    // key derived from the stream number
+  uint64_t mCounter=0; // position in the stream
+
+  // number from a distribution using counter "i" (and "i+1" for "normal")
+  template<typename X> X uniformAt(uint64_t i, X lower, X upper) const;
+  template<typename X> X normalAt (uint64_t i, X mean , X sd   ) const;
+  template<typename X> X integerAt(uint64_t i, X lower, X upper) const;
+
+public:
+
+  // constructor: (independent) stream "stream" of seed "seed", starting at "counter"
+  engine(uint64_t seed=0, uint64_t stream=0, uint64_t counter=0);
+
+  // (re)initialize
+  void seed(uint64_t seed, uint64_t stream=0, uint64_t counter=0);
+
+  // position in the stream
+  uint64_t counter() const;
+  void     setCounter(uint64_t counter);
+  void     discard(uint64_t n);
+
+  // range of the generated numbers
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  // number "i" of the stream (the counter is not changed)
+  result_type at(uint64_t i) const;
+
+  // next number (advances the counter by one)
+  result_type operator()();
+
+  // next number from a distribution (advances the counter by one, or two for "normal")
+  // - "uniform" : in "[lower, upper)"
+  // - "normal"  : normal distribution with mean "mean" and standard deviation "sd"
+  // - "integer" : in "[lower, upper]" (both bounds included)
+  template<typename X> X uniform(X lower=(X)0, X upper=(X)1);
+  template<typename X> X normal (X mean =(X)0, X sd   =(X)1);
+  template<typename X> X integer(X lower, X upper);
+
+  // fill "[first, last)" in parallel (advances the counter by "last-first", or twice that for
+  // "normal"), see above for the distributions
+  template<class Iterator, typename X=typename std::iterator_traits<Iterator>::value_type>
+  void fillUniform(Iterator first, Iterator last, X lower=(X)0, X upper=(X)1);
+
+  template<class Iterator, typename X=typename std::iterator_traits<Iterator>::value_type>
+  void fillNormal(Iterator first, Iterator last, X mean=(X)0, X sd=(X)1);
+
+  template<class Iterator, typename X>
+  void fillInteger(Iterator first, Iterator last, X lower, X upper);
+
+};
+
+// =================================================================================================
+// global generator, used by "Random()" and "setRandom()" of all classes:
+// - by default seeded once (non-deterministically) at the first use
+// - "seed(...)" makes all subsequent calls reproducible
+// - each call reserves its own part of the stream, also if called concurrently
+// =================================================================================================
+
+void seed(uint64_t seed);
+
+// fill "[first, last)" in parallel, using the global generator
+template<class Iterator, typename X=typename std::iterator_traits<Iterator>::value_type>
+void fillUniform(Iterator first, Iterator last, X lower=(X)0, X upper=(X)1);
+
+template<class Iterator, typename X=typename std::iterator_traits<Iterator>::value_type>
+void fillNormal(Iterator first, Iterator last, X mean=(X)0, X sd=(X)1);
+
+template<class Iterator, typename X>
+void fillInteger(Iterator first, Iterator last, X lower, X upper);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,388 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_RANDOM_HPP
+#define CPPMAT_RANDOM_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "random.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// SplitMix64: increment of the state, and the mixing function (a bijection of 64-bit integers)
+// =================================================================================================
+
+static const uint64_t random_gamma = 0x9E3779B97F4A7C15ull;
+
+inline uint64_t random_mix(uint64_t z)
+{
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+  return z ^ (z >> 31);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// floating point type in which a distribution is evaluated ("double" for an integer type)
+template<typename X>
+struct random_real
+{
+  typedef typename std::conditional<std::is_floating_point<X>::value, X, double>::type type;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+// uniformly distributed in "[0, 1)", using as many bits as the precision of "R"
+template<typename R>
+inline R random_unit(uint64_t x)
+{
+  const int d = std::min(std::numeric_limits<R>::digits, 64);
+
+  return static_cast<R>(x >> (64-d)) * std::ldexp(static_cast<R>(1), -d);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// uniformly distributed in "[lower, upper)"
+// N.B. "lower + (upper - lower) * u" may round to "upper" (although "u < 1"), it is then replaced
+//      by the largest value below "upper"
+template<typename R>
+inline R random_uniform(uint64_t x, R lower, R upper)
+{
+  R out = lower + ( upper - lower ) * random_unit<R>(x);
+
+  if ( out >= upper and lower < upper ) return std::nextafter(upper, lower);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// uniformly distributed in "[0, n)" (a fraction "n / 2^64" of the range is slightly more likely
+// if the 128-bit multiplication is not available)
+inline uint64_t random_below(uint64_t x, uint64_t n)
+{
+#ifdef __SIZEOF_INT128__
+  __extension__ typedef unsigned __int128 uint128;
+  return static_cast<uint64_t>((static_cast<uint128>(x) * n) >> 64);
+#else
+  return x % n;
+#endif
+}
+
+// =================================================================================================
+// storage of the global generator (one instance for the entire program)
+// =================================================================================================
+
+inline std::atomic<uint64_t>& random_global_seed()
+{
+  static std::atomic<uint64_t> seed( [] () {
+    std::random_device rd;
+    return ( static_cast<uint64_t>(rd()) << 32 ) ^ static_cast<uint64_t>(rd());
+  }() );
+
+  return seed;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline std::atomic<uint64_t>& random_global_counter()
+{
+  static std::atomic<uint64_t> counter(0);
+
+  return counter;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// generator positioned at the start of "n" numbers of the global stream, that are reserved for
+// the caller
+inline cppmat::random::engine random_global(uint64_t n)
+{
+  uint64_t seed    = random_global_seed().load();
+  uint64_t counter = random_global_counter().fetch_add(n);
+
+  return cppmat::random::engine(seed, 0, counter);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace random {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+inline
+engine::engine(uint64_t seed, uint64_t stream, uint64_t counter)
+{
+  this->seed(seed, stream, counter);
+}
+
+// =================================================================================================
+// (re)initialize
+// =================================================================================================
+
+inline
+void engine::seed(uint64_t seed, uint64_t stream, uint64_t counter)
+{
+  mKey     = cppmat::Private::random_mix(seed);
+  mStream  = cppmat::Private::random_mix(cppmat::Private::random_mix(stream) + cppmat::Private::random_gamma);
+  mCounter = counter;
+}
+
+// =================================================================================================
+// position in the stream
+// =================================================================================================
+
+inline
+uint64_t engine::counter() const
+{
+  return mCounter;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void engine::setCounter(uint64_t counter)
+{
+  mCounter = counter;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+void engine::discard(uint64_t n)
+{
+  mCounter += n;
+}
+
+// =================================================================================================
+// random numbers
+// =================================================================================================
+
+inline
+engine::result_type engine::at(uint64_t i) const
+{
+  // the second round with the key of the stream makes streams of the same seed independent (in
+  // a single round they would be shifted copies of each other)
+  return cppmat::Private::random_mix(
+    cppmat::Private::random_mix(mKey + (i+1) * cppmat::Private::random_gamma) ^ mStream);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline
+engine::result_type engine::operator()()
+{
+  return at(mCounter++);
+}
+
+// =================================================================================================
+// distributions
+// =================================================================================================
+
+template<typename X>
+inline
+X engine::uniformAt(uint64_t i, X lower, X upper) const
+{
+  typedef typename cppmat::Private::random_real<X>::type R;
+
+  return static_cast<X>(
+    cppmat::Private::random_uniform<R>(at(i), static_cast<R>(lower), static_cast<R>(upper)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X engine::normalAt(uint64_t i, X mean, X sd) const
+{
+  typedef typename cppmat::Private::random_real<X>::type R;
+
+  // Box-Muller transform, with "u1" in "(0, 1]" to avoid "log(0)"
+  R u1 = static_cast<R>(1) - cppmat::Private::random_unit<R>(at(i  ));
+  R u2 =                     cppmat::Private::random_unit<R>(at(i+1));
+
+  R z = std::sqrt( static_cast<R>(-2) * std::log(u1) ) *
+        std::cos ( static_cast<R>(2) * static_cast<R>(3.14159265358979323846) * u2 );
+
+  return static_cast<X>( static_cast<R>(mean) + static_cast<R>(sd) * z );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X engine::integerAt(uint64_t i, X lower, X upper) const
+{
+  static_assert( std::is_integral<X>::value, "Only for integer types" );
+
+  Assert( lower <= upper );
+
+  // number of possible values (as unsigned integer; "0" if the full 64-bit range is requested)
+  uint64_t n = static_cast<uint64_t>(upper) - static_cast<uint64_t>(lower) + 1;
+
+  if ( n == 0 )
+    return static_cast<X>(at(i));
+
+  return static_cast<X>( static_cast<uint64_t>(lower) + cppmat::Private::random_below(at(i), n) );
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X engine::uniform(X lower, X upper)
+{
+  X out = uniformAt(mCounter, lower, upper);
+
+  mCounter += 1;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X engine::normal(X mean, X sd)
+{
+  X out = normalAt(mCounter, mean, sd);
+
+  mCounter += 2;
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X engine::integer(X lower, X upper)
+{
+  X out = integerAt(mCounter, lower, upper);
+
+  mCounter += 1;
+
+  return out;
+}
+
+// =================================================================================================
+// fill (in parallel)
+// =================================================================================================
+
+template<class Iterator, typename X>
+inline
+void engine::fillUniform(Iterator first, Iterator last, X lower, X upper)
+{
+  size_t   n = static_cast<size_t>(last - first);
+  uint64_t c = mCounter;
+
+  cppmat::Private::parallel_for(n, [this,first,c,lower,upper](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      first[i] = uniformAt(c+i, lower, upper);
+  });
+
+  mCounter += n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator, typename X>
+inline
+void engine::fillNormal(Iterator first, Iterator last, X mean, X sd)
+{
+  size_t   n = static_cast<size_t>(last - first);
+  uint64_t c = mCounter;
+
+  cppmat::Private::parallel_for(n, [this,first,c,mean,sd](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      first[i] = normalAt(c+2*i, mean, sd);
+  });
+
+  mCounter += 2*n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator, typename X>
+inline
+void engine::fillInteger(Iterator first, Iterator last, X lower, X upper)
+{
+  size_t   n = static_cast<size_t>(last - first);
+  uint64_t c = mCounter;
+
+  cppmat::Private::parallel_for(n, [this,first,c,lower,upper](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      first[i] = integerAt(c+i, lower, upper);
+  });
+
+  mCounter += n;
+}
+
+// =================================================================================================
+// global generator
+// =================================================================================================
+
+inline
+void seed(uint64_t seed)
+{
+  cppmat::Private::random_global_seed   ().store(seed);
+  cppmat::Private::random_global_counter().store(0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator, typename X>
+inline
+void fillUniform(Iterator first, Iterator last, X lower, X upper)
+{
+  engine rng = cppmat::Private::random_global(static_cast<uint64_t>(last - first));
+
+  rng.fillUniform(first, last, lower, upper);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator, typename X>
+inline
+void fillNormal(Iterator first, Iterator last, X mean, X sd)
+{
+  engine rng = cppmat::Private::random_global(2 * static_cast<uint64_t>(last - first));
+
+  rng.fillNormal(first, last, mean, sd);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class Iterator, typename X>
+inline
+void fillInteger(Iterator first, Iterator last, X lower, X upper)
+{
+  engine rng = cppmat::Private::random_global(static_cast<uint64_t>(last - first));
+
+  rng.fillInteger(first, last, lower, upper);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
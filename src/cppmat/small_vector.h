@@ -0,0 +1,175 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_SMALL_VECTOR_H
+#define CPPMAT_SMALL_VECTOR_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// inline storage of "cppmat::small_vector"
+// - "N > 0": storage of "N" entries inside the object (not initialized)
+// - "N == 0": reference to the inline storage of another object (e.g. of a derived class, see
+//   "cppmat::cartesian::tensor2")
+// - a copy of "N > 0" does not copy the entries, these are managed by "small_vector" (which also
+//   does not pass on the reference of "N == 0" when it is copied)
+// =================================================================================================
+
+template<typename X, size_t N>
+class inline_buffer
+{
+private:
+
+  // the storage is not aligned to "CPPMAT_ALIGN" (which would make the classes over-aligned)
+  alignas(std::max_align_t) alignas(X) unsigned char mData[N*sizeof(X)];
+
+public:
+
+  inline_buffer() {}
+  inline_buffer(const inline_buffer &) {}
+  inline_buffer& operator=(const inline_buffer &) { return *this; }
+
+  X*       data()       { return reinterpret_cast<X*>(mData); }
+  const X* data() const { return reinterpret_cast<const X*>(mData); }
+  size_t   size() const { return N; }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+class inline_buffer<X,0>
+{
+private:
+
+  X      *mData=nullptr;
+  size_t  mSize=0;
+
+public:
+
+  inline_buffer() = default;
+
+  // refer to "n" entries at "data"
+  inline_buffer(X *data, size_t n) : mData(data), mSize(n) {}
+
+  // refer to the inline storage "B"
+  template<size_t N, typename=typename std::enable_if<(N>0)>::type>
+  inline_buffer(inline_buffer<X,N> &B) : mData(B.data()), mSize(N) {}
+
+  X*       data()       { return mData; }
+  const X* data() const { return mData; }
+  size_t   size() const { return mSize; }
+};
+
+// =================================================================================================
+
+} // namespace ...
+
+// =================================================================================================
+// cppmat::small_vector - contiguous storage that keeps up to "N" entries inside the object, and
+// only allocates (using "Allocator") for more entries
+// - used as data container of the dynamically sized classes: a small tensor (e.g. a 3-d
+//   "cppmat::cartesian::tensor4") does not allocate at all
+// - "N == 0": the inline storage is provided by the enclosing object (see constructor), this allows
+//   each class that derives from "cppmat::array" to choose its own inline capacity; a copy or a move
+//   does not take over that storage
+// - the inline storage is not aligned to "CPPMAT_ALIGN" (which would make the classes over-aligned),
+//   only allocated storage is
+// - the entries are copied as plain memory: "X" must be trivially copyable
+// - a move of inline storage copies the entries, a move of allocated storage takes the pointer
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator=cppmat::aligned_allocator<X>>
+class small_vector
+{
+  static_assert( std::is_trivially_copyable<X>::value, "small_vector: the entries must be trivially copyable" );
+
+private:
+
+  Private::inline_buffer<X,N> mBuffer;   // inline storage
+  X                          *mPtr;      // storage: "mBuffer", or allocated
+  size_t                      mSize=0;   // number of entries
+  size_t                      mCapacity; // number of entries that fit in the storage
+
+  // pointer to the inline storage
+  X*       buffer();
+  const X* buffer() const;
+
+  // move the storage to "n" allocated entries (keeping the current entries)
+  void grow(size_t n);
+
+  // return allocated storage
+  void release();
+
+public:
+
+  typedef X        value_type;
+  typedef X*       iterator;
+  typedef const X* const_iterator;
+
+  // constructor: empty, "n" (zero-initialized) entries, or "n" entries equal to "D"
+  small_vector();
+  small_vector(size_t n);
+  small_vector(size_t n, const X &D);
+
+  // constructor: empty, using the inline storage "buffer" of the enclosing object (only "N == 0")
+  small_vector(Private::inline_buffer<X,0> buffer);
+
+  // copy/move
+  small_vector(const small_vector &A);
+  small_vector(small_vector &&A) noexcept;
+  small_vector& operator=(const small_vector &A);
+  small_vector& operator=(small_vector &&A) noexcept;
+
+  // destructor: return allocated storage
+  ~small_vector();
+
+  // size and capacity
+  size_t size() const;
+  size_t capacity() const;
+  bool   empty() const;
+
+  // true if the entries are stored inside the object
+  bool is_inline() const;
+
+  // resize: new entries are zero-initialized, or equal to "D"
+  void resize(size_t n);
+  void resize(size_t n, const X &D);
+
+  // extend
+  void reserve(size_t n);
+  void push_back(const X &value);
+  template<class Iterator> X* insert(const X *pos, Iterator first, Iterator last);
+  void clear();
+
+  // index operator
+  X&       operator[](size_t i);
+  const X& operator[](size_t i) const;
+
+  // pointer to data
+  X*       data();
+  const X* data() const;
+
+  // iterators
+  X*       begin();
+  const X* begin() const;
+  X*       end();
+  const X* end() const;
+};
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,390 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_SMALL_VECTOR_HPP
+#define CPPMAT_SMALL_VECTOR_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+
+// =================================================================================================
+// storage management
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+X* small_vector<X,N,Allocator>::buffer()
+{
+  return mBuffer.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+const X* small_vector<X,N,Allocator>::buffer() const
+{
+  return mBuffer.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::grow(size_t n)
+{
+  X *ptr = Allocator().allocate(n);
+
+  std::copy(mPtr, mPtr+mSize, ptr);
+
+  release();
+
+  mPtr      = ptr;
+  mCapacity = n;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::release()
+{
+  if ( mPtr != buffer() ) Allocator().deallocate(mPtr, mCapacity);
+
+  mPtr      = buffer();
+  mCapacity = mBuffer.size();
+}
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::small_vector() : mPtr(buffer()), mCapacity(mBuffer.size())
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::small_vector(size_t n) : mPtr(buffer()), mCapacity(mBuffer.size())
+{
+  resize(n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::small_vector(size_t n, const X &D) : mPtr(buffer()), mCapacity(mBuffer.size())
+{
+  resize(n, D);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::small_vector(Private::inline_buffer<X,0> buffer) :
+  mBuffer(buffer.data(), buffer.size()), mPtr(buffer.data()), mCapacity(buffer.size())
+{
+  static_assert( N == 0, "small_vector: only the inline storage of the enclosing object can be set" );
+}
+
+// =================================================================================================
+// copy/move
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::small_vector(const small_vector &A) : mPtr(buffer()), mCapacity(mBuffer.size())
+{
+  if ( A.mSize > mCapacity ) grow(A.mSize);
+
+  std::copy(A.begin(), A.end(), mPtr);
+
+  mSize = A.mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::small_vector(small_vector &&A) noexcept : mPtr(buffer()), mCapacity(mBuffer.size())
+{
+  *this = std::move(A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>& small_vector<X,N,Allocator>::operator=(const small_vector &A)
+{
+  if ( this == &A ) return *this;
+
+  // allocate, the current entries need not be kept
+  if ( A.mSize > mCapacity ) { mSize = 0; grow(A.mSize); }
+
+  std::copy(A.begin(), A.end(), mPtr);
+
+  mSize = A.mSize;
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>& small_vector<X,N,Allocator>::operator=(small_vector &&A) noexcept
+{
+  if ( this == &A ) return *this;
+
+  // inline: copy the entries (allocate if they do not fit, the current entries need not be kept)
+  if ( A.is_inline() )
+  {
+    if ( A.mSize > mCapacity ) { mSize = 0; grow(A.mSize); }
+    std::copy(A.begin(), A.end(), mPtr);
+    mSize = A.mSize;
+  }
+  // allocated: take the storage
+  else
+  {
+    release();
+    mPtr        = A.mPtr;
+    mSize       = A.mSize;
+    mCapacity   = A.mCapacity;
+    A.mPtr      = A.buffer();
+    A.mCapacity = A.mBuffer.size();
+  }
+
+  A.mSize = 0;
+
+  return *this;
+}
+
+// =================================================================================================
+// destructor
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+small_vector<X,N,Allocator>::~small_vector()
+{
+  release();
+}
+
+// =================================================================================================
+// size and capacity
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+size_t small_vector<X,N,Allocator>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+size_t small_vector<X,N,Allocator>::capacity() const
+{
+  return mCapacity;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+bool small_vector<X,N,Allocator>::empty() const
+{
+  return mSize == 0;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+bool small_vector<X,N,Allocator>::is_inline() const
+{
+  return mPtr == buffer();
+}
+
+// =================================================================================================
+// resize
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::resize(size_t n)
+{
+  resize(n, X());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::resize(size_t n, const X &D)
+{
+  if ( n > mCapacity ) grow(n);
+
+  if ( n > mSize ) std::fill(mPtr+mSize, mPtr+n, D);
+
+  mSize = n;
+}
+
+// =================================================================================================
+// extend
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::reserve(size_t n)
+{
+  if ( n > mCapacity ) grow(n);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::push_back(const X &value)
+{
+  // copy first: "value" may refer to an entry
+  X tmp = value;
+
+  if ( mSize == mCapacity ) grow(std::max(2*mCapacity, size_t(1)));
+
+  mPtr[mSize++] = tmp;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+template<class Iterator>
+inline
+X* small_vector<X,N,Allocator>::insert(const X *pos, Iterator first, Iterator last)
+{
+  Assert( pos >= begin() and pos <= end() );
+
+  size_t i = static_cast<size_t>(pos - mPtr);
+  size_t n = static_cast<size_t>(std::distance(first, last));
+
+  if ( mSize + n > mCapacity ) grow(std::max(mSize + n, 2*mCapacity));
+
+  std::copy_backward(mPtr+i, mPtr+mSize, mPtr+mSize+n);
+  std::copy(first, last, mPtr+i);
+
+  mSize += n;
+
+  return mPtr+i;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+void small_vector<X,N,Allocator>::clear()
+{
+  mSize = 0;
+}
+
+// =================================================================================================
+// index operator
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+X& small_vector<X,N,Allocator>::operator[](size_t i)
+{
+  return mPtr[i];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+const X& small_vector<X,N,Allocator>::operator[](size_t i) const
+{
+  return mPtr[i];
+}
+
+// =================================================================================================
+// pointer to data
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+X* small_vector<X,N,Allocator>::data()
+{
+  return mPtr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+const X* small_vector<X,N,Allocator>::data() const
+{
+  return mPtr;
+}
+
+// =================================================================================================
+// iterators
+// =================================================================================================
+
+template<typename X, size_t N, class Allocator>
+inline
+X* small_vector<X,N,Allocator>::begin()
+{
+  return mPtr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+const X* small_vector<X,N,Allocator>::begin() const
+{
+  return mPtr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+X* small_vector<X,N,Allocator>::end()
+{
+  return mPtr + mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t N, class Allocator>
+inline
+const X* small_vector<X,N,Allocator>::end() const
+{
+  return mPtr + mSize;
+}
+
+// =================================================================================================
+
+} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
@@ -22,7 +22,7 @@ template<typename X> std::vector<X> del(const std::vector<X> &A, int    idx);
 template<typename X> std::vector<X> del(const std::vector<X> &A, size_t idx);
 
 // return the indices that would sort the vector
-template <typename X> std::vector<size_t> argsort(const std::vector<X> &v, bool ascending=true);
+template <typename X, class A> std::vector<size_t> argsort(const std::vector<X,A> &v, bool ascending=true);
 
 // convert vector items to string, and join these string together using the "join" string
 template<typename X> std::string to_string(const std::vector<X> &A, std::string join=", ");
@@ -58,9 +58,9 @@ std::vector<X> del(const std::vector<X> &A, size_t idx)
 // return the indices that would sort the vector
 // =================================================================================================
 
-template <typename X>
+template <typename X, class A>
 inline
-std::vector<size_t> argsort(const std::vector<X> &v, bool ascending)
+std::vector<size_t> argsort(const std::vector<X,A> &v, bool ascending)
 {
   // initialize original index locations
   // - allocate
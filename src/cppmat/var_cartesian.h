@@ -69,6 +69,20 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+cppmat::cartesian::tensor2s<X> ddot(
+  const cppmat::cartesian::tensor4s<X> &A, const cppmat::cartesian::tensor2s<X> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4s<X> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 X ddot(
   const cppmat::cartesian::tensor2<X> &A, const cppmat::cartesian::tensor2<X> &B
@@ -388,6 +402,71 @@ cppmat::cartesian::tensor2<X> inv(const cppmat::cartesian::tensor2<X> &A);
 template<typename X>
 cppmat::cartesian::tensor2d<X> inv(const cppmat::cartesian::tensor2d<X> &A);
 
+// =================================================================================================
+// eigen-decomposition: "A = vec * diag(val) * vec^T", with the eigenvalues "val" in ascending order
+// and the (orthonormal) eigenvectors the columns of "vec" (closed-form in 2-D and 3-D)
+// =================================================================================================
+
+template<typename X>
+void eig(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::vector<X> &val, cppmat::cartesian::tensor2<X> &vec
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::vector<X> eigenvalues(const cppmat::cartesian::tensor2s<X> &A);
+
+// =================================================================================================
+// isotropic tensor functions: "F(A) = vec * diag(f(val)) * vec^T" (see "eig"), optionally with the
+// derivative "dFdA = dF/dA" (with minor and major symmetry, for consistent tangents)
+// - "log" and "pow" require "A" to be positive definite, "sqrt" positive semi-definite (but with
+//   an infinite derivative for a zero eigenvalue); otherwise "std::domain_error" is thrown
+// =================================================================================================
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> log(const cppmat::cartesian::tensor2s<X> &A);
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> log(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::tensor4<X> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> exp(const cppmat::cartesian::tensor2s<X> &A);
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> exp(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::tensor4<X> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> sqrt(const cppmat::cartesian::tensor2s<X> &A);
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> sqrt(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::tensor4<X> &dFdA
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> pow(const cppmat::cartesian::tensor2s<X> &A, X p);
+
+template<typename X>
+cppmat::cartesian::tensor2s<X> pow(
+  const cppmat::cartesian::tensor2s<X> &A, X p,
+  cppmat::cartesian::tensor4<X> &dFdA
+);
+
 // =================================================================================================
 // miscellaneous tensor operations
 // =================================================================================================
@@ -29,16 +29,19 @@ cppmat::cartesian::tensor4<X> ddot(
   Assert( A.ndim() == B.ndim() );
 
   size_t ND = A.ndim();
+  size_t N2 = ND*ND;
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  cppmat::cartesian::tensor4<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          for ( size_t m = 0 ; m < ND ; ++m )
-            for ( size_t n = 0 ; n < ND ; ++n )
-              C(i,j,m,n) += A(i,j,k,l) * B(l,k,m,n);
+  // C_ijmn = A_ijkl * B_lkmn: the product of the (ND^2 x ND^2) unfoldings "A_(ij)(kl)" and
+  // "B_(kl)(mn)", after swapping the first two indices of "B" (i.e. permuting its rows)
+  std::vector<X> Bp(N2*N2);
+
+  for ( size_t k = 0 ; k < ND ; ++k )
+    for ( size_t l = 0 ; l < ND ; ++l )
+      std::copy(B.data()+(l*ND+k)*N2, B.data()+(l*ND+k+1)*N2, Bp.begin()+(k*ND+l)*N2);
+
+  cppmat::Private::gemm(N2, N2, N2, A.data(), Bp.data(), C.data());
 
   return C;
 }
@@ -55,13 +58,12 @@ cppmat::cartesian::tensor2<X> ddot(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j) += A(i,j,k,l) * B(l,k);
+  // C_ij = A_ijkl * B_lk: the product of the (ND^2 x ND^2) unfolding "A_(ij)(kl)" and "B^T"
+  cppmat::cartesian::tensor2<X> Bt = B.T();
+
+  cppmat::Private::gemv(ND*ND, ND*ND, A.data(), Bt.data(), C.data());
 
   return C;
 }
@@ -78,13 +80,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j) += A(i,j,k,l) * B(l,k);
+  // C_ij = A_ijkl * B_lk: the product of the (ND^2 x ND^2) unfolding "A_(ij)(kl)" and "B"
+  std::vector<X> b(ND*ND);
+
+  B.copyToDense(b.begin());
+
+  cppmat::Private::gemv(ND*ND, ND*ND, A.data(), b.data(), C.data());
 
   return C;
 }
@@ -123,13 +126,12 @@ cppmat::cartesian::tensor2<X> ddot(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(k,l) += A(i,j) * B(j,i,k,l);
+  // C_kl = A_ij * B_jikl: the product of "A^T" and the (ND^2 x ND^2) unfolding "B_(ji)(kl)"
+  cppmat::cartesian::tensor2<X> At = A.T();
+
+  cppmat::Private::gevm(ND*ND, ND*ND, At.data(), B.data(), C.data());
 
   return C;
 }
@@ -146,13 +148,14 @@ cppmat::cartesian::tensor2<X> ddot(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor2<X> C = cppmat::cartesian::tensor2<X>::Zero(ND);
+  cppmat::cartesian::tensor2<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(k,l) += A(i,j) * B(j,i,k,l);
+  // C_kl = A_ij * B_jikl: the product of "A" and the (ND^2 x ND^2) unfolding "B_(ji)(kl)"
+  std::vector<X> a(ND*ND);
+
+  A.copyToDense(a.begin());
+
+  cppmat::Private::gevm(ND*ND, ND*ND, a.data(), B.data(), C.data());
 
   return C;
 }
@@ -181,6 +184,41 @@ cppmat::cartesian::tensor2<X> ddot(
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> ddot(
+  const cppmat::cartesian::tensor4s<X> &A, const cppmat::cartesian::tensor2s<X> &B
+)
+{
+  Assert( A.ndim() == B.ndim() );
+
+  cppmat::cartesian::tensor2s<X> C(A.ndim());
+
+  cppmat::Private::mandel_ddot(A.ndim(), A.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> ddot(
+  const cppmat::cartesian::tensor2s<X> &A, const cppmat::cartesian::tensor4s<X> &B
+)
+{
+  Assert( A.ndim() == B.ndim() );
+
+  // C_kl = A_ij * B_jikl = B_klji * A_ij (major symmetry)
+  cppmat::cartesian::tensor2s<X> C(A.ndim());
+
+  cppmat::Private::mandel_ddot(A.ndim(), B.data(), A.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 inline
 X ddot(
@@ -718,13 +756,10 @@ cppmat::cartesian::tensor4<X> dyadic(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  cppmat::cartesian::tensor4<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,k,l) += A(i,j) * B(k,l);
+  // C_ijkl = A_ij * B_kl: the outer product of "A_(ij)" and "B_(kl)"
+  cppmat::Private::outer(ND*ND, ND*ND, A.data(), B.data(), C.data());
 
   return C;
 }
@@ -741,13 +776,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  cppmat::cartesian::tensor4<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,k,l) += A(i,j) * B(k,l);
+  // C_ijkl = A_ij * B_kl: the outer product of "A_(ij)" and "B_(kl)"
+  std::vector<X> b(ND*ND);
+
+  B.copyToDense(b.begin());
+
+  cppmat::Private::outer(ND*ND, ND*ND, A.data(), b.data(), C.data());
 
   return C;
 }
@@ -786,13 +822,14 @@ cppmat::cartesian::tensor4<X> dyadic(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  cppmat::cartesian::tensor4<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,k,l) += A(i,j) * B(k,l);
+  // C_ijkl = A_ij * B_kl: the outer product of "A_(ij)" and "B_(kl)"
+  std::vector<X> a(ND*ND);
+
+  A.copyToDense(a.begin());
+
+  cppmat::Private::outer(ND*ND, ND*ND, a.data(), B.data(), C.data());
 
   return C;
 }
@@ -809,13 +846,15 @@ cppmat::cartesian::tensor4<X> dyadic(
 
   size_t ND = A.ndim();
 
-  cppmat::cartesian::tensor4<X> C = cppmat::cartesian::tensor4<X>::Zero(ND);
+  cppmat::cartesian::tensor4<X> C(ND);
 
-  for ( size_t i = 0 ; i < ND ; ++i )
-    for ( size_t j = 0 ; j < ND ; ++j )
-      for ( size_t k = 0 ; k < ND ; ++k )
-        for ( size_t l = 0 ; l < ND ; ++l )
-          C(i,j,k,l) += A(i,j) * B(k,l);
+  // C_ijkl = A_ij * B_kl: the outer product of "A_(ij)" and "B_(kl)"
+  std::vector<X> a(ND*ND), b(ND*ND);
+
+  A.copyToDense(a.begin());
+  B.copyToDense(b.begin());
+
+  cppmat::Private::outer(ND*ND, ND*ND, a.data(), b.data(), C.data());
 
   return C;
 }
@@ -1257,6 +1296,202 @@ cppmat::cartesian::tensor2d<X> inv(const cppmat::cartesian::tensor2d<X> &A)
   return C;
 }
 
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+template<typename X>
+inline
+void eig(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::vector<X> &val, cppmat::cartesian::tensor2<X> &vec
+)
+{
+  size_t nd = A.ndim();
+
+  val.resize(nd);
+  vec.resize(nd);
+
+  cppmat::Private::eig_sym(nd, A.data(), val.data(), vec.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::vector<X> eigenvalues(const cppmat::cartesian::tensor2s<X> &A)
+{
+  cppmat::cartesian::vector<X> val(A.ndim());
+
+  cppmat::Private::eig_sym(A.ndim(), A.data(), val.data(), static_cast<X*>(nullptr));
+
+  return val;
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> log(const cppmat::cartesian::tensor2s<X> &A)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  cppmat::Private::isotropic_log<X> func;
+
+  if ( not cppmat::Private::isotropic(nd, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> log(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::tensor4<X> &dFdA
+)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  dFdA.resize(nd);
+
+  cppmat::Private::isotropic_log<X> func;
+
+  if ( not cppmat::Private::isotropic(nd, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> exp(const cppmat::cartesian::tensor2s<X> &A)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic(nd, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> exp(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::tensor4<X> &dFdA
+)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  dFdA.resize(nd);
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic(nd, A.data(), F.data(), dFdA.data(), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> sqrt(const cppmat::cartesian::tensor2s<X> &A)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  if ( not cppmat::Private::isotropic(nd, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> sqrt(
+  const cppmat::cartesian::tensor2s<X> &A,
+  cppmat::cartesian::tensor4<X> &dFdA
+)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  dFdA.resize(nd);
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  if ( not cppmat::Private::isotropic(nd, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> pow(const cppmat::cartesian::tensor2s<X> &A, X p)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  if ( not cppmat::Private::isotropic(nd, A.data(), F.data(), static_cast<X*>(nullptr), func) )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::cartesian::tensor2s<X> pow(
+  const cppmat::cartesian::tensor2s<X> &A, X p,
+  cppmat::cartesian::tensor4<X> &dFdA
+)
+{
+  size_t nd = A.ndim();
+
+  cppmat::cartesian::tensor2s<X> F(nd);
+
+  dFdA.resize(nd);
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  if ( not cppmat::Private::isotropic(nd, A.data(), F.data(), dFdA.data(), func) )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
 // =================================================================================================
 // miscellaneous tensor operations
 // =================================================================================================
@@ -0,0 +1,353 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_FIELD_H
+#define CPPMAT_VAR_CARTESIAN_FIELD_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// value-type and number of dimensions of a fixed size Cartesian tensor
+// =================================================================================================
+
+template<class T> struct tensor_traits;
+
+template<typename X, size_t ND> struct tensor_traits<cppmat::tiny::cartesian::tensor4<X,ND>>
+{ typedef X value_type; static const size_t ndim=ND; };
+
+template<typename X, size_t ND> struct tensor_traits<cppmat::tiny::cartesian::tensor2<X,ND>>
+{ typedef X value_type; static const size_t ndim=ND; };
+
+template<typename X, size_t ND> struct tensor_traits<cppmat::tiny::cartesian::tensor2s<X,ND>>
+{ typedef X value_type; static const size_t ndim=ND; };
+
+template<typename X, size_t ND> struct tensor_traits<cppmat::tiny::cartesian::tensor2d<X,ND>>
+{ typedef X value_type; static const size_t ndim=ND; };
+
+template<typename X, size_t ND> struct tensor_traits<cppmat::tiny::cartesian::vector<X,ND>>
+{ typedef X value_type; static const size_t ndim=ND; };
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+
+// =================================================================================================
+// storage order of a field
+// - AoS: "array of structures", the components of each tensor are stored contiguously
+// - SoA: "structure of arrays", each component is stored contiguously for all tensors
+// =================================================================================================
+
+enum class storage { AoS, SoA };
+
+// =================================================================================================
+// cppmat::cartesian::field - a number of fixed size tensors (e.g. one per integration point),
+// stored in one contiguous buffer
+// N.B. "T" is one of "cppmat::tiny::cartesian::{tensor4,tensor2,tensor2s,tensor2d,vector}<X,ND>"
+// =================================================================================================
+
+template<class T>
+class field
+{
+public:
+
+  typedef T                                                   tensor_type;
+  typedef typename cppmat::Private::tensor_traits<T>::value_type value_type;
+
+private:
+
+  typedef typename cppmat::Private::tensor_traits<T>::value_type X;
+  typedef cppmat::aligned_allocator<X> Allocator;
+
+protected:
+
+  size_t                   mSize=0;              // number of tensors
+  storage                  mLayout=storage::AoS; // storage order
+  std::vector<X,Allocator> mData;                // data container
+
+public:
+
+  // constructor: default
+  field() = default;
+
+  // constructor: allocate, don't initialize
+  field(size_t n, storage layout=storage::AoS);
+
+  // named constructor: initialize
+  static field<T> Zero    (size_t n, storage layout=storage::AoS);
+  static field<T> Constant(size_t n, const T &D, storage layout=storage::AoS);
+
+  // resize (the storage order is kept)
+  void resize(size_t n);
+
+  // get dimensions
+  size_t size() const;         // number of tensors
+  static size_t ncomp();       // number of (independent) components per tensor
+  static size_t ndim();        // number of dimensions of each tensor
+  storage layout() const;      // storage order
+
+  // copy with a different storage order
+  field<T> as(storage layout) const;
+
+  // index of component "c" of tensor "i" in the plain storage
+  size_t index(size_t i, size_t c) const;
+
+  // access to one component of one tensor
+  X&       operator()(size_t i, size_t c);
+  const X& operator()(size_t i, size_t c) const;
+
+  // copy of tensor "i" (independent of the storage order)
+  T    operator[](size_t i) const;
+  T    get       (size_t i) const;
+  void set       (size_t i, const T &A);
+
+  // pointer to the plain storage
+  X*       data();
+  const X* data() const;
+
+  // initialization
+  void setConstant(const T &D);
+  void setZero();
+
+  // arithmetic operators (element-wise, on the plain storage)
+  field<T>& operator*= (const field<T> &B);
+  field<T>& operator/= (const field<T> &B);
+  field<T>& operator+= (const field<T> &B);
+  field<T>& operator-= (const field<T> &B);
+  field<T>& operator*= (X B);
+  field<T>& operator/= (X B);
+  field<T>& operator+= (X B);
+  field<T>& operator-= (X B);
+
+};
+
+// =================================================================================================
+// container of the result of an operation on a field:
+// "cppmat::cartesian::field<R>" for a tensor, "cppmat::array<R>" (rank 1) for a scalar
+// =================================================================================================
+
+template<class R, class V=void>
+struct field_result
+{
+  typedef cppmat::cartesian::field<R> type;
+
+  static type allocate(size_t n, storage layout);
+  static void set(type &out, size_t i, const R &A);
+};
+
+template<class R>
+struct field_result<R, typename std::enable_if<std::is_arithmetic<R>::value>::type>
+{
+  typedef cppmat::array<R> type;
+
+  static type allocate(size_t n, storage layout);
+  static void set(type &out, size_t i, const R &A);
+};
+
+// =================================================================================================
+// apply an operation to each tensor (or each pair of tensors) of a field:
+// - "func(A[i])", or "func(A[i], B[i])" for two fields
+// - "func(A[i], B)" or "func(A, B[i])" for a field and one tensor
+// the result is stored in the storage order of the (first) field
+// =================================================================================================
+
+template<class T, class F>
+auto apply(const field<T> &A, F func)
+  -> typename field_result<decltype(func(std::declval<T>()))>::type;
+
+template<class T, class U, class F>
+auto apply(const field<T> &A, const field<U> &B, F func)
+  -> typename field_result<decltype(func(std::declval<T>(), std::declval<U>()))>::type;
+
+template<class T, class U, class F>
+auto apply(const field<T> &A, const U &B, F func)
+  -> typename field_result<decltype(func(std::declval<T>(), std::declval<U>()))>::type;
+
+template<class T, class U, class F>
+auto apply(const T &A, const field<U> &B, F func)
+  -> typename field_result<decltype(func(std::declval<T>(), std::declval<U>()))>::type;
+
+// =================================================================================================
+// tensor products of each tensor of a field (with the corresponding tensor of another field, or
+// with a single tensor)
+// =================================================================================================
+
+template<class T, class U>
+auto ddot(const field<T> &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().ddot(std::declval<U>()))>::type;
+
+template<class T, class U>
+auto ddot(const field<T> &A, const U &B)
+  -> typename field_result<decltype(std::declval<T>().ddot(std::declval<U>()))>::type;
+
+template<class T, class U>
+auto ddot(const T &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().ddot(std::declval<U>()))>::type;
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+auto dot(const field<T> &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dot(std::declval<U>()))>::type;
+
+template<class T, class U>
+auto dot(const field<T> &A, const U &B)
+  -> typename field_result<decltype(std::declval<T>().dot(std::declval<U>()))>::type;
+
+template<class T, class U>
+auto dot(const T &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dot(std::declval<U>()))>::type;
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+auto dyadic(const field<T> &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dyadic(std::declval<U>()))>::type;
+
+template<class T, class U>
+auto dyadic(const field<T> &A, const U &B)
+  -> typename field_result<decltype(std::declval<T>().dyadic(std::declval<U>()))>::type;
+
+template<class T, class U>
+auto dyadic(const T &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dyadic(std::declval<U>()))>::type;
+
+// =================================================================================================
+// specializations for common tensor products: for "storage::SoA" batched kernels are used that
+// are vectorized over the tensors (see "var_cartesian_field_batch.hpp")
+// =================================================================================================
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2<X,ND>> ddot(
+  const field<cppmat::tiny::cartesian::tensor4 <X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+cppmat::array<X> ddot(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2<X,ND>> dot(
+  const field<cppmat::tiny::cartesian::tensor2<X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2<X,ND>> &B
+);
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor4<X,ND>> dyadic(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &B
+);
+
+// =================================================================================================
+// operations on each tensor of a field
+// =================================================================================================
+
+template<class T> field<T> inv(const field<T> &A);
+template<class T> cppmat::array<typename field<T>::value_type> det(const field<T> &A);
+template<class T> cppmat::array<typename field<T>::value_type> trace(const field<T> &A);
+
+// hydrostatic part: trace(A) / ND, and deviatoric part: A - trace(A) / ND * I
+// (for "tensor2", "tensor2s", and "tensor2d")
+template<class T> cppmat::array<typename field<T>::value_type> hyd(const field<T> &A);
+template<class T> field<T> dev(const field<T> &A);
+
+// -------------------------------------------------------------------------------------------------
+
+// specializations, batched for "storage::SoA" in 2-D and 3-D (per tensor otherwise)
+template<typename X, size_t ND> cppmat::array<X> det(const field<cppmat::tiny::cartesian::tensor2 <X,ND>> &A);
+template<typename X, size_t ND> cppmat::array<X> det(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2<X,ND>> inv(const field<cppmat::tiny::cartesian::tensor2<X,ND>> &A);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> inv(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A);
+
+// -------------------------------------------------------------------------------------------------
+
+// eigen-decomposition of each tensor (see "cppmat::cartesian::eig"), the result is stored in the
+// storage order of "A"
+template<typename X, size_t ND>
+void eig(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::vector<X,ND>> &val,
+  field<cppmat::tiny::cartesian::tensor2<X,ND>> &vec
+);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::vector<X,ND>> eigenvalues(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A
+);
+
+// -------------------------------------------------------------------------------------------------
+
+// isotropic tensor functions of each tensor (see "cppmat::cartesian::log", etc.), optionally with
+// the derivative; the result is stored in the storage order of "A"
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> log(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> log(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> exp(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> exp(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> sqrt(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> sqrt(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> pow(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A, X p);
+
+template<typename X, size_t ND>
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> pow(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A, X p,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,1128 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_FIELD_HPP
+#define CPPMAT_VAR_CARTESIAN_FIELD_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<class T>
+inline
+field<T>::field(size_t n, storage layout) : mSize(n), mLayout(layout), mData(n*T::Size())
+{
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<class T>
+inline
+field<T> field<T>::Zero(size_t n, storage layout)
+{
+  field<T> out(n, layout);
+
+  out.setZero();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T> field<T>::Constant(size_t n, const T &D, storage layout)
+{
+  field<T> out(n, layout);
+
+  out.setConstant(D);
+
+  return out;
+}
+
+// =================================================================================================
+// resize
+// =================================================================================================
+
+template<class T>
+inline
+void field<T>::resize(size_t n)
+{
+  mSize = n;
+
+  mData.resize(n*T::Size());
+}
+
+// =================================================================================================
+// get dimensions
+// =================================================================================================
+
+template<class T>
+inline
+size_t field<T>::size() const
+{
+  return mSize;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+size_t field<T>::ncomp()
+{
+  return T::Size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+size_t field<T>::ndim()
+{
+  return cppmat::Private::tensor_traits<T>::ndim;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+storage field<T>::layout() const
+{
+  return mLayout;
+}
+
+// =================================================================================================
+// copy with a different storage order
+// =================================================================================================
+
+template<class T>
+inline
+field<T> field<T>::as(storage layout) const
+{
+  if ( layout == mLayout ) return *this;
+
+  field<T> out(mSize, layout);
+
+  size_t nc = T::Size();
+
+  for ( size_t c = 0 ; c < nc ; ++c )
+    for ( size_t i = 0 ; i < mSize ; ++i )
+      out(i,c) = (*this)(i,c);
+
+  return out;
+}
+
+// =================================================================================================
+// index operators
+// =================================================================================================
+
+template<class T>
+inline
+size_t field<T>::index(size_t i, size_t c) const
+{
+  Assert( i < mSize     );
+  Assert( c < T::Size() );
+
+  if ( mLayout == storage::AoS ) return i * T::Size() + c;
+
+  return c * mSize + i;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+typename field<T>::X& field<T>::operator()(size_t i, size_t c)
+{
+  return mData[index(i,c)];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+const typename field<T>::X& field<T>::operator()(size_t i, size_t c) const
+{
+  return mData[index(i,c)];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+T field<T>::operator[](size_t i) const
+{
+  return get(i);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+T field<T>::get(size_t i) const
+{
+  Assert( i < mSize );
+
+  T out;
+
+  size_t nc = T::Size();
+
+  if ( mLayout == storage::AoS )
+  {
+    const X *ptr = &mData[i*nc];
+
+    for ( size_t c = 0 ; c < nc ; ++c )
+      out[c] = ptr[c];
+  }
+  else
+  {
+    for ( size_t c = 0 ; c < nc ; ++c )
+      out[c] = mData[c*mSize+i];
+  }
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+void field<T>::set(size_t i, const T &A)
+{
+  Assert( i < mSize );
+
+  size_t nc = T::Size();
+
+  if ( mLayout == storage::AoS )
+  {
+    X *ptr = &mData[i*nc];
+
+    for ( size_t c = 0 ; c < nc ; ++c )
+      ptr[c] = A[c];
+  }
+  else
+  {
+    for ( size_t c = 0 ; c < nc ; ++c )
+      mData[c*mSize+i] = A[c];
+  }
+}
+
+// =================================================================================================
+// pointer to the plain storage
+// =================================================================================================
+
+template<class T>
+inline
+typename field<T>::X* field<T>::data()
+{
+  return mData.data();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+const typename field<T>::X* field<T>::data() const
+{
+  return mData.data();
+}
+
+// =================================================================================================
+// initialization
+// =================================================================================================
+
+template<class T>
+inline
+void field<T>::setConstant(const T &D)
+{
+  cppmat::Private::parallel_for(mSize, mData.size(), [this,&D](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      set(i, D);
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+void field<T>::setZero()
+{
+  std::fill(mData.begin(), mData.end(), static_cast<X>(0));
+}
+
+// =================================================================================================
+// arithmetic operators
+// =================================================================================================
+
+template<class T>
+inline
+field<T>& field<T>::operator*= (const field<T> &B)
+{
+  Assert( size  () == B.size  () );
+  Assert( layout() == B.layout() );
+
+  cppmat::Private::inplace(mData.data(), B.data(), mData.size(),
+    [](const X &a, const X &b) { return a * b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator/= (const field<T> &B)
+{
+  Assert( size  () == B.size  () );
+  Assert( layout() == B.layout() );
+
+  cppmat::Private::inplace(mData.data(), B.data(), mData.size(),
+    [](const X &a, const X &b) { return a / b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator+= (const field<T> &B)
+{
+  Assert( size  () == B.size  () );
+  Assert( layout() == B.layout() );
+
+  cppmat::Private::inplace(mData.data(), B.data(), mData.size(),
+    [](const X &a, const X &b) { return a + b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator-= (const field<T> &B)
+{
+  Assert( size  () == B.size  () );
+  Assert( layout() == B.layout() );
+
+  cppmat::Private::inplace(mData.data(), B.data(), mData.size(),
+    [](const X &a, const X &b) { return a - b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator*= (X B)
+{
+  cppmat::Private::inplace(mData.data(), B, mData.size(),
+    [](const X &a, const X &b) { return a * b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator/= (X B)
+{
+  cppmat::Private::inplace(mData.data(), B, mData.size(),
+    [](const X &a, const X &b) { return a / b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator+= (X B)
+{
+  cppmat::Private::inplace(mData.data(), B, mData.size(),
+    [](const X &a, const X &b) { return a + b; });
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T>& field<T>::operator-= (X B)
+{
+  cppmat::Private::inplace(mData.data(), B, mData.size(),
+    [](const X &a, const X &b) { return a - b; });
+
+  return *this;
+}
+
+// =================================================================================================
+// container of the result of an operation on a field
+// =================================================================================================
+
+template<class R, class V>
+inline
+typename field_result<R,V>::type field_result<R,V>::allocate(size_t n, storage layout)
+{
+  return type(n, layout);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class R, class V>
+inline
+void field_result<R,V>::set(type &out, size_t i, const R &A)
+{
+  out.set(i, A);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class R>
+inline
+typename field_result<R, typename std::enable_if<std::is_arithmetic<R>::value>::type>::type
+field_result<R, typename std::enable_if<std::is_arithmetic<R>::value>::type>::allocate(
+  size_t n, storage layout)
+{
+  UNUSED(layout);
+
+  return type({n});
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class R>
+inline
+void field_result<R, typename std::enable_if<std::is_arithmetic<R>::value>::type>::set(
+  type &out, size_t i, const R &A)
+{
+  out[i] = A;
+}
+
+// =================================================================================================
+// apply an operation to each tensor
+// =================================================================================================
+
+template<class T, class F>
+inline
+auto apply(const field<T> &A, F func)
+  -> typename field_result<decltype(func(std::declval<T>()))>::type
+{
+  typedef field_result<decltype(func(std::declval<T>()))> Result;
+
+  auto out = Result::allocate(A.size(), A.layout());
+
+  cppmat::Private::parallel_for(A.size(), A.size()*T::Size(), [&](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      Result::set(out, i, func(A.get(i)));
+  });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U, class F>
+inline
+auto apply(const field<T> &A, const field<U> &B, F func)
+  -> typename field_result<decltype(func(std::declval<T>(), std::declval<U>()))>::type
+{
+  Assert( A.size() == B.size() );
+
+  typedef field_result<decltype(func(std::declval<T>(), std::declval<U>()))> Result;
+
+  auto out = Result::allocate(A.size(), A.layout());
+
+  cppmat::Private::parallel_for(A.size(), A.size()*T::Size(), [&](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      Result::set(out, i, func(A.get(i), B.get(i)));
+  });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U, class F>
+inline
+auto apply(const field<T> &A, const U &B, F func)
+  -> typename field_result<decltype(func(std::declval<T>(), std::declval<U>()))>::type
+{
+  typedef field_result<decltype(func(std::declval<T>(), std::declval<U>()))> Result;
+
+  auto out = Result::allocate(A.size(), A.layout());
+
+  cppmat::Private::parallel_for(A.size(), A.size()*T::Size(), [&](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      Result::set(out, i, func(A.get(i), B));
+  });
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U, class F>
+inline
+auto apply(const T &A, const field<U> &B, F func)
+  -> typename field_result<decltype(func(std::declval<T>(), std::declval<U>()))>::type
+{
+  typedef field_result<decltype(func(std::declval<T>(), std::declval<U>()))> Result;
+
+  auto out = Result::allocate(B.size(), B.layout());
+
+  cppmat::Private::parallel_for(B.size(), B.size()*U::Size(), [&](size_t begin, size_t end) {
+    for ( size_t i = begin ; i < end ; ++i )
+      Result::set(out, i, func(A, B.get(i)));
+  });
+
+  return out;
+}
+
+// =================================================================================================
+// tensor products: ddot
+// =================================================================================================
+
+template<class T, class U>
+inline
+auto ddot(const field<T> &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().ddot(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.ddot(b); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+inline
+auto ddot(const field<T> &A, const U &B)
+  -> typename field_result<decltype(std::declval<T>().ddot(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.ddot(b); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+inline
+auto ddot(const T &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().ddot(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.ddot(b); });
+}
+
+// =================================================================================================
+// tensor products: dot
+// =================================================================================================
+
+template<class T, class U>
+inline
+auto dot(const field<T> &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dot(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.dot(b); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+inline
+auto dot(const field<T> &A, const U &B)
+  -> typename field_result<decltype(std::declval<T>().dot(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.dot(b); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+inline
+auto dot(const T &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dot(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.dot(b); });
+}
+
+// =================================================================================================
+// tensor products: dyadic
+// =================================================================================================
+
+template<class T, class U>
+inline
+auto dyadic(const field<T> &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dyadic(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.dyadic(b); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+inline
+auto dyadic(const field<T> &A, const U &B)
+  -> typename field_result<decltype(std::declval<T>().dyadic(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.dyadic(b); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T, class U>
+inline
+auto dyadic(const T &A, const field<U> &B)
+  -> typename field_result<decltype(std::declval<T>().dyadic(std::declval<U>()))>::type
+{
+  return apply(A, B, [](const T &a, const U &b) { return a.dyadic(b); });
+}
+
+// =================================================================================================
+// operations on each tensor
+// =================================================================================================
+
+template<class T>
+inline
+field<T> inv(const field<T> &A)
+{
+  return apply(A, [](const T &a) { return T(a.inv()); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+cppmat::array<typename field<T>::value_type> det(const field<T> &A)
+{
+  return apply(A, [](const T &a) { return a.det(); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+cppmat::array<typename field<T>::value_type> trace(const field<T> &A)
+{
+  return apply(A, [](const T &a) { return a.trace(); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+cppmat::array<typename field<T>::value_type> hyd(const field<T> &A)
+{
+  typedef typename field<T>::value_type X;
+
+  X nd = static_cast<X>(field<T>::ndim());
+
+  return apply(A, [nd](const T &a) { return a.trace() / nd; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+field<T> dev(const field<T> &A)
+{
+  typedef typename field<T>::value_type X;
+
+  size_t nd = field<T>::ndim();
+
+  return apply(A, [nd](const T &a) {
+    T out = a;
+    X m = a.trace() / static_cast<X>(nd);
+    for ( size_t i = 0 ; i < nd ; ++i )
+      out(i,i) -= m;
+    return out;
+  });
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// "det" and "inv" of a field in "storage::SoA": batched in 2-D and 3-D ("std::true_type"), per tensor
+// otherwise ("std::false_type")
+// =================================================================================================
+
+template<class T>
+inline
+cppmat::array<typename cartesian::field<T>::value_type> field_det(const cartesian::field<T> &A, std::false_type)
+{
+  return cartesian::apply(A, [](const T &a) { return a.det(); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::array<X> field_det(const cartesian::field<tiny::cartesian::tensor2<X,ND>> &A, std::true_type)
+{
+  cppmat::array<X> C({A.size()});
+
+  batch_det_2(A.size(), A.data(), C.data(), std::integral_constant<size_t,ND>());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::array<X> field_det(const cartesian::field<tiny::cartesian::tensor2s<X,ND>> &A, std::true_type)
+{
+  cppmat::array<X> C({A.size()});
+
+  batch_det_2s(A.size(), A.data(), C.data(), std::integral_constant<size_t,ND>());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<class T>
+inline
+cartesian::field<T> field_inv(const cartesian::field<T> &A, std::false_type)
+{
+  return cartesian::apply(A, [](const T &a) { return a.inv(); });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cartesian::field<tiny::cartesian::tensor2<X,ND>> field_inv(
+  const cartesian::field<tiny::cartesian::tensor2<X,ND>> &A, std::true_type)
+{
+  cartesian::field<tiny::cartesian::tensor2<X,ND>> C(A.size(), cartesian::storage::SoA);
+
+  batch_inv_2(A.size(), A.data(), C.data(), std::integral_constant<size_t,ND>());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cartesian::field<tiny::cartesian::tensor2s<X,ND>> field_inv(
+  const cartesian::field<tiny::cartesian::tensor2s<X,ND>> &A, std::true_type)
+{
+  cartesian::field<tiny::cartesian::tensor2s<X,ND>> C(A.size(), cartesian::storage::SoA);
+
+  batch_inv_2s(A.size(), A.data(), C.data(), std::integral_constant<size_t,ND>());
+
+  return C;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+
+// =================================================================================================
+// specializations for common tensor products (batched for "storage::SoA")
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2<X,ND>> ddot(
+  const field<cppmat::tiny::cartesian::tensor4 <X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &B
+)
+{
+  typedef cppmat::tiny::cartesian::tensor4 <X,ND> T4;
+  typedef cppmat::tiny::cartesian::tensor2 <X,ND> T2;
+  typedef cppmat::tiny::cartesian::tensor2s<X,ND> T2s;
+
+  Assert( A.size() == B.size() );
+
+  if ( A.layout() != storage::SoA or B.layout() != storage::SoA )
+    return apply(A, B, [](const T4 &a, const T2s &b) { return a.ddot(b); });
+
+  field<T2> C(A.size(), storage::SoA);
+
+  cppmat::Private::batch_ddot_4_2s<X,ND>(A.size(), A.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::array<X> ddot(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &B
+)
+{
+  typedef cppmat::tiny::cartesian::tensor2s<X,ND> T2s;
+
+  Assert( A.size() == B.size() );
+
+  if ( A.layout() != storage::SoA or B.layout() != storage::SoA )
+    return apply(A, B, [](const T2s &a, const T2s &b) { return a.ddot(b); });
+
+  cppmat::array<X> C({A.size()});
+
+  cppmat::Private::batch_ddot_2s_2s<X,ND>(A.size(), A.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2<X,ND>> dot(
+  const field<cppmat::tiny::cartesian::tensor2<X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2<X,ND>> &B
+)
+{
+  typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+  Assert( A.size() == B.size() );
+
+  if ( A.layout() != storage::SoA or B.layout() != storage::SoA )
+    return apply(A, B, [](const T2 &a, const T2 &b) { return a.dot(b); });
+
+  field<T2> C(A.size(), storage::SoA);
+
+  cppmat::Private::batch_dot_2_2<X,ND>(A.size(), A.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor4<X,ND>> dyadic(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &B
+)
+{
+  typedef cppmat::tiny::cartesian::tensor4 <X,ND> T4;
+  typedef cppmat::tiny::cartesian::tensor2s<X,ND> T2s;
+
+  Assert( A.size() == B.size() );
+
+  if ( A.layout() != storage::SoA or B.layout() != storage::SoA )
+    return apply(A, B, [](const T2s &a, const T2s &b) { return a.dyadic(b); });
+
+  field<T4> C(A.size(), storage::SoA);
+
+  cppmat::Private::batch_dyadic_2s_2s<X,ND>(A.size(), A.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::array<X> det(const field<cppmat::tiny::cartesian::tensor2<X,ND>> &A)
+{
+  typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+  if ( A.layout() != storage::SoA )
+    return apply(A, [](const T2 &a) { return a.det(); });
+
+  return cppmat::Private::field_det(A, std::integral_constant<bool, ND == 2 or ND == 3>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+cppmat::array<X> det(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A)
+{
+  typedef cppmat::tiny::cartesian::tensor2s<X,ND> T2s;
+
+  if ( A.layout() != storage::SoA )
+    return apply(A, [](const T2s &a) { return a.det(); });
+
+  return cppmat::Private::field_det(A, std::integral_constant<bool, ND == 2 or ND == 3>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2<X,ND>> inv(const field<cppmat::tiny::cartesian::tensor2<X,ND>> &A)
+{
+  typedef cppmat::tiny::cartesian::tensor2<X,ND> T2;
+
+  if ( A.layout() != storage::SoA )
+    return apply(A, [](const T2 &a) { return a.inv(); });
+
+  return cppmat::Private::field_inv(A, std::integral_constant<bool, ND == 2 or ND == 3>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> inv(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A)
+{
+  typedef cppmat::tiny::cartesian::tensor2s<X,ND> T2s;
+
+  if ( A.layout() != storage::SoA )
+    return apply(A, [](const T2s &a) { return a.inv(); });
+
+  return cppmat::Private::field_inv(A, std::integral_constant<bool, ND == 2 or ND == 3>());
+}
+
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+// "AoS": directly on the storage, "SoA": on a local copy of each tensor
+template<typename X, size_t ND>
+inline
+void eig(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::vector<X,ND>> &val,
+  field<cppmat::tiny::cartesian::tensor2<X,ND>> &vec
+)
+{
+  const size_t NA = ND * (ND+1) / 2;
+
+  val = field<cppmat::tiny::cartesian::vector <X,ND>>(A.size(), A.layout());
+  vec = field<cppmat::tiny::cartesian::tensor2<X,ND>>(A.size(), A.layout());
+
+  cppmat::Private::parallel_for(A.size(), A.size()*ND*ND*ND, [&](size_t begin, size_t end) {
+
+    if ( A.layout() == storage::AoS ) {
+      for ( size_t i = begin ; i < end ; ++i )
+        cppmat::Private::eig_sym(ND, A.data()+i*NA, val.data()+i*ND, vec.data()+i*ND*ND);
+      return;
+    }
+
+    X a[NA], l[ND], v[ND*ND];
+
+    for ( size_t i = begin ; i < end ; ++i ) {
+      for ( size_t c = 0 ; c < NA ; ++c ) a[c] = A(i,c);
+      cppmat::Private::eig_sym(ND, a, l, v);
+      for ( size_t c = 0 ; c < ND ; ++c ) val(i,c) = l[c];
+      for ( size_t c = 0 ; c < ND*ND ; ++c ) vec(i,c) = v[c];
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::vector<X,ND>> eigenvalues(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A
+)
+{
+  typedef cppmat::tiny::cartesian::tensor2s<X,ND> T2s;
+
+  return apply(A, [](const T2s &a) { return a.eigenvalues(); });
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> log(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  cppmat::Private::isotropic_log<X> func;
+
+  bool ok = cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  if ( not ok )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> log(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  dFdA = field<cppmat::tiny::cartesian::tensor4<X,ND>>(A.size(), A.layout());
+
+  cppmat::Private::isotropic_log<X> func;
+
+  bool ok = cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), dFdA.data(), func);
+
+  if ( not ok )
+    throw std::domain_error("cppmat::cartesian::log: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> exp(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> exp(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  dFdA = field<cppmat::tiny::cartesian::tensor4<X,ND>>(A.size(), A.layout());
+
+  cppmat::Private::isotropic_exp<X> func;
+
+  cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), dFdA.data(), func);
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> sqrt(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  bool ok = cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  if ( not ok )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> sqrt(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  dFdA = field<cppmat::tiny::cartesian::tensor4<X,ND>>(A.size(), A.layout());
+
+  cppmat::Private::isotropic_sqrt<X> func;
+
+  bool ok = cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), dFdA.data(), func);
+
+  if ( not ok )
+    throw std::domain_error("cppmat::cartesian::sqrt: Tensor must be positive semi-definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> pow(const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A, X p)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  bool ok = cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), static_cast<X*>(nullptr), func);
+
+  if ( not ok )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X, size_t ND>
+inline
+field<cppmat::tiny::cartesian::tensor2s<X,ND>> pow(
+  const field<cppmat::tiny::cartesian::tensor2s<X,ND>> &A, X p,
+  field<cppmat::tiny::cartesian::tensor4<X,ND>> &dFdA
+)
+{
+  field<cppmat::tiny::cartesian::tensor2s<X,ND>> F(A.size(), A.layout());
+
+  dFdA = field<cppmat::tiny::cartesian::tensor4<X,ND>>(A.size(), A.layout());
+
+  cppmat::Private::isotropic_pow<X> func{p};
+
+  bool ok = cppmat::Private::isotropic_field<X,ND>(
+    A.size(), A.layout() == storage::SoA, A.data(), F.data(), dFdA.data(), func);
+
+  if ( not ok )
+    throw std::domain_error("cppmat::cartesian::pow: Tensor must be positive definite");
+
+  return F;
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
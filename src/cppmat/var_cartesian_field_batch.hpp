@@ -0,0 +1,357 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_FIELD_BATCH_HPP
+#define CPPMAT_VAR_CARTESIAN_FIELD_BATCH_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// batched kernels on "n" tensors stored as "structure of arrays" (SoA):
+// component "c" of tensor "p" is stored at "ptr[c*n+p]"
+//
+// the tensors are processed in blocks of "CPPMAT_BATCH" consecutive tensors (the "lanes"), such that
+// the innermost loop runs over the lanes, which is contiguous in memory and is vectorized
+// =================================================================================================
+
+// call "func(p, w)" for blocks of tensors "[p, p+w)" that together span "[0, n)"
+// - "w" is a "std::integral_constant": "CPPMAT_BATCH" for all full blocks, "1" for the remainder
+// - "work" is the number of entries that is processed (see "parallel_for")
+template<class F>
+inline
+void batch(size_t n, size_t work, F func)
+{
+  parallel_for(n, work, [&func](size_t begin, size_t end) {
+    size_t nb = ( end - begin ) / CPPMAT_BATCH;
+    for ( size_t b = 0 ; b < nb ; ++b )
+      func(begin + b * CPPMAT_BATCH, std::integral_constant<size_t,CPPMAT_BATCH>());
+    for ( size_t p = begin + nb * CPPMAT_BATCH ; p < end ; ++p )
+      func(p, std::integral_constant<size_t,1>());
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// index of component (i,j) in the storage of a symmetric tensor (upper triangle, row-major)
+inline size_t batch_sym(size_t i, size_t j, size_t nd)
+{
+  if ( i > j ) std::swap(i, j);
+
+  return i * nd - ( i * (i+1) ) / 2 + j;
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+// C_ij = A_ijkl * B_lk (tensor4, tensor2s -> tensor2)
+template<typename X, size_t ND>
+inline
+void batch_ddot_4_2s(size_t n, const X *A, const X *B, X *C)
+{
+  batch(n, n*ND*ND*ND*ND, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    for ( size_t i = 0 ; i < ND ; ++i ) {
+      for ( size_t j = 0 ; j < ND ; ++j ) {
+        X c[W] = {};
+        for ( size_t k = 0 ; k < ND ; ++k ) {
+          for ( size_t l = 0 ; l < ND ; ++l ) {
+            const X *a = A + (((i*ND+j)*ND+k)*ND+l)*n + p;
+            const X *b = B + batch_sym(l,k,ND)*n + p;
+            CPPMAT_SIMD
+            for ( size_t q = 0 ; q < W ; ++q )
+              c[q] += a[q] * b[q];
+          }
+        }
+        X *o = C + (i*ND+j)*n + p;
+        CPPMAT_SIMD
+        for ( size_t q = 0 ; q < W ; ++q )
+          o[q] = c[q];
+      }
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// C = A_ij * B_ji (tensor2s, tensor2s -> scalar)
+template<typename X, size_t ND>
+inline
+void batch_ddot_2s_2s(size_t n, const X *A, const X *B, X *C)
+{
+  batch(n, n*ND*ND, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    X c[W] = {};
+    for ( size_t i = 0 ; i < ND ; ++i ) {
+      for ( size_t j = i ; j < ND ; ++j ) {
+        const X *a = A + batch_sym(i,j,ND)*n + p;
+        const X *b = B + batch_sym(i,j,ND)*n + p;
+        const X  f = ( i == j ) ? static_cast<X>(1) : static_cast<X>(2);
+        CPPMAT_SIMD
+        for ( size_t q = 0 ; q < W ; ++q )
+          c[q] += f * a[q] * b[q];
+      }
+    }
+    X *o = C + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q )
+      o[q] = c[q];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// C_ik = A_ij * B_jk (tensor2, tensor2 -> tensor2)
+template<typename X, size_t ND>
+inline
+void batch_dot_2_2(size_t n, const X *A, const X *B, X *C)
+{
+  batch(n, n*ND*ND*ND, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    for ( size_t i = 0 ; i < ND ; ++i ) {
+      for ( size_t k = 0 ; k < ND ; ++k ) {
+        X c[W] = {};
+        for ( size_t j = 0 ; j < ND ; ++j ) {
+          const X *a = A + (i*ND+j)*n + p;
+          const X *b = B + (j*ND+k)*n + p;
+          CPPMAT_SIMD
+          for ( size_t q = 0 ; q < W ; ++q )
+            c[q] += a[q] * b[q];
+        }
+        X *o = C + (i*ND+k)*n + p;
+        CPPMAT_SIMD
+        for ( size_t q = 0 ; q < W ; ++q )
+          o[q] = c[q];
+      }
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// C_ijkl = A_ij * B_kl (tensor2s, tensor2s -> tensor4)
+template<typename X, size_t ND>
+inline
+void batch_dyadic_2s_2s(size_t n, const X *A, const X *B, X *C)
+{
+  batch(n, n*ND*ND*ND*ND, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    for ( size_t i = 0 ; i < ND ; ++i ) {
+      for ( size_t j = 0 ; j < ND ; ++j ) {
+        const X *a = A + batch_sym(i,j,ND)*n + p;
+        for ( size_t k = 0 ; k < ND ; ++k ) {
+          for ( size_t l = 0 ; l < ND ; ++l ) {
+            const X *b = B + batch_sym(k,l,ND)*n + p;
+            X       *o = C + (((i*ND+j)*ND+k)*ND+l)*n + p;
+            CPPMAT_SIMD
+            for ( size_t q = 0 ; q < W ; ++q )
+              o[q] = a[q] * b[q];
+          }
+        }
+      }
+    }
+  });
+}
+
+// =================================================================================================
+// determinant
+// =================================================================================================
+
+// tensor2, 2-D
+template<typename X>
+inline
+void batch_det_2(size_t n, const X *A, X *C, std::integral_constant<size_t,2>)
+{
+  batch(n, 4*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p, *a3 = A + 3*n + p;
+    X *o = C + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q )
+      o[q] = a0[q] * a3[q] - a1[q] * a2[q];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// tensor2, 3-D
+template<typename X>
+inline
+void batch_det_2(size_t n, const X *A, X *C, std::integral_constant<size_t,3>)
+{
+  batch(n, 9*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p;
+    const X *a3 = A + 3*n + p, *a4 = A + 4*n + p, *a5 = A + 5*n + p;
+    const X *a6 = A + 6*n + p, *a7 = A + 7*n + p, *a8 = A + 8*n + p;
+    X *o = C + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q )
+      o[q] = ( a0[q] * a4[q] * a8[q] + a1[q] * a5[q] * a6[q] + a2[q] * a3[q] * a7[q] ) -
+             ( a2[q] * a4[q] * a6[q] + a1[q] * a3[q] * a8[q] + a0[q] * a5[q] * a7[q] );
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// tensor2s, 2-D
+template<typename X>
+inline
+void batch_det_2s(size_t n, const X *A, X *C, std::integral_constant<size_t,2>)
+{
+  batch(n, 3*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p;
+    X *o = C + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q )
+      o[q] = a0[q] * a2[q] - a1[q] * a1[q];
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// tensor2s, 3-D
+template<typename X>
+inline
+void batch_det_2s(size_t n, const X *A, X *C, std::integral_constant<size_t,3>)
+{
+  batch(n, 6*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p;
+    const X *a3 = A + 3*n + p, *a4 = A + 4*n + p, *a5 = A + 5*n + p;
+    X *o = C + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q )
+      o[q] = ( a0[q] * a3[q] * a5[q] + static_cast<X>(2) * a1[q] * a2[q] * a4[q] ) -
+             ( a4[q] * a4[q] * a0[q] + a2[q] * a2[q] * a3[q] + a1[q] * a1[q] * a5[q] );
+  });
+}
+
+// =================================================================================================
+// inverse
+// =================================================================================================
+
+// tensor2, 2-D
+template<typename X>
+inline
+void batch_inv_2(size_t n, const X *A, X *C, std::integral_constant<size_t,2>)
+{
+  batch(n, 4*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p, *a3 = A + 3*n + p;
+    X *c0 = C + 0*n + p, *c1 = C + 1*n + p, *c2 = C + 2*n + p, *c3 = C + 3*n + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q ) {
+      X d = a0[q] * a3[q] - a1[q] * a2[q];
+      X b0 = a0[q], b1 = a1[q], b2 = a2[q], b3 = a3[q];
+      c0[q] =   b3 / d;
+      c1[q] = - b1 / d;
+      c2[q] = - b2 / d;
+      c3[q] =   b0 / d;
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// tensor2, 3-D
+template<typename X>
+inline
+void batch_inv_2(size_t n, const X *A, X *C, std::integral_constant<size_t,3>)
+{
+  batch(n, 9*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p;
+    const X *a3 = A + 3*n + p, *a4 = A + 4*n + p, *a5 = A + 5*n + p;
+    const X *a6 = A + 6*n + p, *a7 = A + 7*n + p, *a8 = A + 8*n + p;
+    X *c0 = C + 0*n + p, *c1 = C + 1*n + p, *c2 = C + 2*n + p;
+    X *c3 = C + 3*n + p, *c4 = C + 4*n + p, *c5 = C + 5*n + p;
+    X *c6 = C + 6*n + p, *c7 = C + 7*n + p, *c8 = C + 8*n + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q ) {
+      X b0 = a0[q], b1 = a1[q], b2 = a2[q], b3 = a3[q], b4 = a4[q];
+      X b5 = a5[q], b6 = a6[q], b7 = a7[q], b8 = a8[q];
+      X d = ( b0 * b4 * b8 + b1 * b5 * b6 + b2 * b3 * b7 ) -
+            ( b2 * b4 * b6 + b1 * b3 * b8 + b0 * b5 * b7 );
+      c0[q] = (b4*b8-b5*b7) / d;
+      c1[q] = (b2*b7-b1*b8) / d;
+      c2[q] = (b1*b5-b2*b4) / d;
+      c3[q] = (b5*b6-b3*b8) / d;
+      c4[q] = (b0*b8-b2*b6) / d;
+      c5[q] = (b2*b3-b0*b5) / d;
+      c6[q] = (b3*b7-b4*b6) / d;
+      c7[q] = (b1*b6-b0*b7) / d;
+      c8[q] = (b0*b4-b1*b3) / d;
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// tensor2s, 2-D
+template<typename X>
+inline
+void batch_inv_2s(size_t n, const X *A, X *C, std::integral_constant<size_t,2>)
+{
+  batch(n, 3*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p;
+    X *c0 = C + 0*n + p, *c1 = C + 1*n + p, *c2 = C + 2*n + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q ) {
+      X b0 = a0[q], b1 = a1[q], b2 = a2[q];
+      X d = b0 * b2 - b1 * b1;
+      c0[q] =   b2 / d;
+      c1[q] = - b1 / d;
+      c2[q] =   b0 / d;
+    }
+  });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+// tensor2s, 3-D
+template<typename X>
+inline
+void batch_inv_2s(size_t n, const X *A, X *C, std::integral_constant<size_t,3>)
+{
+  batch(n, 6*n, [=](size_t p, auto w) {
+    const size_t W = decltype(w)::value;
+    const X *a0 = A + 0*n + p, *a1 = A + 1*n + p, *a2 = A + 2*n + p;
+    const X *a3 = A + 3*n + p, *a4 = A + 4*n + p, *a5 = A + 5*n + p;
+    X *c0 = C + 0*n + p, *c1 = C + 1*n + p, *c2 = C + 2*n + p;
+    X *c3 = C + 3*n + p, *c4 = C + 4*n + p, *c5 = C + 5*n + p;
+    CPPMAT_SIMD
+    for ( size_t q = 0 ; q < W ; ++q ) {
+      X b0 = a0[q], b1 = a1[q], b2 = a2[q], b3 = a3[q], b4 = a4[q], b5 = a5[q];
+      X d = ( b0 * b3 * b5 + static_cast<X>(2) * b1 * b2 * b4 ) -
+            ( b4 * b4 * b0 + b2 * b2 * b3 + b1 * b1 * b5 );
+      c0[q] = (b3*b5-b4*b4) / d;
+      c1[q] = (b2*b4-b1*b5) / d;
+      c2[q] = (b1*b4-b2*b3) / d;
+      c3[q] = (b0*b5-b2*b2) / d;
+      c4[q] = (b2*b1-b0*b4) / d;
+      c5[q] = (b0*b3-b1*b1) / d;
+    }
+  });
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -28,10 +28,20 @@ protected:
   // local variables
   size_t ND=0; // number of dimensions (== mShape[0] == mShape[1])
 
+  // inline storage: a 2-d or 3-d tensor2 is stored without allocation
+  static const size_t INLINE=9;
+  cppmat::Private::inline_buffer<X,INLINE> mInline;
+
 public:
 
   // constructor: default
-  tensor2() = default;
+  tensor2();
+
+  // copy/move: the entries are stored in the own inline storage if they fit
+  tensor2(const tensor2<X> &A);
+  tensor2(tensor2<X> &&A) noexcept;
+  tensor2<X>& operator=(const tensor2<X> &A) = default;
+  tensor2<X>& operator=(tensor2<X> &&A) = default;
 
   // constructor: allocate, don't initialize
   tensor2(size_t nd);
@@ -40,6 +50,10 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor2(const cppmat::array<U> &A);
 
+  // constructor: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  tensor2(const E &A);
+
   // constructor: copy from other classes
   tensor2(const cppmat::symmetric::matrix<X> &A);
   tensor2(const cppmat::diagonal ::matrix<X> &A);
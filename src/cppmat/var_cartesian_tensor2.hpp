@@ -22,9 +22,41 @@ namespace cartesian {
 
 template<typename X>
 inline
-tensor2<X>::tensor2(size_t nd) : cppmat::matrix<X>(nd,nd)
+tensor2<X>::tensor2() : cppmat::matrix<X>(mInline)
 {
-  ND = nd;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X>::tensor2(size_t nd) : cppmat::matrix<X>(mInline)
+{
+  resize(nd);
+}
+
+// =================================================================================================
+// constructors: copy/move
+// =================================================================================================
+
+template<typename X>
+inline
+tensor2<X>::tensor2(const tensor2<X> &A) : cppmat::matrix<X>(mInline)
+{
+  cppmat::array<X>::operator=(A);
+
+  ND = A.ND;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2<X>::tensor2(tensor2<X> &&A) noexcept : cppmat::matrix<X>(mInline)
+{
+  cppmat::array<X>::operator=(std::move(A));
+
+  ND = A.ND;
 }
 
 // =================================================================================================
@@ -34,29 +66,61 @@ tensor2<X>::tensor2(size_t nd) : cppmat::matrix<X>(nd,nd)
 template<typename X>
 template<typename U, typename V>
 inline
-tensor2<X>::tensor2(const cppmat::array<U> &A) : cppmat::matrix<X>(A)
+tensor2<X>::tensor2(const cppmat::array<U> &A) : cppmat::matrix<X>(mInline)
 {
+  cppmat::array<X>::resize(A.shape());
+
+  Assert( this->mRank == 2 );
+
+  this->setCopy(A.begin(), A.end());
+
   ND = this->mShape[0];
 }
 
 // =================================================================================================
-// constructors: copy from other class
+// constructors: evaluate expression
 // =================================================================================================
 
 template<typename X>
+template<class E, typename V>
 inline
-tensor2<X>::tensor2(const cppmat::symmetric::matrix<X> &A) : cppmat::matrix<X>(A)
+tensor2<X>::tensor2(const E &A) : cppmat::matrix<X>(mInline)
 {
+  cppmat::array<X>::resize(A.shape());
+
+  Assert( this->mRank == 2 );
+
+  cppmat::expr::assign(this->data(), A);
+
   ND = this->mShape[0];
 }
 
+// =================================================================================================
+// constructors: copy from other class
+// =================================================================================================
+
+template<typename X>
+inline
+tensor2<X>::tensor2(const cppmat::symmetric::matrix<X> &A) : cppmat::matrix<X>(mInline)
+{
+  resize(A.shape(0));
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      (*this)(i,j) = A(i,j);
+}
+
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-tensor2<X>::tensor2(const cppmat::diagonal::matrix<X> &A) : cppmat::matrix<X>(A)
+tensor2<X>::tensor2(const cppmat::diagonal::matrix<X> &A) : cppmat::matrix<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(A.shape(0));
+
+  for ( size_t i = 0 ; i < ND ; ++i )
+    for ( size_t j = 0 ; j < ND ; ++j )
+      (*this)(i,j) = A(i,j);
 }
 
 // =================================================================================================
@@ -66,9 +130,11 @@ tensor2<X>::tensor2(const cppmat::diagonal::matrix<X> &A) : cppmat::matrix<X>(A)
 template<typename X>
 template<size_t nd>
 inline
-tensor2<X>::tensor2(const cppmat::tiny::cartesian::tensor2<X,nd> &A) : cppmat::matrix<X>(A)
+tensor2<X>::tensor2(const cppmat::tiny::cartesian::tensor2<X,nd> &A) : cppmat::matrix<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(nd);
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
@@ -78,9 +144,11 @@ tensor2<X>::tensor2(const cppmat::tiny::cartesian::tensor2<X,nd> &A) : cppmat::m
 template<typename X>
 template<size_t nd>
 inline
-tensor2<X>::tensor2(const cppmat::view::cartesian::tensor2<X,nd> &A) : cppmat::matrix<X>(A)
+tensor2<X>::tensor2(const cppmat::view::cartesian::tensor2<X,nd> &A) : cppmat::matrix<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(nd);
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
@@ -79,6 +79,7 @@ public:
   tensor2 <X> dot   (const tensor2d<X> &B) const; // single contract.: C_ik   = A_ij * B_jk
   vector  <X> dot   (const vector  <X> &B) const; // single contract.: C_i    = A_ij * B_j
   tensor2 <X> ddot  (const tensor4 <X> &B) const; // double contract.: C_kl   = A_ij * B_jikl
+  tensor2s<X> ddot  (const tensor4s<X> &B) const; // double contract.: C_kl   = A_ij * B_jikl
   X           ddot  (const tensor2 <X> &B) const; // double contract.: C      = A_ij * B_ji
   X           ddot  (const tensor2s<X> &B) const; // double contract.: C      = A_ij * B_ji
   X           ddot  (const tensor2d<X> &B) const; // double contract.: C      = A_ij * B_ji
@@ -90,6 +91,16 @@ public:
   X           det   ()                     const; // determinant (only in 2D/3D)
   tensor2s<X> inv   ()                     const; // inverse     (only in 2D/3D)
 
+  // eigen-decomposition: "A = vec * diag(val) * vec^T", eigenvalues in ascending order
+  void        eig        (vector<X> &val, tensor2<X> &vec) const;
+  vector<X>   eigenvalues()                               const;
+
+  // isotropic tensor functions (with derivative: see "cppmat::cartesian::log", etc.)
+  tensor2s<X> log        ()                               const; // matrix logarithm
+  tensor2s<X> exp        ()                               const; // matrix exponential
+  tensor2s<X> sqrt       ()                               const; // matrix square root
+  tensor2s<X> pow        (X p)                            const; // matrix power
+
 };
 
 // =================================================================================================
@@ -274,6 +274,15 @@ tensor2<X> tensor2s<X>::ddot(const tensor4<X> &B) const
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename X>
+inline
+tensor2s<X> tensor2s<X>::ddot(const tensor4s<X> &B) const
+{
+  return cppmat::cartesian::ddot(*this, B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename X>
 inline
 X tensor2s<X>::ddot(const tensor2<X> &B) const
@@ -402,6 +411,64 @@ tensor2s<X> tensor2s<X>::inv() const
   return cppmat::cartesian::inv(*this);
 }
 
+// =================================================================================================
+// eigen-decomposition
+// =================================================================================================
+
+template<typename X>
+inline
+void tensor2s<X>::eig(vector<X> &val, tensor2<X> &vec) const
+{
+  cppmat::cartesian::eig(*this, val, vec);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X> tensor2s<X>::eigenvalues() const
+{
+  return cppmat::cartesian::eigenvalues(*this);
+}
+
+// =================================================================================================
+// isotropic tensor functions
+// =================================================================================================
+
+template<typename X>
+inline
+tensor2s<X> tensor2s<X>::log() const
+{
+  return cppmat::cartesian::log(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2s<X> tensor2s<X>::exp() const
+{
+  return cppmat::cartesian::exp(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2s<X> tensor2s<X>::sqrt() const
+{
+  return cppmat::cartesian::sqrt(*this);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor2s<X> tensor2s<X>::pow(X p) const
+{
+  return cppmat::cartesian::pow(*this, p);
+}
+
 // =================================================================================================
 
 }} // namespace ...
@@ -28,6 +28,10 @@ protected:
   // local variables
   size_t ND=0; // number of dimensions (== mShape[0] == mShape[1] == ...)
 
+  // inline storage: a 2-d or 3-d tensor4 is stored without allocation
+  static const size_t INLINE=81;
+  cppmat::Private::inline_buffer<X,INLINE> mInline;
+
 private:
 
   // hide functions
@@ -36,7 +40,13 @@ private:
 public:
 
   // constructor: default
-  tensor4() = default;
+  tensor4();
+
+  // copy/move: the entries are stored in the own inline storage if they fit
+  tensor4(const tensor4<X> &A);
+  tensor4(tensor4<X> &&A) noexcept;
+  tensor4<X>& operator=(const tensor4<X> &A) = default;
+  tensor4<X>& operator=(tensor4<X> &&A) = default;
 
   // constructor: allocate, don't initialize
   tensor4(size_t nd);
@@ -45,6 +55,13 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   tensor4(const cppmat::array<U> &A);
 
+  // constructor: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  tensor4(const E &A);
+
+  // constructor: convert from Mandel storage
+  tensor4(const cppmat::cartesian::tensor4s<X> &A);
+
   // constructor: copy from fixed size
   template<size_t nd> tensor4(const cppmat::tiny::cartesian::tensor4<X,nd> &A);
 
@@ -22,9 +22,41 @@ namespace cartesian {
 
 template<typename X>
 inline
-tensor4<X>::tensor4(size_t nd) : cppmat::array<X>({nd,nd,nd,nd})
+tensor4<X>::tensor4() : cppmat::array<X>(mInline)
 {
-  ND = nd;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X>::tensor4(size_t nd) : cppmat::array<X>(mInline)
+{
+  resize(nd);
+}
+
+// =================================================================================================
+// constructors: copy/move
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4<X>::tensor4(const tensor4<X> &A) : cppmat::array<X>(mInline)
+{
+  cppmat::array<X>::operator=(A);
+
+  ND = A.ND;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4<X>::tensor4(tensor4<X> &&A) noexcept : cppmat::array<X>(mInline)
+{
+  cppmat::array<X>::operator=(std::move(A));
+
+  ND = A.ND;
 }
 
 // =================================================================================================
@@ -34,13 +66,46 @@ tensor4<X>::tensor4(size_t nd) : cppmat::array<X>({nd,nd,nd,nd})
 template<typename X>
 template<typename U, typename V>
 inline
-tensor4<X>::tensor4(const cppmat::array<U> &A) : cppmat::array<X>(A)
+tensor4<X>::tensor4(const cppmat::array<U> &A) : cppmat::array<X>(mInline)
+{
+  cppmat::array<X>::resize(A.shape());
+
+  Assert( this->mRank == 4 );
+
+  this->setCopy(A.begin(), A.end());
+
+  ND = this->mShape[0];
+}
+
+// =================================================================================================
+// constructors: evaluate expression
+// =================================================================================================
+
+template<typename X>
+template<class E, typename V>
+inline
+tensor4<X>::tensor4(const E &A) : cppmat::array<X>(mInline)
 {
+  cppmat::array<X>::resize(A.shape());
+
   Assert( this->mRank == 4 );
 
+  cppmat::expr::assign(this->data(), A);
+
   ND = this->mShape[0];
 }
 
+// =================================================================================================
+// constructors: convert from Mandel storage
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4<X>::tensor4(const cppmat::cartesian::tensor4s<X> &A) : tensor4<X>(A.ndim())
+{
+  cppmat::Private::mandel_to_tensor4(ND, A.data(), this->data());
+}
+
 // =================================================================================================
 // constructors: copy from fixed size
 // =================================================================================================
@@ -48,9 +113,11 @@ tensor4<X>::tensor4(const cppmat::array<U> &A) : cppmat::array<X>(A)
 template<typename X>
 template<size_t nd>
 inline
-tensor4<X>::tensor4(const cppmat::tiny::cartesian::tensor4<X,nd> &A) : cppmat::array<X>(A)
+tensor4<X>::tensor4(const cppmat::tiny::cartesian::tensor4<X,nd> &A) : cppmat::array<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(nd);
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
@@ -60,9 +127,11 @@ tensor4<X>::tensor4(const cppmat::tiny::cartesian::tensor4<X,nd> &A) : cppmat::a
 template<typename X>
 template<size_t nd>
 inline
-tensor4<X>::tensor4(const cppmat::view::cartesian::tensor4<X,nd> &A) : cppmat::array<X>(A)
+tensor4<X>::tensor4(const cppmat::view::cartesian::tensor4<X,nd> &A) : cppmat::array<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(nd);
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
@@ -0,0 +1,122 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_TENSOR4S_H
+#define CPPMAT_VAR_CARTESIAN_TENSOR4S_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// Mandel notation of a fourth-order tensor with minor and major symmetry, on plain storage
+// - the components of a symmetric second-order tensor are numbered as its storage ("tensor2s"):
+//   "a" is the position of (i,j) in the upper triangle (row-major), and "nm = nd*(nd+1)/2"
+// - the Mandel matrix "M_ab = w_a * w_b * A_ijkl" (with a = (i,j), b = (k,l), and w = 1 on the
+//   diagonal, sqrt(2) off the diagonal) is symmetric, and is stored as "symmetric::matrix" (of
+//   shape [nm, nm])
+// =================================================================================================
+
+// number of independent components of a symmetric second-order tensor
+size_t mandel_size(size_t nd);
+
+// position of (i,j) in the upper triangle (row-major) of a symmetric "n x n" matrix
+size_t mandel_index(size_t i, size_t j, size_t n);
+
+// number of dimensions from the number of independent components (inverse of "mandel_size")
+size_t mandel_ndim(size_t nm);
+
+// convert: tensor4 (minor and major symmetry are assumed) -> Mandel matrix
+template<typename X> void mandel_from_tensor4(size_t nd, const X *A, X *M);
+
+// convert: Mandel matrix -> tensor4
+template<typename X> void mandel_to_tensor4(size_t nd, const X *M, X *A);
+
+// Mandel matrix of "is * Is + ii * II"
+template<typename X> void mandel_unit(size_t nd, X is, X ii, X *M);
+
+// double contraction with a symmetric second-order tensor: C_ij = A_ijkl * B_lk
+template<typename X> void mandel_ddot(size_t nd, const X *M, const X *B, X *C);
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+
+// =================================================================================================
+// cppmat::cartesian::tensor4s - fourth-order tensor with minor and major symmetry, e.g. a
+// stiffness tensor, stored as its (packed) Mandel matrix
+// =================================================================================================
+
+template<typename X>
+class tensor4s : public cppmat::symmetric::matrix<X>
+{
+protected:
+
+  // local variables
+  size_t ND=0; // number of dimensions (mShape[0] == mShape[1] == ND*(ND+1)/2)
+
+public:
+
+  // constructor: default
+  tensor4s() = default;
+
+  // constructor: allocate, don't initialize
+  tensor4s(size_t nd);
+
+  // constructor: copy from parent (with different type)
+  template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
+  tensor4s(const cppmat::symmetric::matrix<U> &A);
+
+  // constructor: convert from full storage (minor and major symmetry are assumed)
+  explicit tensor4s(const cppmat::cartesian::tensor4<X> &A);
+
+  // constructor: copy from fixed size
+  template<size_t nd> tensor4s(const cppmat::tiny::cartesian::tensor4s<X,nd> &A);
+
+  // constructor: copy from view
+  template<size_t nd> tensor4s(const cppmat::view::cartesian::tensor4s<X,nd> &A);
+
+  // named constructor: initialize
+  static tensor4s<X> Random(size_t nd, X lower=(X)0, X upper=(X)1);
+  static tensor4s<X> Zero  (size_t nd);
+  static tensor4s<X> Is    (size_t nd);
+  static tensor4s<X> Isd   (size_t nd);
+  static tensor4s<X> II    (size_t nd);
+
+  // resize
+  void resize(size_t nd);
+
+  // get dimensions
+  size_t ndim() const;
+
+  // initialize
+  void setIs();
+  void setIsd();
+  void setII();
+
+  // tensor products / operations
+  tensor2s<X> ddot(const tensor2s<X> &B) const; // double contract.: C_ij = A_ijkl * B_lk
+
+};
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,370 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_CARTESIAN_TENSOR4S_HPP
+#define CPPMAT_VAR_CARTESIAN_TENSOR4S_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace Private {
+
+// =================================================================================================
+// Mandel notation
+// =================================================================================================
+
+inline size_t mandel_size(size_t nd)
+{
+  return nd * (nd+1) / 2;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline size_t mandel_index(size_t i, size_t j, size_t n)
+{
+  if ( i > j ) std::swap(i, j);
+
+  return i * n - ( i * (i+1) ) / 2 + j;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+inline size_t mandel_ndim(size_t nm)
+{
+  size_t nd = 0;
+
+  while ( mandel_size(nd) < nm ) ++nd;
+
+  Assert( mandel_size(nd) == nm );
+
+  return nd;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void mandel_from_tensor4(size_t nd, const X *A, X *M)
+{
+  const X sq2 = std::sqrt(static_cast<X>(2));
+
+  size_t m = 0;
+  size_t a = 0;
+
+  // loop over the upper triangle of "M" (row-major), i.e. its storage
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = i ; j < nd ; ++j ) {
+      size_t b = 0;
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = k ; l < nd ; ++l ) {
+          if ( b >= a ) {
+            X w = ( i == j ? static_cast<X>(1) : sq2 ) * ( k == l ? static_cast<X>(1) : sq2 );
+            M[m] = w * A[((i*nd+j)*nd+k)*nd+l];
+            ++m;
+          }
+          ++b;
+        }
+      }
+      ++a;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void mandel_to_tensor4(size_t nd, const X *M, X *A)
+{
+  const X sq2 = std::sqrt(static_cast<X>(2));
+
+  size_t nm = mandel_size(nd);
+
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = 0 ; j < nd ; ++j ) {
+      size_t a  = mandel_index(i, j, nd);
+      X      wa = ( i == j ? static_cast<X>(1) : sq2 );
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = 0 ; l < nd ; ++l ) {
+          size_t b  = mandel_index(k, l, nd);
+          X      wb = ( k == l ? static_cast<X>(1) : sq2 );
+          A[((i*nd+j)*nd+k)*nd+l] = M[mandel_index(a, b, nm)] / ( wa * wb );
+        }
+      }
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void mandel_unit(size_t nd, X is, X ii, X *M)
+{
+  size_t m = 0;
+  size_t a = 0;
+
+  // "Is" is the identity matrix, "II" is one for each pair of diagonal components
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = i ; j < nd ; ++j ) {
+      size_t b = 0;
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = k ; l < nd ; ++l ) {
+          if ( b >= a ) {
+            M[m] = static_cast<X>(0);
+            if ( a == b          ) M[m] += is;
+            if ( i == j && k == l ) M[m] += ii;
+            ++m;
+          }
+          ++b;
+        }
+      }
+      ++a;
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void mandel_ddot(size_t nd, const X *M, const X *B, X *C)
+{
+  const X sq2 = std::sqrt(static_cast<X>(2));
+
+  size_t nm = mandel_size(nd);
+  size_t a  = 0;
+
+  // c = M * b, with "b_b = w_b * B_b" and "C_a = c_a / w_a"
+  for ( size_t i = 0 ; i < nd ; ++i ) {
+    for ( size_t j = i ; j < nd ; ++j ) {
+      X      c = static_cast<X>(0);
+      size_t b = 0;
+      for ( size_t k = 0 ; k < nd ; ++k ) {
+        for ( size_t l = k ; l < nd ; ++l ) {
+          c += M[mandel_index(a, b, nm)] * ( k == l ? B[b] : sq2 * B[b] );
+          ++b;
+        }
+      }
+      C[a] = ( i == j ? c : c / sq2 );
+      ++a;
+    }
+  }
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace cartesian {
+
+// =================================================================================================
+// constructors
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4s<X>::tensor4s(size_t nd) :
+  cppmat::symmetric::matrix<X>(cppmat::Private::mandel_size(nd),cppmat::Private::mandel_size(nd))
+{
+  ND = nd;
+}
+
+// =================================================================================================
+// constructors: copy from parent (with different type)
+// =================================================================================================
+
+template<typename X>
+template<typename U, typename V>
+inline
+tensor4s<X>::tensor4s(const cppmat::symmetric::matrix<U> &A) : cppmat::symmetric::matrix<X>(A)
+{
+  ND = cppmat::Private::mandel_ndim(this->N);
+}
+
+// =================================================================================================
+// constructors: convert from full storage
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4s<X>::tensor4s(const cppmat::cartesian::tensor4<X> &A) : tensor4s<X>(A.ndim())
+{
+  cppmat::Private::mandel_from_tensor4(ND, A.data(), this->data());
+}
+
+// =================================================================================================
+// constructors: copy from fixed size
+// =================================================================================================
+
+template<typename X>
+template<size_t nd>
+inline
+tensor4s<X>::tensor4s(const cppmat::tiny::cartesian::tensor4s<X,nd> &A) : cppmat::symmetric::matrix<X>(A)
+{
+  ND = nd;
+}
+
+// =================================================================================================
+// constructors: copy from view
+// =================================================================================================
+
+template<typename X>
+template<size_t nd>
+inline
+tensor4s<X>::tensor4s(const cppmat::view::cartesian::tensor4s<X,nd> &A) : cppmat::symmetric::matrix<X>(A)
+{
+  ND = nd;
+}
+
+// =================================================================================================
+// named constructors
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4s<X> tensor4s<X>::Random(size_t nd, X lower, X upper)
+{
+  tensor4s<X> out(nd);
+
+  out.setRandom(lower, upper);
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4s<X> tensor4s<X>::Zero(size_t nd)
+{
+  tensor4s<X> out(nd);
+
+  out.setZero();
+
+  return out;
+}
+
+// =================================================================================================
+// named constructors: identity tensors
+// =================================================================================================
+
+template<typename X>
+inline
+tensor4s<X> tensor4s<X>::Is(size_t nd)
+{
+  tensor4s<X> out(nd);
+
+  out.setIs();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4s<X> tensor4s<X>::Isd(size_t nd)
+{
+  tensor4s<X> out(nd);
+
+  out.setIsd();
+
+  return out;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+tensor4s<X> tensor4s<X>::II(size_t nd)
+{
+  tensor4s<X> out(nd);
+
+  out.setII();
+
+  return out;
+}
+
+// =================================================================================================
+// resize
+// =================================================================================================
+
+template<typename X>
+inline
+void tensor4s<X>::resize(size_t nd)
+{
+  ND = nd;
+
+  cppmat::symmetric::matrix<X>::resize(cppmat::Private::mandel_size(nd),cppmat::Private::mandel_size(nd));
+}
+
+// =================================================================================================
+// dimensions
+// =================================================================================================
+
+template<typename X>
+inline
+size_t tensor4s<X>::ndim() const
+{
+  return ND;
+}
+
+// =================================================================================================
+// initialize: identity tensors
+// =================================================================================================
+
+template<typename X>
+inline
+void tensor4s<X>::setIs()
+{
+  cppmat::Private::mandel_unit(ND, static_cast<X>(1), static_cast<X>(0), this->data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void tensor4s<X>::setIsd()
+{
+  cppmat::Private::mandel_unit(ND, static_cast<X>(1), static_cast<X>(-1)/static_cast<X>(ND), this->data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void tensor4s<X>::setII()
+{
+  cppmat::Private::mandel_unit(ND, static_cast<X>(0), static_cast<X>(1), this->data());
+}
+
+// =================================================================================================
+// tensor products
+// =================================================================================================
+
+template<typename X>
+inline
+tensor2s<X> tensor4s<X>::ddot(const tensor2s<X> &B) const
+{
+  return cppmat::cartesian::ddot(*this, B);
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
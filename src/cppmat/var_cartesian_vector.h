@@ -28,10 +28,20 @@ protected:
   // local variables
   size_t ND=0; // number of dimensions (== mShape[0] == mShape[1])
 
+  // inline storage: a 2-d or 3-d vector is stored without allocation
+  static const size_t INLINE=3;
+  cppmat::Private::inline_buffer<X,INLINE> mInline;
+
 public:
 
   // constructor: default
-  vector() = default;
+  vector();
+
+  // copy/move: the entries are stored in the own inline storage if they fit
+  vector(const vector<X> &A);
+  vector(vector<X> &&A) noexcept;
+  vector<X>& operator=(const vector<X> &A) = default;
+  vector<X>& operator=(vector<X> &&A) = default;
 
   // constructor: allocate, don't initialize
   vector(size_t nd);
@@ -40,6 +50,10 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   vector(const cppmat::array<U> &A);
 
+  // constructor: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  vector(const E &A);
+
   // constructor: copy from other classes
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   vector(const std::vector<U> &A);
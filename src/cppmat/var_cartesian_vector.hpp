@@ -22,9 +22,41 @@ namespace cartesian {
 
 template<typename X>
 inline
-vector<X>::vector(size_t nd) : cppmat::vector<X>(nd)
+vector<X>::vector() : cppmat::vector<X>(mInline)
 {
-  ND = nd;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X>::vector(size_t nd) : cppmat::vector<X>(mInline)
+{
+  resize(nd);
+}
+
+// =================================================================================================
+// constructors: copy/move
+// =================================================================================================
+
+template<typename X>
+inline
+vector<X>::vector(const vector<X> &A) : cppmat::vector<X>(mInline)
+{
+  cppmat::array<X>::operator=(A);
+
+  ND = A.ND;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X>::vector(vector<X> &&A) noexcept : cppmat::vector<X>(mInline)
+{
+  cppmat::array<X>::operator=(std::move(A));
+
+  ND = A.ND;
 }
 
 // =================================================================================================
@@ -34,8 +66,32 @@ vector<X>::vector(size_t nd) : cppmat::vector<X>(nd)
 template<typename X>
 template<typename U, typename V>
 inline
-vector<X>::vector(const cppmat::array<U> &A) : cppmat::vector<X>(A)
+vector<X>::vector(const cppmat::array<U> &A) : cppmat::vector<X>(mInline)
 {
+  cppmat::array<X>::resize(A.shape());
+
+  Assert( this->mRank == 1 );
+
+  this->setCopy(A.begin(), A.end());
+
+  ND = this->mShape[0];
+}
+
+// =================================================================================================
+// constructors: evaluate expression
+// =================================================================================================
+
+template<typename X>
+template<class E, typename V>
+inline
+vector<X>::vector(const E &A) : cppmat::vector<X>(mInline)
+{
+  cppmat::array<X>::resize(A.shape());
+
+  Assert( this->mRank == 1 );
+
+  cppmat::expr::assign(this->data(), A);
+
   ND = this->mShape[0];
 }
 
@@ -46,9 +102,11 @@ vector<X>::vector(const cppmat::array<U> &A) : cppmat::vector<X>(A)
 template<typename X>
 template<typename U, typename V>
 inline
-vector<X>::vector(const std::vector<U> &A) : cppmat::vector<X>(A)
+vector<X>::vector(const std::vector<U> &A) : cppmat::vector<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(A.size());
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
@@ -58,9 +116,11 @@ vector<X>::vector(const std::vector<U> &A) : cppmat::vector<X>(A)
 template<typename X>
 template<size_t nd>
 inline
-vector<X>::vector(const cppmat::tiny::cartesian::vector<X,nd> &A) : cppmat::array<X>(A)
+vector<X>::vector(const cppmat::tiny::cartesian::vector<X,nd> &A) : cppmat::vector<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(nd);
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
@@ -70,9 +130,11 @@ vector<X>::vector(const cppmat::tiny::cartesian::vector<X,nd> &A) : cppmat::arra
 template<typename X>
 template<size_t nd>
 inline
-vector<X>::vector(const cppmat::view::cartesian::vector<X,nd> &A) : cppmat::array<X>(A)
+vector<X>::vector(const cppmat::view::cartesian::vector<X,nd> &A) : cppmat::vector<X>(mInline)
 {
-  ND = this->mShape[0];
+  resize(nd);
+
+  this->setCopy(A.begin(), A.end());
 }
 
 // =================================================================================================
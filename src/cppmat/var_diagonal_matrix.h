@@ -25,12 +25,16 @@ class matrix
 {
 protected:
 
-  size_t              mSize=0;          // total size == data.size()
-  static const size_t mRank=2;          // rank (number of axes)
-  size_t              N=0;              // number of rows/columns
-  std::vector<X>      mData;            // data container
-  X                   mZero[1];         // pointer to a zero entry
-  bool                mPeriodic=false;  // if true: disable bounds-check where possible
+  // allocator of the data container: aligned to "CPPMAT_ALIGN" bytes, to favour vectorization
+  typedef cppmat::aligned_allocator<X> Allocator;
+
+  static const size_t              INLINE=3;        // entries stored without allocation (3-d tensor2d)
+  size_t                           mSize=0;         // total size == data.size()
+  static const size_t              mRank=2;         // rank (number of axes)
+  size_t                           N=0;             // number of rows/columns
+  small_vector<X,INLINE,Allocator> mData;           // data container
+  X                                mZero[1];        // pointer to a zero entry
+  bool                             mPeriodic=false; // if true: disable bounds-check where possible
 
 public:
 
@@ -752,17 +752,7 @@ template<typename X>
 inline
 void matrix<X>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  cppmat::random::fillUniform(begin(), end(), lower, upper);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -981,8 +971,7 @@ matrix<X> matrix<X>::operator- () const
 {
   matrix<X> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out[i] = -mData[i];
+  Private::transform(out.data(), mData.data(), mSize, [](const X &a) { return -a; });
 
   return out;
 }
@@ -1013,8 +1002,7 @@ matrix<X>& matrix<X>::operator*= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a * b; });
 
   return *this;
 }
@@ -1029,8 +1017,7 @@ matrix<X>& matrix<X>::operator+= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] += B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a + b; });
 
   return *this;
 }
@@ -1045,8 +1032,7 @@ matrix<X>& matrix<X>::operator-= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] -= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a - b; });
 
   return *this;
 }
@@ -1057,8 +1043,7 @@ template<typename X>
 inline
 matrix<X>& matrix<X>::operator*= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a * b; });
 
   return *this;
 }
@@ -1069,8 +1054,7 @@ template<typename X>
 inline
 matrix<X>& matrix<X>::operator/= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] /= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a / b; });
 
   return *this;
 }
@@ -1085,8 +1069,7 @@ matrix<X> matrix<X>::abs() const
 {
   matrix<X> out(N, N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out[i] = std::abs(mData[i]);
+  Private::transform(out.data(), mData.data(), mSize, [](const X &a) { return std::abs(a); });
 
   return out;
 }
@@ -1099,12 +1082,7 @@ template<typename X>
 inline
 X matrix<X>::norm() const
 {
-  X out = static_cast<X>(0);
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out += std::abs(mData[i]);
-
-  return out;
+  return Private::norm(mData.data(), mSize);
 }
 
 // =================================================================================================
@@ -1168,7 +1146,7 @@ template<typename X>
 inline
 X matrix<X>::sum() const
 {
-  return std::accumulate(begin(), end(), static_cast<X>(0));
+  return Private::sum(mData.data(), mSize);
 }
 
 // =================================================================================================
@@ -1202,11 +1180,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a == D); });
 
   return out;
 }
@@ -1217,11 +1194,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::not_equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a != D); });
 
   return out;
 }
@@ -1232,11 +1208,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::greater(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a > D); });
 
   return out;
 }
@@ -1247,11 +1222,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::greater_equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a >= D); });
 
   return out;
 }
@@ -1262,11 +1236,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::less(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a < D); });
 
   return out;
 }
@@ -1277,11 +1250,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::less_equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a <= D); });
 
   return out;
 }
@@ -1295,11 +1267,10 @@ matrix<int> matrix<X>::equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a == b); });
 
   return out;
 }
@@ -1313,11 +1284,10 @@ matrix<int> matrix<X>::not_equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a != b); });
 
   return out;
 }
@@ -1331,11 +1301,10 @@ matrix<int> matrix<X>::greater(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a > b); });
 
   return out;
 }
@@ -1349,11 +1318,10 @@ matrix<int> matrix<X>::greater_equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a >= b); });
 
   return out;
 }
@@ -1367,11 +1335,10 @@ matrix<int> matrix<X>::less(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a < b); });
 
   return out;
 }
@@ -1385,11 +1352,10 @@ matrix<int> matrix<X>::less_equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a <= b); });
 
   return out;
 }
@@ -1402,24 +1368,7 @@ template<typename X>
 inline
 std::vector<size_t> matrix<X>::where() const
 {
-  size_t nnz = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] )
-      ++nnz;
-
-  std::vector<size_t> out(nnz);
-
-  size_t j = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i ) {
-    if ( mData[i] ) {
-      out[j] = i;
-      ++j;
-    }
-  }
-
-  return out;
+  return Private::where(mData.data(), mSize);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1503,11 +1452,7 @@ bool operator!= (const matrix<X> &A, const matrix<X> &B)
   Assert( A.rank () == B.rank () );
   Assert( A.size () == B.size () );
 
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    if ( A[i] != B[i] )
-      return true;
-
-  return false;
+  return not cppmat::Private::all_equal(A.data(), B.data(), A.size());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1520,11 +1465,7 @@ bool operator== (const matrix<X> &A, const matrix<X> &B)
   Assert( A.rank () == B.rank () );
   Assert( A.size () == B.size () );
 
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    if ( A[i] != B[i] )
-      return false;
-
-  return true;
+  return cppmat::Private::all_equal(A.data(), B.data(), A.size());
 }
 
 // =================================================================================================
@@ -1541,8 +1482,8 @@ matrix<X> operator* (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a * b; });
 
   return C;
 }
@@ -1559,8 +1500,8 @@ matrix<X> operator+ (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] + B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a + b; });
 
   return C;
 }
@@ -1577,8 +1518,8 @@ matrix<X> operator- (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] - B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a - b; });
 
   return C;
 }
@@ -1591,8 +1532,8 @@ matrix<X> operator* (const matrix<X> &A, const X &B)
 {
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B;
+  Private::transform(C.data(), A.data(), C.size(),
+    [&B](const X &a) { return a * B; });
 
   return C;
 }
@@ -1605,8 +1546,8 @@ matrix<X> operator/ (const matrix<X> &A, const X &B)
 {
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] / B;
+  Private::transform(C.data(), A.data(), C.size(),
+    [&B](const X &a) { return a / B; });
 
   return C;
 }
@@ -1619,8 +1560,8 @@ matrix<X> operator* (const X &A, const matrix<X> &B)
 {
   matrix<X> C(B.shape(0),B.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A * B[i];
+  Private::transform(C.data(), B.data(), C.size(),
+    [&A](const X &b) { return A * b; });
 
   return C;
 }
@@ -24,13 +24,42 @@ class array
 {
 protected:
 
-  static const size_t MAX_DIM=6;    // maximum number of dimensions
-  size_t         mSize=0;           // total size == data.size() == prod(shape)
-  size_t         mRank=0;           // rank (number of axes)
-  size_t         mShape[MAX_DIM];   // number of entries along each axis
-  size_t         mStrides[MAX_DIM]; // stride length for each index
-  std::vector<X> mData;             // data container
-  bool           mPeriodic=false;   // if true: disable bounds-check where possible
+  // allocator of the data container: aligned to "CPPMAT_ALIGN" bytes, to favour vectorization
+  typedef cppmat::aligned_allocator<X> Allocator;
+
+  static const size_t         MAX_DIM=6;         // maximum number of dimensions
+  size_t                      mSize=0;           // total size == data.size() == prod(shape)
+  size_t                      mRank=0;           // rank (number of axes)
+  size_t                      mShape[MAX_DIM];   // number of entries along each axis
+  size_t                      mStrides[MAX_DIM]; // stride length for each index
+  small_vector<X,0,Allocator> mData;             // data container (inline storage: see below)
+  bool                        mPeriodic=false;   // if true: disable bounds-check where possible
+
+  // constructor: empty, storing up to "buffer.size()" entries in "buffer" (without allocation)
+  // - used by derived classes that provide inline storage sized for them (e.g. 9 entries for a 3-d
+  //   "cppmat::cartesian::tensor2"), by default all storage is allocated
+  array(cppmat::Private::inline_buffer<X,0> buffer);
+
+  // convert array-index along an axis to a positive index (in the range [0, n)):
+  // - a negative index counts down from the last index
+  // - the periodic wrap (integer division) is only applied if periodicity is enabled
+  size_t wrap(int a, int n) const;
+
+  // reduce along one or more axes in a single pass over the data (in row-major order):
+  // the rows along the last axis are passed as blocks, "func(in, n, j, dj, k, dk)", whereby the
+  // entries "in[f]" (with "f < n") belong to output entry "j+f*dj", and have flat index "k+f*dk"
+  // in the reduced axes
+  template<class F> void reduce(const std::vector<size_t> &axes, F func) const;
+
+  // reduction: support functions
+  std::vector<size_t> reduce_axes (const std::vector<int>    &axes) const;
+  std::vector<size_t> reduce_shape(const std::vector<size_t> &axes) const;
+
+  // reduction: implementation
+  array<X> reduce_sum(const std::vector<size_t> &axes) const;
+  array<X> reduce_min(const std::vector<size_t> &axes) const;
+  array<X> reduce_max(const std::vector<size_t> &axes) const;
+  template<class Compare> array<size_t> reduce_arg(size_t axis, Compare cmp) const;
 
 public:
 
@@ -52,6 +81,14 @@ public:
   template<size_t rank, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n>
   array(const cppmat::view::array<X,rank,i,j,k,l,m,n> &A);
 
+  // constructor: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  array(const E &A);
+
+  // assignment: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  array<X>& operator= (const E &A);
+
   // named constructor: initialize
   static array<X> Random  (const std::vector<size_t> &shape, X lower=(X)0, X upper=(X)1);
   static array<X> Arange  (const std::vector<size_t> &shape);
@@ -268,6 +305,10 @@ public:
     const std::vector<int> &e=std::vector<int>(), const std::vector<int> &f=std::vector<int>()
   ) const;
 
+  // view of the data, allowing (strided) slicing without copy; see "cppmat::view::strided"
+  cppmat::view::strided<X>       strided();
+  cppmat::view::strided<const X> strided() const;
+
   // return padded array
   array<X> pad(const std::vector<size_t> &pad_width, X D=static_cast<X>(0));
 
@@ -307,6 +348,19 @@ public:
   array<X>& operator+= (X B);
   array<X>& operator-= (X B);
 
+  // arithmetic operators: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  array<X>& operator*= (const E &B);
+
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  array<X>& operator/= (const E &B);
+
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  array<X>& operator+= (const E &B);
+
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  array<X>& operator-= (const E &B);
+
   // absolute value
   array<X> abs() const;
 
@@ -320,6 +374,12 @@ public:
   size_t argmin() const;
   size_t argmax() const;
 
+  // location of the minimum/maximum along an axis: index along that axis
+  array<size_t> argmin(int    axis) const;
+  array<size_t> argmin(size_t axis) const;
+  array<size_t> argmax(int    axis) const;
+  array<size_t> argmax(size_t axis) const;
+
   // minimum
   X        min() const;
   array<X> min(int    axis) const;
@@ -375,19 +435,8 @@ public:
 template<typename X> bool operator!= (const array<X> &A, const array<X> &B);
 template<typename X> bool operator== (const array<X> &A, const array<X> &B);
 
-// external arithmetic operators
-template<typename X> array<X> operator* (const array<X> &A, const array<X> &B);
-template<typename X> array<X> operator/ (const array<X> &A, const array<X> &B);
-template<typename X> array<X> operator+ (const array<X> &A, const array<X> &B);
-template<typename X> array<X> operator- (const array<X> &A, const array<X> &B);
-template<typename X> array<X> operator* (const array<X> &A, const       X  &B);
-template<typename X> array<X> operator/ (const array<X> &A, const       X  &B);
-template<typename X> array<X> operator+ (const array<X> &A, const       X  &B);
-template<typename X> array<X> operator- (const array<X> &A, const       X  &B);
-template<typename X> array<X> operator* (const       X  &A, const array<X> &B);
-template<typename X> array<X> operator/ (const       X  &A, const array<X> &B);
-template<typename X> array<X> operator+ (const       X  &A, const array<X> &B);
-template<typename X> array<X> operator- (const       X  &A, const array<X> &B);
+// external arithmetic operators: return an expression that is evaluated on assignment,
+// see "expression.h"
 
 // print operator
 template<typename X> std::ostream& operator<<(std::ostream& out, const array<X>& src);
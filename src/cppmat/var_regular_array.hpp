@@ -26,6 +26,14 @@ array<X>::array(const std::vector<size_t> &shape)
   resize(shape);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X>::array(cppmat::Private::inline_buffer<X,0> buffer) : mData(buffer)
+{
+}
+
 // =================================================================================================
 // constructors: copy from own class (with different type)
 // =================================================================================================
@@ -69,6 +77,45 @@ array<X>::array(const cppmat::view::array<X,RANK,I,J,K,L,M,N> &A)
   setCopy(A.begin(), A.end());
 }
 
+// =================================================================================================
+// constructors: evaluate expression
+// =================================================================================================
+
+template<typename X>
+template<class E, typename V>
+inline
+array<X>::array(const E &A)
+{
+  resize(A.shape());
+
+  cppmat::expr::assign(mData.data(), A);
+}
+
+// =================================================================================================
+// assignment: evaluate expression
+// =================================================================================================
+
+template<typename X>
+template<class E, typename V>
+inline
+array<X>& array<X>::operator= (const E &A)
+{
+  // size changes: evaluate to new storage (the expression may reference the current storage)
+  if ( A.size() != mSize )
+  {
+    (*this) = array<X>(A);
+    return *this;
+  }
+
+  // update shape, the storage is unchanged
+  resize(A.shape());
+
+  // evaluate in a single loop
+  cppmat::expr::assign(mData.data(), A);
+
+  return *this;
+}
+
 // =================================================================================================
 // named constructors
 // =================================================================================================
@@ -326,6 +373,19 @@ void array<X>::setPeriodic(bool periodic)
   mPeriodic = periodic;
 }
 
+// =================================================================================================
+// index operators : positive (periodic) index
+// =================================================================================================
+
+template<typename X>
+inline
+size_t array<X>::wrap(int a, int n) const
+{
+  if ( mPeriodic ) return static_cast<size_t>( (n+(a%n)) % n );
+
+  return static_cast<size_t>( a < 0 ? a+n : a );
+}
+
 // =================================================================================================
 // get dimensions
 // =================================================================================================
@@ -519,7 +579,7 @@ X& array<X>::operator()(int a)
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return mData[\
     A * mStrides[0]];
@@ -535,7 +595,7 @@ const X& array<X>::operator()(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return mData[\
     A * mStrides[0]];
@@ -553,8 +613,8 @@ X& array<X>::operator()(int a, int b)
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return mData[\
     A * mStrides[0] +\
@@ -573,8 +633,8 @@ const X& array<X>::operator()(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return mData[\
     A * mStrides[0] +\
@@ -595,9 +655,9 @@ X& array<X>::operator()(int a, int b, int c)
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return mData[\
     A * mStrides[0] +\
@@ -619,9 +679,9 @@ const X& array<X>::operator()(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return mData[\
     A * mStrides[0] +\
@@ -645,10 +705,10 @@ X& array<X>::operator()(int a, int b, int c, int d)
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return mData[\
     A * mStrides[0] +\
@@ -673,10 +733,10 @@ const X& array<X>::operator()(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return mData[\
     A * mStrides[0] +\
@@ -703,11 +763,11 @@ X& array<X>::operator()(int a, int b, int c, int d, int e)
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return mData[\
     A * mStrides[0] +\
@@ -735,11 +795,11 @@ const X& array<X>::operator()(int a, int b, int c, int d, int e) const
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return mData[\
     A * mStrides[0] +\
@@ -769,12 +829,12 @@ X& array<X>::operator()(int a, int b, int c, int d, int e, int f)
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return mData[\
     A * mStrides[0] +\
@@ -805,12 +865,12 @@ const X& array<X>::operator()(int a, int b, int c, int d, int e, int f) const
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return mData[\
     A * mStrides[0] +\
@@ -1117,7 +1177,7 @@ size_t array<X>::compress(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return A * mStrides[0];
 }
@@ -1134,8 +1194,8 @@ size_t array<X>::compress(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return A * mStrides[0] +\
          B * mStrides[1];
@@ -1155,9 +1215,9 @@ size_t array<X>::compress(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1180,10 +1240,10 @@ size_t array<X>::compress(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1209,11 +1269,11 @@ size_t array<X>::compress(int a, int b, int c, int d, int e) const
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1242,12 +1302,12 @@ size_t array<X>::compress(int a, int b, int c, int d, int e, int f) const
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return A * mStrides[0] +\
          B * mStrides[1] +\
@@ -1518,7 +1578,7 @@ auto array<X>::item(int a)
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return begin() +
     A * mStrides[0];
@@ -1534,7 +1594,7 @@ auto array<X>::item(int a) const
 
   Assert( ( a < na && a >= -na ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
+  size_t A = wrap(a, na);
 
   return begin() +
     A * mStrides[0];
@@ -1552,8 +1612,8 @@ auto array<X>::item(int a, int b)
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return begin() +
     A * mStrides[0] +\
@@ -1572,8 +1632,8 @@ auto array<X>::item(int a, int b) const
   Assert( ( a < na && a >= -na ) or mPeriodic );
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
 
   return begin() +
     A * mStrides[0] +\
@@ -1594,9 +1654,9 @@ auto array<X>::item(int a, int b, int c)
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return begin() +
     A * mStrides[0] +\
@@ -1618,9 +1678,9 @@ auto array<X>::item(int a, int b, int c) const
   Assert( ( b < nb && b >= -nb ) or mPeriodic );
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
 
   return begin() +
     A * mStrides[0] +\
@@ -1644,10 +1704,10 @@ auto array<X>::item(int a, int b, int c, int d)
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return begin() +
     A * mStrides[0] +\
@@ -1672,10 +1732,10 @@ auto array<X>::item(int a, int b, int c, int d) const
   Assert( ( c < nc && c >= -nc ) or mPeriodic );
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
 
   return begin() +
     A * mStrides[0] +\
@@ -1702,11 +1762,11 @@ auto array<X>::item(int a, int b, int c, int d, int e)
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return begin() +
     A * mStrides[0] +\
@@ -1734,11 +1794,11 @@ auto array<X>::item(int a, int b, int c, int d, int e) const
   Assert( ( d < nd && d >= -nd ) or mPeriodic );
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
 
   return begin() +
     A * mStrides[0] +\
@@ -1768,12 +1828,12 @@ auto array<X>::item(int a, int b, int c, int d, int e, int f)
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return begin() +
     A * mStrides[0] +\
@@ -1804,12 +1864,12 @@ auto array<X>::item(int a, int b, int c, int d, int e, int f) const
   Assert( ( e < ne && e >= -ne ) or mPeriodic );
   Assert( ( f < nf && f >= -nf ) or mPeriodic );
 
-  size_t A = static_cast<size_t>( (na+(a%na)) % na );
-  size_t B = static_cast<size_t>( (nb+(b%nb)) % nb );
-  size_t C = static_cast<size_t>( (nc+(c%nc)) % nc );
-  size_t D = static_cast<size_t>( (nd+(d%nd)) % nd );
-  size_t E = static_cast<size_t>( (ne+(e%ne)) % ne );
-  size_t F = static_cast<size_t>( (nf+(f%nf)) % nf );
+  size_t A = wrap(a, na);
+  size_t B = wrap(b, nb);
+  size_t C = wrap(c, nc);
+  size_t D = wrap(d, nd);
+  size_t E = wrap(e, ne);
+  size_t F = wrap(f, nf);
 
   return begin() +
     A * mStrides[0] +\
@@ -2036,6 +2096,28 @@ auto array<X>::item(T a, T b, T c, T d, T e, T f) const
     f * mStrides[5];
 }
 
+// =================================================================================================
+// view without copy
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::view::strided<X> array<X>::strided()
+{
+  return cppmat::view::strided<X>(mData.data(), shape(), std::vector<ptrdiff_t>(
+    std::begin(mStrides), std::begin(mStrides)+mRank));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::view::strided<const X> array<X>::strided() const
+{
+  return cppmat::view::strided<const X>(mData.data(), shape(), std::vector<ptrdiff_t>(
+    std::begin(mStrides), std::begin(mStrides)+mRank));
+}
+
 // =================================================================================================
 // slice
 // =================================================================================================
@@ -2107,13 +2189,18 @@ array<X> array<X>::slice(
   array<X> out(fullshape);
 
   // copy based on selected indices
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    for ( size_t j = 0 ; j < B.size() ; ++j )
+  // (in parallel over the combined first two axes: each range writes its own part of "out")
+  cppmat::Private::parallel_for(A.size()*B.size(), out.size(), [&](size_t begin, size_t end) {
+    for ( size_t ij = begin ; ij < end ; ++ij ) {
+      size_t i = ij / B.size();
+      size_t j = ij % B.size();
       for ( size_t k = 0 ; k < C.size() ; ++k )
         for ( size_t l = 0 ; l < D.size() ; ++l )
           for ( size_t m = 0 ; m < E.size() ; ++m )
             for ( size_t n = 0 ; n < F.size() ; ++n )
               out(i,j,k,l,m,n) = (*this)(A[i],B[j],C[k],D[l],E[m],F[n]);
+    }
+  });
 
   // shape with contraction
   // - allocate
@@ -2217,13 +2304,18 @@ array<X> array<X>::slice(
   array<X> out(fullshape);
 
   // copy based on selected indices
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    for ( size_t j = 0 ; j < B.size() ; ++j )
+  // (in parallel over the combined first two axes: each range writes its own part of "out")
+  cppmat::Private::parallel_for(A.size()*B.size(), out.size(), [&](size_t begin, size_t end) {
+    for ( size_t ij = begin ; ij < end ; ++ij ) {
+      size_t i = ij / B.size();
+      size_t j = ij % B.size();
       for ( size_t k = 0 ; k < C.size() ; ++k )
         for ( size_t l = 0 ; l < D.size() ; ++l )
           for ( size_t m = 0 ; m < E.size() ; ++m )
             for ( size_t n = 0 ; n < F.size() ; ++n )
               out(i,j,k,l,m,n) = (*this)(A[i],B[j],C[k],D[l],E[m],F[n]);
+    }
+  });
 
   // shape with contraction
   // - allocate
@@ -2272,13 +2364,18 @@ array<X> array<X>::pad(const std::vector<size_t> &pad_width, X D)
     pad[i] = pad_width[i];
 
   // place current array in output
-  for ( size_t i = 0 ; i < mShape[0] ; ++i )
-    for ( size_t j = 0 ; j < mShape[1] ; ++j )
+  // (in parallel over the combined first two axes: each range writes its own part of "out")
+  cppmat::Private::parallel_for(mShape[0]*mShape[1], mSize, [&](size_t begin, size_t end) {
+    for ( size_t ij = begin ; ij < end ; ++ij ) {
+      size_t i = ij / mShape[1];
+      size_t j = ij % mShape[1];
       for ( size_t k = 0 ; k < mShape[2] ; ++k )
         for ( size_t l = 0 ; l < mShape[3] ; ++l )
           for ( size_t m = 0 ; m < mShape[4] ; ++m )
             for ( size_t n = 0 ; n < mShape[5] ; ++n )
               out(i+pad[0],j+pad[1],k+pad[2],l+pad[3],m+pad[4],n+pad[5]) = (*this)(i,j,k,l,m,n);
+    }
+  });
 
   return out;
 }
@@ -2291,17 +2388,7 @@ template<typename X>
 inline
 void array<X>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  cppmat::random::fillUniform(begin(), end(), lower, upper);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -2319,7 +2406,7 @@ template<typename X>
 inline
 void array<X>::setZero()
 {
-  std::fill(begin(), end(), static_cast<X>(0));
+  setConstant(static_cast<X>(0));
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -2328,7 +2415,7 @@ template<typename X>
 inline
 void array<X>::setOnes()
 {
-  std::fill(begin(), end(), static_cast<X>(1));
+  setConstant(static_cast<X>(1));
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -2337,7 +2424,11 @@ template<typename X>
 inline
 void array<X>::setConstant(X D)
 {
-  std::fill(begin(), end(), D);
+  X *data = mData.data();
+
+  cppmat::Private::parallel_for(mSize, [=](size_t begin, size_t end) {
+    std::fill(data+begin, data+end, D);
+  });
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -2544,8 +2635,7 @@ array<X> array<X>::operator- () const
 {
   array<X> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out[i] = -mData[i];
+  Private::transform(out.data(), mData.data(), mSize, [](const X &a) { return -a; });
 
   return out;
 }
@@ -2576,8 +2666,7 @@ array<X>& array<X>::operator*= (const array<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a * b; });
 
   return *this;
 }
@@ -2592,8 +2681,7 @@ array<X>& array<X>::operator/= (const array<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] /= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a / b; });
 
   return *this;
 }
@@ -2608,8 +2696,7 @@ array<X>& array<X>::operator+= (const array<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] += B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a + b; });
 
   return *this;
 }
@@ -2624,8 +2711,7 @@ array<X>& array<X>::operator-= (const array<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] -= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a - b; });
 
   return *this;
 }
@@ -2636,8 +2722,7 @@ template<typename X>
 inline
 array<X>& array<X>::operator*= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a * b; });
 
   return *this;
 }
@@ -2648,8 +2733,7 @@ template<typename X>
 inline
 array<X>& array<X>::operator/= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] /= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a / b; });
 
   return *this;
 }
@@ -2660,8 +2744,7 @@ template<typename X>
 inline
 array<X>& array<X>::operator+= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] += B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a + b; });
 
   return *this;
 }
@@ -2672,200 +2755,286 @@ template<typename X>
 inline
 array<X>& array<X>::operator-= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] -= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a - b; });
 
   return *this;
 }
 
 // =================================================================================================
-// absolute value
+// arithmetic operators: evaluate expression
 // =================================================================================================
 
 template<typename X>
+template<class E, typename V>
 inline
-array<X> array<X>::abs() const
+array<X>& array<X>::operator*= (const E &B)
 {
-  array<X> out(shape());
+  Assert( shape() == B.shape() );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out[i] = std::abs(mData[i]);
+  cppmat::expr::assign_mul(mData.data(), B);
 
-  return out;
+  return *this;
 }
 
-// =================================================================================================
-// norm
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
+template<class E, typename V>
 inline
-X array<X>::norm() const
+array<X>& array<X>::operator/= (const E &B)
 {
-  X out = static_cast<X>(0);
+  Assert( shape() == B.shape() );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out += std::abs(mData[i]);
+  cppmat::expr::assign_div(mData.data(), B);
 
-  return out;
+  return *this;
 }
 
-// =================================================================================================
-// return the indices that would sort the array
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
+template<class E, typename V>
 inline
-array<size_t> array<X>::argsort(bool ascending) const
+array<X>& array<X>::operator+= (const E &B)
+{
+  Assert( shape() == B.shape() );
+
+  cppmat::expr::assign_add(mData.data(), B);
+
+  return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+template<class E, typename V>
+inline
+array<X>& array<X>::operator-= (const E &B)
 {
-  return array<size_t>::Copy(shape(), cppmat::argsort(mData, ascending));
+  Assert( shape() == B.shape() );
+
+  cppmat::expr::assign_sub(mData.data(), B);
+
+  return *this;
 }
 
 // =================================================================================================
-// location of the minimum/maximum
+// absolute value
 // =================================================================================================
 
 template<typename X>
 inline
-size_t array<X>::argmin() const
+array<X> array<X>::abs() const
 {
-  return std::min_element(begin(), end()) - begin();
+  array<X> out(shape());
+
+  Private::transform(out.data(), mData.data(), mSize, [](const X &a) { return std::abs(a); });
+
+  return out;
 }
 
-// -------------------------------------------------------------------------------------------------
+// =================================================================================================
+// norm
+// =================================================================================================
 
 template<typename X>
 inline
-size_t array<X>::argmax() const
+X array<X>::norm() const
 {
-  return std::max_element(begin(), end()) - begin();
+  return Private::norm(mData.data(), mSize);
 }
 
 // =================================================================================================
-// minimum
+// return the indices that would sort the array
 // =================================================================================================
 
 template<typename X>
 inline
-X array<X>::min() const
+array<size_t> array<X>::argsort(bool ascending) const
 {
-  return *std::min_element(begin(),end());
+  return array<size_t>::Copy(shape(), cppmat::argsort(std::vector<X>(mData.begin(), mData.end()), ascending));
 }
 
-// -------------------------------------------------------------------------------------------------
+// =================================================================================================
+// reduction along one or more axes (in one pass, without intermediate arrays)
+// =================================================================================================
 
 template<typename X>
+template<class F>
 inline
-array<X> array<X>::min(size_t axis) const
+void array<X>::reduce(const std::vector<size_t> &axes, F func) const
 {
-  // check input
-  Assert( axis < mRank );
+  // mark reduced axes
+  bool reduced[MAX_DIM];
 
-  // initialize output to the same shape as the input, with one axis removed
-  array<X> out = array<X>::Constant(del(shape(),axis), max());
+  std::fill(std::begin(reduced), std::end(reduced), false);
 
-  // extended strides
-  // - copy strides
-  std::vector<size_t> estrides = strides();
-  // - insert total size at the beginning
-  estrides.insert(estrides.begin(), mSize);
+  for ( auto &axis : axes )
+  {
+    Assert( axis < mRank );
 
-  // extract sizes
-  size_t n = estrides[axis  ];
-  size_t m = estrides[axis+1];
+    reduced[axis] = true;
+  }
 
-  // perform reduction
-  for ( size_t i = 0 ; i < mSize ; ++i )
+  // strides of the output, and of the flat index in the reduced axes (zero along the other axes)
+  // - allocate, padded to the maximum rank: the innermost loop runs over the last axis
+  size_t n [MAX_DIM];
+  size_t dj[MAX_DIM];
+  size_t dk[MAX_DIM];
+  // - initialize
+  std::fill(std::begin(n ), std::end(n ), 1);
+  std::fill(std::begin(dj), std::end(dj), 0);
+  std::fill(std::begin(dk), std::end(dk), 0);
+  // - fill
+  size_t sj = 1;
+  size_t sk = 1;
+  // - fill
+  for ( size_t i = mRank ; i-- > 0 ; )
   {
-    // - get the new index
-    size_t ni = i/n*m + i%m;
-    // - store
-    out[ni] = std::min(out[ni], mData[i]);
+    size_t l = MAX_DIM - mRank + i;
+
+    n[l] = mShape[i];
+
+    if ( reduced[i] ) { dk[l] = sk; sk *= mShape[i]; }
+    else              { dj[l] = sj; sj *= mShape[i]; }
   }
 
-  return out;
-}
+  // strides of the input
+  size_t di[MAX_DIM];
 
-// -------------------------------------------------------------------------------------------------
+  di[MAX_DIM-1] = 1;
 
-template<typename X>
-inline
-array<X> array<X>::min(int axis) const
-{
-  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
-  Assert( axis  <      static_cast<int>(mRank) );
-  Assert( axis >= -1 * static_cast<int>(mRank) );
+  for ( size_t l = MAX_DIM-1 ; l-- > 0 ; )
+    di[l] = di[l+1] * n[l+1];
 
-  // get number of dimensions as integer
-  int n = static_cast<int>(mRank);
+  // split the other axes in the kept axes ("outer") and the reduced axes ("inner")
+  size_t outer[MAX_DIM], no = 0, nouter = 1;
+  size_t inner[MAX_DIM], ni = 0, ninner = 1;
 
-  // correct periodic axis
-  axis = ( n + (axis%n) ) % n;
+  for ( size_t l = 0 ; l < MAX_DIM-1 ; ++l )
+  {
+    if ( dk[l] == 0 ) { outer[no++] = l; nouter *= n[l]; }
+    else              { inner[ni++] = l; ninner *= n[l]; }
+  }
 
-  // compute
-  return min(static_cast<size_t>(axis));
+  // if the last axis is kept: also split it in "nc" parts, if there are too few other output entries
+  size_t nt = cppmat::parallel::numThreads();
+  size_t nc = 1;
+
+  if ( dj[MAX_DIM-1] != 0 and nouter < nt and cppmat::parallel::isParallel(mSize) )
+    nc = std::min(n[MAX_DIM-1], nt);
+
+  // in parallel over the output entries: each output entry is reduced by one thread, over the reduced
+  // axes in row-major order (as in a serial loop), whereby the result does not depend on the number
+  // of threads; the last axis is passed to "func" as one block
+  cppmat::Private::parallel_for(nouter*nc, mSize, [&](size_t begin, size_t end)
+  {
+    for ( size_t p = begin ; p < end ; ++p )
+    {
+      // offset of the kept axes (from "p", in row-major order), and part "[f0, f1)" of the last axis
+      size_t q  = p / nc;
+      size_t i0 = 0;
+      size_t j0 = 0;
+
+      for ( size_t m = no ; m-- > 0 ; )
+      {
+        size_t l = outer[m];
+        size_t x = q % n[l];
+
+        q  /= n[l];
+        i0 += x * di[l];
+        j0 += x * dj[l];
+      }
+
+      size_t f0 = ( p % nc     ) * n[MAX_DIM-1] / nc;
+      size_t f1 = ( p % nc + 1 ) * n[MAX_DIM-1] / nc;
+
+      // loop over the reduced axes in row-major order
+      size_t idx[MAX_DIM] = {};
+      size_t i = i0 + f0;
+      size_t j = j0 + f0 * dj[MAX_DIM-1];
+      size_t k = 0;
+
+      for ( size_t r = 0 ; r < ninner ; ++r )
+      {
+        func(&mData[i], f1-f0, j, dj[MAX_DIM-1], k, dk[MAX_DIM-1]);
+
+        for ( size_t m = ni ; m-- > 0 ; )
+        {
+          size_t l = inner[m];
+
+          if ( ++idx[m] < n[l] ) { i += di[l]; k += dk[l]; break; }
+
+          i     -= ( n[l] - 1 ) * di[l];
+          k     -= ( n[l] - 1 ) * dk[l];
+          idx[m] = 0;
+        }
+      }
+    }
+  });
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<X> array<X>::min(const std::vector<int> &axes_in) const
+std::vector<size_t> array<X>::reduce_axes(const std::vector<int> &axes_in) const
 {
   // correct for 'periodicity', sort from high to low
   std::vector<int> axes = cppmat::Private::sort_axes(axes_in, static_cast<int>(mRank), true);
 
-  // copy array
-  array<X> out = (*this);
+  // check that all axes are unique
+  Assert( std::unique(axes.begin(), axes.end()) == axes.end() );
 
-  // loop to compute
-  for ( auto &axis : axes )
-    out = out.min(axis);
-
-  return out;
+  // convert
+  return std::vector<size_t>(axes.begin(), axes.end());
 }
 
-// =================================================================================================
-// maximum
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-X array<X>::max() const
+std::vector<size_t> array<X>::reduce_shape(const std::vector<size_t> &axes) const
 {
-  return *std::max_element(begin(),end());
+  std::vector<size_t> out;
+
+  for ( size_t i = 0 ; i < mRank ; ++i )
+    if ( std::find(axes.begin(), axes.end(), i) == axes.end() )
+      out.push_back(mShape[i]);
+
+  return out;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-array<X> array<X>::max(size_t axis) const
+array<X> array<X>::reduce_sum(const std::vector<size_t> &axes) const
 {
-  // check input
-  Assert( axis < mRank );
+  array<X> out = array<X>::Zero(reduce_shape(axes));
 
-  // initialize output to the same shape as the input, with one axis removed
-  array<X> out = array<X>::Constant(del(shape(),axis), min());
+  X *o = out.data();
 
-  // extended strides
-  // - copy strides
-  std::vector<size_t> estrides = strides();
-  // - insert total size at the beginning
-  estrides.insert(estrides.begin(), mSize);
+  reduce(axes, [o](const X *in, size_t n, size_t j, size_t dj, size_t, size_t)
+  {
+    // last axis is reduced: accumulate the block
+    if ( dj == 0 )
+    {
+      X tmp = static_cast<X>(0);
 
-  // extract sizes
-  size_t n = estrides[axis  ];
-  size_t m = estrides[axis+1];
+      for ( size_t f = 0 ; f < n ; ++f )
+        tmp += in[f];
 
-  // perform reduction
-  for ( size_t i = 0 ; i < mSize ; ++i )
-  {
-    // - get the new index
-    size_t ni = i/n*m + i%m;
-    // - store
-    out[ni] = std::max(out[ni], mData[i]);
-  }
+      o[j] += tmp;
+
+      return;
+    }
+
+    // last axis is not reduced: add the block to contiguous output
+    CPPMAT_SIMD
+    for ( size_t f = 0 ; f < n ; ++f )
+      o[j+f] += in[f];
+  });
 
   return out;
 }
@@ -2874,79 +3043,66 @@ array<X> array<X>::max(size_t axis) const
 
 template<typename X>
 inline
-array<X> array<X>::max(int axis) const
+array<X> array<X>::reduce_min(const std::vector<size_t> &axes) const
 {
-  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
-  Assert( axis  <      static_cast<int>(mRank) );
-  Assert( axis >= -1 * static_cast<int>(mRank) );
-
-  // get number of dimensions as integer
-  int n = static_cast<int>(mRank);
+  array<X> out = array<X>::Constant(reduce_shape(axes), std::numeric_limits<X>::max());
 
-  // correct periodic axis
-  axis = ( n + (axis%n) ) % n;
+  X *o = out.data();
 
-  // compute
-  return max(static_cast<size_t>(axis));
-}
+  reduce(axes, [o](const X *in, size_t n, size_t j, size_t dj, size_t, size_t)
+  {
+    // last axis is reduced: reduce the block
+    if ( dj == 0 )
+    {
+      X tmp = o[j];
 
-// -------------------------------------------------------------------------------------------------
+      for ( size_t f = 0 ; f < n ; ++f )
+        tmp = std::min(tmp, in[f]);
 
-template<typename X>
-inline
-array<X> array<X>::max(const std::vector<int> &axes_in) const
-{
-  // correct for 'periodicity', sort from high to low
-  std::vector<int> axes = cppmat::Private::sort_axes(axes_in, static_cast<int>(mRank), true);
+      o[j] = tmp;
 
-  // copy array
-  array<X> out = (*this);
+      return;
+    }
 
-  // loop to compute
-  for ( auto &axis : axes )
-    out = out.max(axis);
+    // last axis is not reduced: compare the block to contiguous output
+    CPPMAT_SIMD
+    for ( size_t f = 0 ; f < n ; ++f )
+      o[j+f] = std::min(o[j+f], in[f]);
+  });
 
   return out;
 }
 
-// =================================================================================================
-// sum
-// =================================================================================================
+// -------------------------------------------------------------------------------------------------
 
 template<typename X>
 inline
-X array<X>::sum() const
+array<X> array<X>::reduce_max(const std::vector<size_t> &axes) const
 {
-  return std::accumulate(begin(), end(), static_cast<X>(0));
-}
+  array<X> out = array<X>::Constant(reduce_shape(axes), std::numeric_limits<X>::lowest());
 
-// -------------------------------------------------------------------------------------------------
+  X *o = out.data();
 
-template<typename X>
-inline
-array<X> array<X>::sum(size_t axis) const
-{
-  // zero-initialize output to the same shape as the input, with one axis removed
-  array<X> out = array<X>::Zero(del(shape(),axis));
+  reduce(axes, [o](const X *in, size_t n, size_t j, size_t dj, size_t, size_t)
+  {
+    // last axis is reduced: reduce the block
+    if ( dj == 0 )
+    {
+      X tmp = o[j];
 
-  // extended strides
-  // - copy strides
-  std::vector<size_t> estrides = strides();
-  // - insert total size at the beginning
-  estrides.insert(estrides.begin(), mSize);
+      for ( size_t f = 0 ; f < n ; ++f )
+        tmp = std::max(tmp, in[f]);
 
-  // extract sizes
-  size_t n = estrides[axis  ];
-  size_t m = estrides[axis+1];
+      o[j] = tmp;
 
-  // perform reduction
-  for ( size_t i = 0 ; i < mSize ; ++i )
-  {
-    // - get the new index
-    size_t ni = i/n*m + i%m;
-    // - store
-    out[ni] += mData[i];
-  }
+      return;
+    }
+
+    // last axis is not reduced: compare the block to contiguous output
+    CPPMAT_SIMD
+    for ( size_t f = 0 ; f < n ; ++f )
+      o[j+f] = std::max(o[j+f], in[f]);
+  });
 
   return out;
 }
@@ -2954,46 +3110,264 @@ array<X> array<X>::sum(size_t axis) const
 // -------------------------------------------------------------------------------------------------
 
 template<typename X>
+template<class Compare>
 inline
-array<X> array<X>::sum(int axis) const
+array<size_t> array<X>::reduce_arg(size_t axis, Compare cmp) const
 {
-  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
-  Assert( axis  <      static_cast<int>(mRank) );
-  Assert( axis >= -1 * static_cast<int>(mRank) );
+  Assert( axis < mRank );
 
-  // get number of dimensions as integer
-  int n = static_cast<int>(mRank);
+  std::vector<size_t> axes = {axis};
 
-  // correct periodic axis
-  axis = ( n + (axis%n) ) % n;
+  // value and index of the current extreme, initialized from the first entry along the axis
+  array<X>      val = array<X>     ::Zero(reduce_shape(axes));
+  array<size_t> idx = array<size_t>::Zero(reduce_shape(axes));
 
-  // compute
-  return sum(static_cast<size_t>(axis));
-}
+  X      *v = val.data();
+  size_t *o = idx.data();
 
-// -------------------------------------------------------------------------------------------------
+  reduce(axes, [v,o,cmp](const X *in, size_t n, size_t j, size_t dj, size_t k, size_t dk)
+  {
+    // last axis is reduced: search the block (the index along the axis runs with "f")
+    if ( dj == 0 )
+    {
+      UNUSED(dk);
 
-template<typename X>
-inline
-array<X> array<X>::sum(const std::vector<int> &axes_in) const
-{
-  // check rank
-  Assert( axes_in.size() < mRank );
+      size_t l = 0;
 
-  // correct for 'periodicity', sort from high to low
-  std::vector<int> axes = cppmat::Private::sort_axes(axes_in, static_cast<int>(mRank), true);
+      for ( size_t f = 1 ; f < n ; ++f )
+        if ( cmp(in[f], in[l]) )
+          l = f;
 
-  // copy array
-  array<X> out = (*this);
+      v[j] = in[l];
+      o[j] = l;
 
-  // loop to compute
-  for ( auto &axis : axes )
-    out = out.sum(axis);
+      return;
+    }
 
-  return out;
-}
+    // last axis is not reduced: compare the block to contiguous output (at fixed index "k")
+    if ( k == 0 )
+    {
+      for ( size_t f = 0 ; f < n ; ++f )
+        v[j+f] = in[f];
 
-// =================================================================================================
+      return;
+    }
+
+    for ( size_t f = 0 ; f < n ; ++f )
+    {
+      if ( cmp(in[f], v[j+f]) )
+      {
+        v[j+f] = in[f];
+        o[j+f] = k;
+      }
+    }
+  });
+
+  return idx;
+}
+
+// =================================================================================================
+// location of the minimum/maximum
+// =================================================================================================
+
+template<typename X>
+inline
+size_t array<X>::argmin() const
+{
+  return std::min_element(begin(), end()) - begin();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+size_t array<X>::argmax() const
+{
+  return std::max_element(begin(), end()) - begin();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<size_t> array<X>::argmin(size_t axis) const
+{
+  return reduce_arg(axis, [](const X &a, const X &b) { return a < b; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<size_t> array<X>::argmin(int axis) const
+{
+  return argmin(reduce_axes({axis})[0]);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<size_t> array<X>::argmax(size_t axis) const
+{
+  return reduce_arg(axis, [](const X &a, const X &b) { return a > b; });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<size_t> array<X>::argmax(int axis) const
+{
+  return argmax(reduce_axes({axis})[0]);
+}
+
+// =================================================================================================
+// minimum
+// =================================================================================================
+
+template<typename X>
+inline
+X array<X>::min() const
+{
+  return Private::min(mData.data(), mSize);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::min(size_t axis) const
+{
+  // check input
+  Assert( axis < mRank );
+
+  // compute
+  return reduce_min({axis});
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::min(int axis) const
+{
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  Assert( axis  <      static_cast<int>(mRank) );
+  Assert( axis >= -1 * static_cast<int>(mRank) );
+
+  // compute
+  return reduce_min(reduce_axes({axis}));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::min(const std::vector<int> &axes) const
+{
+  return reduce_min(reduce_axes(axes));
+}
+
+// =================================================================================================
+// maximum
+// =================================================================================================
+
+template<typename X>
+inline
+X array<X>::max() const
+{
+  return Private::max(mData.data(), mSize);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::max(size_t axis) const
+{
+  // check input
+  Assert( axis < mRank );
+
+  // compute
+  return reduce_max({axis});
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::max(int axis) const
+{
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  Assert( axis  <      static_cast<int>(mRank) );
+  Assert( axis >= -1 * static_cast<int>(mRank) );
+
+  // compute
+  return reduce_max(reduce_axes({axis}));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::max(const std::vector<int> &axes) const
+{
+  return reduce_max(reduce_axes(axes));
+}
+
+// =================================================================================================
+// sum
+// =================================================================================================
+
+template<typename X>
+inline
+X array<X>::sum() const
+{
+  return Private::sum(mData.data(), mSize);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::sum(size_t axis) const
+{
+  // check input
+  Assert( axis < mRank );
+
+  // compute
+  return reduce_sum({axis});
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::sum(int axis) const
+{
+  // check axis: (0,1,...,rank-1) or (-1,-2,...,-rank)
+  Assert( axis  <      static_cast<int>(mRank) );
+  Assert( axis >= -1 * static_cast<int>(mRank) );
+
+  // compute
+  return reduce_sum(reduce_axes({axis}));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+array<X> array<X>::sum(const std::vector<int> &axes) const
+{
+  // check rank
+  Assert( axes.size() < mRank );
+
+  // compute
+  return reduce_sum(reduce_axes(axes));
+}
+
+// =================================================================================================
 // mean
 // =================================================================================================
 
@@ -3010,9 +3384,11 @@ template<typename X>
 inline
 array<X> array<X>::mean(size_t axis) const
 {
-  array<X> weights = array<X>::Ones(shape());
+  array<X> out = sum(axis);
 
-  return (*this).sum(axis) / weights.sum(axis);
+  out /= static_cast<X>(mShape[axis]);
+
+  return out;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -3021,9 +3397,7 @@ template<typename X>
 inline
 array<X> array<X>::mean(int axis) const
 {
-  array<X> weights = array<X>::Ones(shape());
-
-  return (*this).sum(axis) / weights.sum(axis);
+  return mean(reduce_axes({axis})[0]);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -3032,9 +3406,11 @@ template<typename X>
 inline
 array<X> array<X>::mean(const std::vector<int> &axes) const
 {
-  array<X> weights = array<X>::Ones(shape());
+  array<X> out = sum(axes);
 
-  return (*this).sum(axes) / weights.sum(axes);
+  if ( out.size() > 0 ) out /= static_cast<X>(mSize / out.size());
+
+  return out;
 }
 
 // =================================================================================================
@@ -3055,8 +3431,8 @@ template<typename X>
 inline
 array<X> array<X>::average(const array<X> &weights, size_t axis, bool norm) const
 {
-  if ( norm ) return (weights*(*this)).sum(axis) / weights.sum(axis);
-  else        return (weights*(*this)).sum(axis);
+  if ( norm ) return array<X>(weights*(*this)).sum(axis) / weights.sum(axis);
+  else        return array<X>(weights*(*this)).sum(axis);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -3065,8 +3441,8 @@ template<typename X>
 inline
 array<X> array<X>::average(const array<X> &weights, int axis, bool norm) const
 {
-  if ( norm ) return (weights*(*this)).sum(axis) / weights.sum(axis);
-  else        return (weights*(*this)).sum(axis);
+  if ( norm ) return array<X>(weights*(*this)).sum(axis) / weights.sum(axis);
+  else        return array<X>(weights*(*this)).sum(axis);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -3076,8 +3452,8 @@ inline
 array<X> array<X>::average(
   const array<X> &weights, const std::vector<int> &axes, bool norm) const
 {
-  if ( norm ) return (weights*(*this)).sum(axes) / weights.sum(axes);
-  else        return (weights*(*this)).sum(axes);
+  if ( norm ) return array<X>(weights*(*this)).sum(axes) / weights.sum(axes);
+  else        return array<X>(weights*(*this)).sum(axes);
 }
 
 // =================================================================================================
@@ -3088,11 +3464,10 @@ template<typename X>
 inline
 array<int> array<X>::equal(const X &D) const
 {
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a == D); });
 
   return out;
 }
@@ -3103,11 +3478,10 @@ template<typename X>
 inline
 array<int> array<X>::not_equal(const X &D) const
 {
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a != D); });
 
   return out;
 }
@@ -3118,11 +3492,10 @@ template<typename X>
 inline
 array<int> array<X>::greater(const X &D) const
 {
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a > D); });
 
   return out;
 }
@@ -3133,11 +3506,10 @@ template<typename X>
 inline
 array<int> array<X>::greater_equal(const X &D) const
 {
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a >= D); });
 
   return out;
 }
@@ -3148,11 +3520,10 @@ template<typename X>
 inline
 array<int> array<X>::less(const X &D) const
 {
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a < D); });
 
   return out;
 }
@@ -3163,11 +3534,10 @@ template<typename X>
 inline
 array<int> array<X>::less_equal(const X &D) const
 {
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a <= D); });
 
   return out;
 }
@@ -3181,11 +3551,10 @@ array<int> array<X>::equal(const array<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a == b); });
 
   return out;
 }
@@ -3199,11 +3568,10 @@ array<int> array<X>::not_equal(const array<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a != b); });
 
   return out;
 }
@@ -3217,11 +3585,10 @@ array<int> array<X>::greater(const array<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a > b); });
 
   return out;
 }
@@ -3235,11 +3602,10 @@ array<int> array<X>::greater_equal(const array<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a >= b); });
 
   return out;
 }
@@ -3253,11 +3619,10 @@ array<int> array<X>::less(const array<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a < b); });
 
   return out;
 }
@@ -3271,11 +3636,10 @@ array<int> array<X>::less_equal(const array<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  array<int> out = array<int>::Zero(shape());
+  array<int> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a <= b); });
 
   return out;
 }
@@ -3288,24 +3652,7 @@ template<typename X>
 inline
 std::vector<size_t> array<X>::where() const
 {
-  size_t nnz = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] )
-      ++nnz;
-
-  std::vector<size_t> out(nnz);
-
-  size_t j = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i ) {
-    if ( mData[i] ) {
-      out[j] = i;
-      ++j;
-    }
-  }
-
-  return out;
+  return Private::where(mData.data(), mSize);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -3413,11 +3760,7 @@ bool operator!= (const array<X> &A, const array<X> &B)
   Assert( A.rank () == B.rank () );
   Assert( A.size () == B.size () );
 
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    if ( A[i] != B[i] )
-      return true;
-
-  return false;
+  return not cppmat::Private::all_equal(A.data(), B.data(), A.size());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -3430,197 +3773,7 @@ bool operator== (const array<X> &A, const array<X> &B)
   Assert( A.rank () == B.rank () );
   Assert( A.size () == B.size () );
 
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    if ( A[i] != B[i] )
-      return false;
-
-  return true;
-}
-
-// =================================================================================================
-// arithmetic operators: external
-// =================================================================================================
-
-template<typename X>
-inline
-array<X> operator* (const array<X> &A, const array<X> &B)
-{
-  Assert( A.shape() == B.shape() );
-  Assert( A.rank () == B.rank () );
-  Assert( A.size () == B.size () );
-
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator/ (const array<X> &A, const array<X> &B)
-{
-  Assert( A.shape() == B.shape() );
-  Assert( A.rank () == B.rank () );
-  Assert( A.size () == B.size () );
-
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] / B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator+ (const array<X> &A, const array<X> &B)
-{
-  Assert( A.shape() == B.shape() );
-  Assert( A.rank () == B.rank () );
-  Assert( A.size () == B.size () );
-
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] + B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator- (const array<X> &A, const array<X> &B)
-{
-  Assert( A.shape() == B.shape() );
-  Assert( A.rank () == B.rank () );
-  Assert( A.size () == B.size () );
-
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] - B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator* (const array<X> &A, const X &B)
-{
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B;
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator/ (const array<X> &A, const X &B)
-{
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] / B;
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator+ (const array<X> &A, const X &B)
-{
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] + B;
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator- (const array<X> &A, const X &B)
-{
-  array<X> C(A.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] - B;
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator* (const X &A, const array<X> &B)
-{
-  array<X> C(B.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A * B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator/ (const X &A, const array<X> &B)
-{
-  array<X> C(B.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A / B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator+ (const X &A, const array<X> &B)
-{
-  array<X> C(B.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A + B[i];
-
-  return C;
-}
-
-// -------------------------------------------------------------------------------------------------
-
-template<typename X>
-inline
-array<X> operator- (const X &A, const array<X> &B)
-{
-  array<X> C(B.shape());
-
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A - B[i];
-
-  return C;
+  return cppmat::Private::all_equal(A.data(), B.data(), A.size());
 }
 
 // =================================================================================================
@@ -3635,8 +3788,8 @@ template<typename X> array<X> min(const array<X> &A, const array<X> &B)
 
   array<X> C(A.shape());
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = std::min(A[i], B[i]);
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return std::min(a, b); });
 
   return C;
 }
@@ -3651,8 +3804,8 @@ template<typename X> array<X> max(const array<X> &A, const array<X> &B)
 
   array<X> C(A.shape());
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = std::max(A[i], B[i]);
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return std::max(a, b); });
 
   return C;
 }
@@ -27,6 +27,11 @@ private:
   // hide functions
   using cppmat::array<X>::chrank;
 
+protected:
+
+  // constructor: empty, using inline storage of a derived class (see "cppmat::array")
+  matrix(cppmat::Private::inline_buffer<X,0> buffer);
+
 public:
 
   // avoid name-hiding (also use the already defined overloads)
@@ -47,6 +52,10 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   matrix(const cppmat::array<U> &A);
 
+  // constructor: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  matrix(const E &A);
+
   // constructor: copy from other class
   matrix(const cppmat::symmetric::matrix<X> &A);
   matrix(const cppmat::diagonal ::matrix<X> &A);
@@ -82,8 +91,19 @@ public:
   matrix<X>& operator*= (const cppmat::diagonal ::matrix<X> &B);
   matrix<X>& operator+= (const cppmat::diagonal ::matrix<X> &B);
   matrix<X>& operator-= (const cppmat::diagonal ::matrix<X> &B);
+
+  // matrix products (cache-blocked, with a register-blocked SIMD kernel, see "CPPMAT_SIMD_BYTES")
+  matrix<X> dot(const matrix<X> &B) const; // C_ik = A_ij * B_jk
+  vector<X> dot(const vector<X> &b) const; // c_i  = A_ij * b_j
 };
 
+// =================================================================================================
+// matrix products: the same as "A.dot(B)" and "A.dot(b)"
+// =================================================================================================
+
+template<typename X> matrix<X> matmul(const matrix<X> &A, const matrix<X> &B);
+template<typename X> vector<X> matvec(const matrix<X> &A, const vector<X> &b);
+
 // =================================================================================================
 
 } // namespace ...
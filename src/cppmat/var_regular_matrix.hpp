@@ -25,6 +25,14 @@ matrix<X>::matrix(size_t m, size_t n) : cppmat::array<X>({m,n})
 {
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X>::matrix(cppmat::Private::inline_buffer<X,0> buffer) : cppmat::array<X>(buffer)
+{
+}
+
 // =================================================================================================
 // constructors: copy from parent (with different type)
 // =================================================================================================
@@ -37,6 +45,18 @@ matrix<X>::matrix(const cppmat::array<U> &A) : cppmat::array<X>(A)
   Assert( this->mRank == 2 );
 }
 
+// =================================================================================================
+// constructors: evaluate expression
+// =================================================================================================
+
+template<typename X>
+template<class E, typename V>
+inline
+matrix<X>::matrix(const E &A) : cppmat::array<X>(A)
+{
+  Assert( this->mRank == 2 );
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
@@ -220,6 +240,63 @@ void matrix<X>::reshape(size_t m, size_t n)
   cppmat::array<X>::reshape({m,n});
 }
 
+// =================================================================================================
+// matrix products
+// =================================================================================================
+
+template<typename X>
+inline
+matrix<X> matrix<X>::dot(const matrix<X> &B) const
+{
+  Assert( this->mShape[1] == B.shape(0) );
+
+  size_t m = this->mShape[0];
+  size_t k = this->mShape[1];
+  size_t n = B.shape(1);
+
+  matrix<X> C(m,n);
+
+  cppmat::Private::gemm(m, n, k, this->data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X> matrix<X>::dot(const vector<X> &b) const
+{
+  Assert( this->mShape[1] == b.size() );
+
+  size_t m = this->mShape[0];
+  size_t n = this->mShape[1];
+
+  vector<X> c(m);
+
+  cppmat::Private::gemv(m, n, this->data(), b.data(), c.data());
+
+  return c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+matrix<X> matmul(const matrix<X> &A, const matrix<X> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X> matvec(const matrix<X> &A, const vector<X> &b)
+{
+  return A.dot(b);
+}
+
 // =================================================================================================
 
 } // namespace ...
@@ -28,6 +28,11 @@ private:
   using cppmat::array<X>::reshape;
   using cppmat::array<X>::chrank;
 
+protected:
+
+  // constructor: empty, using inline storage of a derived class (see "cppmat::array")
+  vector(cppmat::Private::inline_buffer<X,0> buffer);
+
 public:
 
   // constructor: default
@@ -40,6 +45,10 @@ public:
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   vector(const cppmat::array<U> &A);
 
+  // constructor: evaluate expression
+  template<class E, typename=typename std::enable_if<std::is_base_of<cppmat::expr::base,E>::value>::type>
+  vector(const E &A);
+
   // constructor: copy from other class
   template<typename U, typename=typename std::enable_if<std::is_convertible<U,X>::value>::type>
   vector(const std::vector<U> &A);
@@ -25,6 +25,14 @@ vector<X>::vector(size_t n) : cppmat::array<X>({n})
 {
 }
 
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+vector<X>::vector(cppmat::Private::inline_buffer<X,0> buffer) : cppmat::array<X>(buffer)
+{
+}
+
 // =================================================================================================
 // constructors: copy from parent (with different type)
 // =================================================================================================
@@ -37,6 +45,18 @@ vector<X>::vector(const cppmat::array<U> &A) : cppmat::array<X>(A)
   Assert( this->mRank == 1 );
 }
 
+// =================================================================================================
+// constructors: evaluate expression
+// =================================================================================================
+
+template<typename X>
+template<class E, typename V>
+inline
+vector<X>::vector(const E &A) : cppmat::array<X>(A)
+{
+  Assert( this->mRank == 1 );
+}
+
 // =================================================================================================
 // constructors: copy from other class
 // =================================================================================================
@@ -0,0 +1,122 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_SYMMETRIC_CHOLESKY_H
+#define CPPMAT_VAR_SYMMETRIC_CHOLESKY_H
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace symmetric {
+
+// =================================================================================================
+// cppmat::symmetric::cholesky - factorization "A = U^T * U" of a symmetric positive definite matrix
+// - the upper triangular "U" is stored in place of "A", in the same packed storage: a matrix that is
+//   moved in is factorized without any copy
+// - the factorization is computed once, and can be used for any number of solves
+// =================================================================================================
+
+template<typename X>
+class cholesky
+{
+protected:
+
+  matrix<X> mU; // factor "U" (packed storage)
+
+public:
+
+  // constructor: default
+  cholesky() = default;
+
+  // constructor: factorize (throws if "A" is not positive definite)
+  cholesky(const matrix<X> &A);
+  cholesky(matrix<X> &&A);
+
+  // factorize (reusing the storage of the previous factorization, if "A" is copied)
+  void compute(const matrix<X> &A);
+  void compute(matrix<X> &&A);
+
+  // factor "U"
+  const matrix<X>& factor() const;
+
+  // determinant of "A"
+  X determinant() const;
+
+  // solve "A * x = b", or "A * X = B" for each column of "B"
+  cppmat::vector<X> solve(const cppmat::vector<X> &b) const;
+  cppmat::matrix<X> solve(const cppmat::matrix<X> &B) const;
+
+  // solve in place: "b" or "B" is overwritten by the solution
+  void solveInPlace(cppmat::vector<X> &b) const;
+  void solveInPlace(cppmat::matrix<X> &B) const;
+
+private:
+
+  // factorize "mU" in place
+  void factorize();
+
+};
+
+// =================================================================================================
+// cppmat::symmetric::ldlt - factorization "A = U^T * D * U" of a symmetric matrix, without pivoting
+// (i.e. for definite, or quasi-definite, matrices), without the square-roots of "cholesky"
+// - the unit upper triangular "U" and diagonal "D" are stored in place of "A", in the same packed
+//   storage ("D" on the diagonal)
+// =================================================================================================
+
+template<typename X>
+class ldlt
+{
+protected:
+
+  matrix<X> mF; // factors "U" (strictly upper triangle) and "D" (diagonal) (packed storage)
+
+public:
+
+  // constructor: default
+  ldlt() = default;
+
+  // constructor: factorize (throws if a pivot is zero)
+  ldlt(const matrix<X> &A);
+  ldlt(matrix<X> &&A);
+
+  // factorize (reusing the storage of the previous factorization, if "A" is copied)
+  void compute(const matrix<X> &A);
+  void compute(matrix<X> &&A);
+
+  // factors "U" and "D"
+  const matrix<X>& factor() const;
+
+  // determinant of "A"
+  X determinant() const;
+
+  // solve "A * x = b", or "A * X = B" for each column of "B"
+  cppmat::vector<X> solve(const cppmat::vector<X> &b) const;
+  cppmat::matrix<X> solve(const cppmat::matrix<X> &B) const;
+
+  // solve in place: "b" or "B" is overwritten by the solution
+  void solveInPlace(cppmat::vector<X> &b) const;
+  void solveInPlace(cppmat::matrix<X> &B) const;
+
+private:
+
+  // factorize "mF" in place
+  void factorize();
+
+};
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
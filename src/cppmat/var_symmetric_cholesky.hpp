@@ -0,0 +1,284 @@
+/* =================================================================================================
+
+(c - MIT) T.W.J. de Geus (Tom) | tom@geus.me | www.geus.me | github.com/tdegeus/cppmat
+
+================================================================================================= */
+
+#ifndef CPPMAT_VAR_SYMMETRIC_CHOLESKY_HPP
+#define CPPMAT_VAR_SYMMETRIC_CHOLESKY_HPP
+
+// -------------------------------------------------------------------------------------------------
+
+#include "cppmat.h"
+
+// -------------------------------------------------------------------------------------------------
+
+namespace cppmat {
+namespace symmetric {
+
+// =================================================================================================
+// cppmat::symmetric::cholesky : constructors
+// =================================================================================================
+
+template<typename X>
+inline
+cholesky<X>::cholesky(const matrix<X> &A) : mU(A)
+{
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cholesky<X>::cholesky(matrix<X> &&A) : mU(std::move(A))
+{
+  factorize();
+}
+
+// =================================================================================================
+// cppmat::symmetric::cholesky : factorize
+// =================================================================================================
+
+template<typename X>
+inline
+void cholesky<X>::compute(const matrix<X> &A)
+{
+  mU = A;
+
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void cholesky<X>::compute(matrix<X> &&A)
+{
+  mU = std::move(A);
+
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void cholesky<X>::factorize()
+{
+  if ( not Private::cholesky(mU.shape(0), mU.data()) )
+    throw std::domain_error("cppmat::symmetric::cholesky: Matrix is not positive definite");
+}
+
+// =================================================================================================
+// cppmat::symmetric::cholesky : factor and determinant
+// =================================================================================================
+
+template<typename X>
+inline
+const matrix<X>& cholesky<X>::factor() const
+{
+  return mU;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X cholesky<X>::determinant() const
+{
+  X out = static_cast<X>(1);
+
+  for ( size_t a = 0 ; a < mU.shape(0) ; ++a )
+    out *= mU(a,a) * mU(a,a);
+
+  return out;
+}
+
+// =================================================================================================
+// cppmat::symmetric::cholesky : solve
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::vector<X> cholesky<X>::solve(const cppmat::vector<X> &b) const
+{
+  cppmat::vector<X> x = b;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> cholesky<X>::solve(const cppmat::matrix<X> &B) const
+{
+  cppmat::matrix<X> x = B;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void cholesky<X>::solveInPlace(cppmat::vector<X> &b) const
+{
+  Assert( b.size() == mU.shape(0) );
+
+  Private::cholesky_solve(mU.shape(0), 1, mU.data(), b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void cholesky<X>::solveInPlace(cppmat::matrix<X> &B) const
+{
+  Assert( B.shape(0) == mU.shape(0) );
+
+  Private::cholesky_solve(mU.shape(0), B.shape(1), mU.data(), B.data());
+}
+
+// =================================================================================================
+// cppmat::symmetric::ldlt : constructors
+// =================================================================================================
+
+template<typename X>
+inline
+ldlt<X>::ldlt(const matrix<X> &A) : mF(A)
+{
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+ldlt<X>::ldlt(matrix<X> &&A) : mF(std::move(A))
+{
+  factorize();
+}
+
+// =================================================================================================
+// cppmat::symmetric::ldlt : factorize
+// =================================================================================================
+
+template<typename X>
+inline
+void ldlt<X>::compute(const matrix<X> &A)
+{
+  mF = A;
+
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ldlt<X>::compute(matrix<X> &&A)
+{
+  mF = std::move(A);
+
+  factorize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ldlt<X>::factorize()
+{
+  if ( not Private::ldlt(mF.shape(0), mF.data()) )
+    throw std::domain_error("cppmat::symmetric::ldlt: Matrix is singular (or needs pivoting)");
+}
+
+// =================================================================================================
+// cppmat::symmetric::ldlt : factor and determinant
+// =================================================================================================
+
+template<typename X>
+inline
+const matrix<X>& ldlt<X>::factor() const
+{
+  return mF;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X ldlt<X>::determinant() const
+{
+  X out = static_cast<X>(1);
+
+  for ( size_t a = 0 ; a < mF.shape(0) ; ++a )
+    out *= mF(a,a);
+
+  return out;
+}
+
+// =================================================================================================
+// cppmat::symmetric::ldlt : solve
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::vector<X> ldlt<X>::solve(const cppmat::vector<X> &b) const
+{
+  cppmat::vector<X> x = b;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> ldlt<X>::solve(const cppmat::matrix<X> &B) const
+{
+  cppmat::matrix<X> x = B;
+
+  solveInPlace(x);
+
+  return x;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ldlt<X>::solveInPlace(cppmat::vector<X> &b) const
+{
+  Assert( b.size() == mF.shape(0) );
+
+  Private::ldlt_solve(mF.shape(0), 1, mF.data(), b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void ldlt<X>::solveInPlace(cppmat::matrix<X> &B) const
+{
+  Assert( B.shape(0) == mF.shape(0) );
+
+  Private::ldlt_solve(mF.shape(0), B.shape(1), mF.data(), B.data());
+}
+
+// =================================================================================================
+
+}} // namespace ...
+
+// -------------------------------------------------------------------------------------------------
+
+#endif
+
@@ -25,11 +25,15 @@ class matrix
 {
 protected:
 
-  size_t              mSize=0;          // total size == data.size()
-  static const size_t mRank=2;          // rank (number of axes)
-  size_t              N=0;              // number of rows/columns
-  std::vector<X>      mData;            // data container
-  bool                mPeriodic=false;  // if true: disable bounds-check where possible
+  // allocator of the data container: aligned to "CPPMAT_ALIGN" bytes, to favour vectorization
+  typedef cppmat::aligned_allocator<X> Allocator;
+
+  static const size_t              INLINE=6;        // entries stored without allocation (3-d tensor2s)
+  size_t                           mSize=0;         // total size == data.size()
+  static const size_t              mRank=2;         // rank (number of axes)
+  size_t                           N=0;             // number of rows/columns
+  small_vector<X,INLINE,Allocator> mData;           // data container
+  bool                             mPeriodic=false; // if true: disable bounds-check where possible
 
 public:
 
@@ -233,12 +237,32 @@ public:
   size_t              where(int    index) const;
   size_t              where(size_t index) const;
 
+  // products, directly on the packed storage
+  cppmat::matrix<X> dot(const cppmat::matrix<X> &B) const; // C_ik = A_ij * B_jk
+  cppmat::vector<X> dot(const cppmat::vector<X> &b) const; // c_i  = A_ij * b_j
+
+  // quadratic form: b_i * A_ij * b_j
+  X quadratic(const cppmat::vector<X> &b) const;
+
+  // rank-1 and rank-k updates (with "beta == 0" the current entries are not read)
+  // - A_ij += alpha * b_i * b_j
+  void rankUpdate(const cppmat::vector<X> &b, X alpha=(X)1);
+  // - A_ij  = alpha * B_ik * B_jk + beta * A_ij
+  void rankUpdate(const cppmat::matrix<X> &B, X alpha=(X)1, X beta=(X)1);
+  // - A_ij  = alpha * ( B_ik * C_jk + C_ik * B_jk ) + beta * A_ij
+  void rankUpdate(const cppmat::matrix<X> &B, const cppmat::matrix<X> &C, X alpha=(X)1, X beta=(X)1);
+
 };
 
 // equality operators
 template<typename X> bool operator!= (const matrix<X> &A, const matrix<X> &B);
 template<typename X> bool operator== (const matrix<X> &A, const matrix<X> &B);
 
+// products: the same as "A.dot(B)", "A.dot(b)", and "A.quadratic(b)"
+template<typename X> cppmat::matrix<X> matmul   (const matrix<X> &A, const cppmat::matrix<X> &B);
+template<typename X> cppmat::vector<X> matvec   (const matrix<X> &A, const cppmat::vector<X> &b);
+template<typename X> X                 quadratic(const matrix<X> &A, const cppmat::vector<X> &b);
+
 // external arithmetic operators (cppmat::symmetric::matrix)
 template<typename X> matrix<X> operator* (const matrix<X> &A, const matrix<X> &B);
 template<typename X> matrix<X> operator/ (const matrix<X> &A, const matrix<X> &B);
@@ -765,17 +765,7 @@ template<typename X>
 inline
 void matrix<X>::setRandom(X lower, X upper)
 {
-  // type of random number distribution
-  std::uniform_real_distribution<X> dist(lower, upper);
-
-  // Mersenne Twister: Good quality random number generator
-  std::mt19937 rng;
-
-  // Initialize with non-deterministic seeds
-  rng.seed(std::random_device{}());
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] = dist(rng);
+  cppmat::random::fillUniform(begin(), end(), lower, upper);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -988,8 +978,7 @@ matrix<X> matrix<X>::operator- () const
 {
   matrix<X> out(shape());
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out[i] = -mData[i];
+  Private::transform(out.data(), mData.data(), mSize, [](const X &a) { return -a; });
 
   return out;
 }
@@ -1020,8 +1009,7 @@ matrix<X>& matrix<X>::operator*= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a * b; });
 
   return *this;
 }
@@ -1036,8 +1024,7 @@ matrix<X>& matrix<X>::operator/= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] /= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a / b; });
 
   return *this;
 }
@@ -1052,8 +1039,7 @@ matrix<X>& matrix<X>::operator+= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] += B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a + b; });
 
   return *this;
 }
@@ -1068,8 +1054,7 @@ matrix<X>& matrix<X>::operator-= (const matrix<X> &B)
   Assert( rank () == B.rank () );
   Assert( size () == B.size () );
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] -= B[i];
+  Private::inplace(mData.data(), B.data(), mSize, [](const X &a, const X &b) { return a - b; });
 
   return *this;
 }
@@ -1080,8 +1065,7 @@ template<typename X>
 inline
 matrix<X>& matrix<X>::operator*= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] *= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a * b; });
 
   return *this;
 }
@@ -1092,8 +1076,7 @@ template<typename X>
 inline
 matrix<X>& matrix<X>::operator/= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] /= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a / b; });
 
   return *this;
 }
@@ -1104,8 +1087,7 @@ template<typename X>
 inline
 matrix<X>& matrix<X>::operator+= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] += B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a + b; });
 
   return *this;
 }
@@ -1116,8 +1098,7 @@ template<typename X>
 inline
 matrix<X>& matrix<X>::operator-= (X B)
 {
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    mData[i] -= B;
+  Private::inplace(mData.data(), B, mSize, [](const X &a, const X &b) { return a - b; });
 
   return *this;
 }
@@ -1132,8 +1113,7 @@ matrix<X> matrix<X>::abs() const
 {
   matrix<X> out(N, N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out[i] = std::abs(mData[i]);
+  Private::transform(out.data(), mData.data(), mSize, [](const X &a) { return std::abs(a); });
 
   return out;
 }
@@ -1146,12 +1126,7 @@ template<typename X>
 inline
 X matrix<X>::norm() const
 {
-  X out = static_cast<X>(0);
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    out += std::abs(mData[i]);
-
-  return out;
+  return Private::norm(mData.data(), mSize);
 }
 
 // =================================================================================================
@@ -1258,11 +1233,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a == D); });
 
   return out;
 }
@@ -1273,11 +1247,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::not_equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a != D); });
 
   return out;
 }
@@ -1288,11 +1261,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::greater(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a > D); });
 
   return out;
 }
@@ -1303,11 +1275,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::greater_equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a >= D); });
 
   return out;
 }
@@ -1318,11 +1289,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::less(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a < D); });
 
   return out;
 }
@@ -1333,11 +1303,10 @@ template<typename X>
 inline
 matrix<int> matrix<X>::less_equal(const X &D) const
 {
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), mSize,
+    [&D](const X &a) { return static_cast<int>(a <= D); });
 
   return out;
 }
@@ -1351,11 +1320,10 @@ matrix<int> matrix<X>::equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] == D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a == b); });
 
   return out;
 }
@@ -1369,11 +1337,10 @@ matrix<int> matrix<X>::not_equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] != D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a != b); });
 
   return out;
 }
@@ -1387,11 +1354,10 @@ matrix<int> matrix<X>::greater(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] > D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a > b); });
 
   return out;
 }
@@ -1405,11 +1371,10 @@ matrix<int> matrix<X>::greater_equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] >= D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a >= b); });
 
   return out;
 }
@@ -1423,11 +1388,10 @@ matrix<int> matrix<X>::less(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] < D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a < b); });
 
   return out;
 }
@@ -1441,11 +1405,10 @@ matrix<int> matrix<X>::less_equal(const matrix<X> &D) const
   Assert( shape() == D.shape() );
   Assert( size () == D.size () );
 
-  matrix<int> out = matrix<int>::Zero(N,N);
+  matrix<int> out(N,N);
 
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] <= D[i] )
-      out[i] = 1;
+  Private::transform(out.data(), mData.data(), D.data(), mSize,
+    [](const X &a, const X &b) { return static_cast<int>(a <= b); });
 
   return out;
 }
@@ -1458,24 +1421,7 @@ template<typename X>
 inline
 std::vector<size_t> matrix<X>::where() const
 {
-  size_t nnz = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i )
-    if ( mData[i] )
-      ++nnz;
-
-  std::vector<size_t> out(nnz);
-
-  size_t j = 0;
-
-  for ( size_t i = 0 ; i < mSize ; ++i ) {
-    if ( mData[i] ) {
-      out[j] = i;
-      ++j;
-    }
-  }
-
-  return out;
+  return Private::where(mData.data(), mSize);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1524,6 +1470,112 @@ size_t matrix<X>::where(int index) const
   throw std::runtime_error("Out-of-bounds");
 }
 
+// =================================================================================================
+// products
+// =================================================================================================
+
+template<typename X>
+inline
+cppmat::matrix<X> matrix<X>::dot(const cppmat::matrix<X> &B) const
+{
+  Assert( N == B.shape(0) );
+
+  size_t k = B.shape(1);
+
+  cppmat::matrix<X> C(N,k);
+
+  Private::spmm(N, k, mData.data(), B.data(), C.data());
+
+  return C;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::vector<X> matrix<X>::dot(const cppmat::vector<X> &b) const
+{
+  Assert( N == b.size() );
+
+  cppmat::vector<X> c(N);
+
+  Private::spmv(N, mData.data(), b.data(), c.data());
+
+  return c;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X matrix<X>::quadratic(const cppmat::vector<X> &b) const
+{
+  Assert( N == b.size() );
+
+  return Private::spquad(N, mData.data(), b.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::rankUpdate(const cppmat::vector<X> &b, X alpha)
+{
+  Assert( N == b.size() );
+
+  Private::spr(N, alpha, b.data(), mData.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::rankUpdate(const cppmat::matrix<X> &B, X alpha, X beta)
+{
+  Assert( N == B.shape(0) );
+
+  Private::sprk(N, B.shape(1), alpha, B.data(), beta, mData.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+void matrix<X>::rankUpdate(const cppmat::matrix<X> &B, const cppmat::matrix<X> &C, X alpha, X beta)
+{
+  Assert( N == B.shape(0) );
+  Assert( B.shape() == C.shape() );
+
+  Private::spr2k(N, B.shape(1), alpha, B.data(), C.data(), beta, mData.data());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::matrix<X> matmul(const matrix<X> &A, const cppmat::matrix<X> &B)
+{
+  return A.dot(B);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+cppmat::vector<X> matvec(const matrix<X> &A, const cppmat::vector<X> &b)
+{
+  return A.dot(b);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename X>
+inline
+X quadratic(const matrix<X> &A, const cppmat::vector<X> &b)
+{
+  return A.quadratic(b);
+}
+
 // =================================================================================================
 // print operator
 // =================================================================================================
@@ -1559,11 +1611,7 @@ bool operator!= (const matrix<X> &A, const matrix<X> &B)
   Assert( A.rank () == B.rank () );
   Assert( A.size () == B.size () );
 
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    if ( A[i] != B[i] )
-      return true;
-
-  return false;
+  return not cppmat::Private::all_equal(A.data(), B.data(), A.size());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -1576,11 +1624,7 @@ bool operator== (const matrix<X> &A, const matrix<X> &B)
   Assert( A.rank () == B.rank () );
   Assert( A.size () == B.size () );
 
-  for ( size_t i = 0 ; i < A.size() ; ++i )
-    if ( A[i] != B[i] )
-      return false;
-
-  return true;
+  return cppmat::Private::all_equal(A.data(), B.data(), A.size());
 }
 
 // =================================================================================================
@@ -1597,8 +1641,8 @@ matrix<X> operator* (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a * b; });
 
   return C;
 }
@@ -1615,8 +1659,8 @@ matrix<X> operator/ (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] / B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a / b; });
 
   return C;
 }
@@ -1633,8 +1677,8 @@ matrix<X> operator+ (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] + B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a + b; });
 
   return C;
 }
@@ -1651,8 +1695,8 @@ matrix<X> operator- (const matrix<X> &A, const matrix<X> &B)
 
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] - B[i];
+  Private::transform(C.data(), A.data(), B.data(), C.size(),
+    [](const X &a, const X &b) { return a - b; });
 
   return C;
 }
@@ -1665,8 +1709,8 @@ matrix<X> operator* (const matrix<X> &A, const X &B)
 {
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] * B;
+  Private::transform(C.data(), A.data(), C.size(),
+    [&B](const X &a) { return a * B; });
 
   return C;
 }
@@ -1679,8 +1723,8 @@ matrix<X> operator/ (const matrix<X> &A, const X &B)
 {
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] / B;
+  Private::transform(C.data(), A.data(), C.size(),
+    [&B](const X &a) { return a / B; });
 
   return C;
 }
@@ -1693,8 +1737,8 @@ matrix<X> operator+ (const matrix<X> &A, const X &B)
 {
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] + B;
+  Private::transform(C.data(), A.data(), C.size(),
+    [&B](const X &a) { return a + B; });
 
   return C;
 }
@@ -1707,8 +1751,8 @@ matrix<X> operator- (const matrix<X> &A, const X &B)
 {
   matrix<X> C(A.shape(0),A.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A[i] - B;
+  Private::transform(C.data(), A.data(), C.size(),
+    [&B](const X &a) { return a - B; });
 
   return C;
 }
@@ -1721,8 +1765,8 @@ matrix<X> operator* (const X &A, const matrix<X> &B)
 {
   matrix<X> C(B.shape(0),B.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A * B[i];
+  Private::transform(C.data(), B.data(), C.size(),
+    [&A](const X &b) { return A * b; });
 
   return C;
 }
@@ -1735,8 +1779,8 @@ matrix<X> operator/ (const X &A, const matrix<X> &B)
 {
   matrix<X> C(B.shape(0),B.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A / B[i];
+  Private::transform(C.data(), B.data(), C.size(),
+    [&A](const X &b) { return A / b; });
 
   return C;
 }
@@ -1749,8 +1793,8 @@ matrix<X> operator+ (const X &A, const matrix<X> &B)
 {
   matrix<X> C(B.shape(0),B.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A + B[i];
+  Private::transform(C.data(), B.data(), C.size(),
+    [&A](const X &b) { return A + b; });
 
   return C;
 }
@@ -1763,8 +1807,8 @@ matrix<X> operator- (const X &A, const matrix<X> &B)
 {
   matrix<X> C(B.shape(0),B.shape(1));
 
-  for ( size_t i = 0 ; i < C.size() ; ++i )
-    C[i] = A - B[i];
+  Private::transform(C.data(), B.data(), C.size(),
+    [&A](const X &b) { return A - b; });
 
   return C;
 }